@@ -53,6 +53,8 @@
 #define  APP_CFG_STARTUP_TASK_PRIO          3u
 
 #define  OS_TASK_TMR_PRIO                  (OS_LOWEST_PRIO - 2u)
+#define  OS_TASK_INT_Q_PRIO                 0u
+#define  OS_TASK_TMR_CB_PRIO               (OS_LOWEST_PRIO - 6u)
 
 
 /*
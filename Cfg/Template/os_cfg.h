@@ -39,16 +39,24 @@
 #define OS_EVENT_MULTI_EN         1u   /* Include code for OSEventPendMulti()                          */
 #define OS_EVENT_NAME_EN          1u   /* Enable names for Sem, Mutex, Mbox and Q                      */
 
+#define OS_INT_DIS_MEAS_EN        0u   /* Measure interrupt disable and scheduler lock times           */
+
+#define OS_ISR_POST_DEFERRED_EN   0u   /* Defer posts made from ISRs to the ISR post handler task      */
+#define OS_INT_Q_SIZE            16u   /* Max. number of deferred ISR posts pending at once            */
+
 #define OS_LOWEST_PRIO           63u   /* Defines the lowest priority that can be assigned ...         */
                                        /* ... MUST NEVER be higher than 254!                           */
 
 #define OS_MAX_EVENTS            10u   /* Max. number of event control blocks in your application      */
 #define OS_MAX_FLAGS              5u   /* Max. number of Event Flag Groups    in your application      */
 #define OS_MAX_MEM_PART           5u   /* Max. number of memory partitions                             */
+#define OS_MAX_PIPES              2u   /* Max. number of pipe control blocks                           */
 #define OS_MAX_QS                 4u   /* Max. number of queue control blocks in your application      */
+#define OS_MAX_RINGS              2u   /* Max. number of ring buffer control blocks                    */
 #define OS_MAX_TASKS             20u   /* Max. number of tasks in your application, MUST be >= 2       */
 
 #define OS_SCHED_LOCK_EN          1u   /* Include code for OSSchedLock() and OSSchedUnlock()           */
+#define OS_SCHED_RR_EN            0u   /* Allow several tasks per priority, time sliced (round-robin)  */
 
 #define OS_TICK_STEP_EN           1u   /* Enable tick stepping feature for uC/OS-View                  */
 #define OS_TICKS_PER_SEC        100u   /* Set the number of ticks in one second                        */
@@ -60,6 +68,8 @@
 #define OS_TASK_TMR_STK_SIZE    128u   /* Timer      task stack size (# of OS_STK wide entries)        */
 #define OS_TASK_STAT_STK_SIZE   128u   /* Statistics task stack size (# of OS_STK wide entries)        */
 #define OS_TASK_IDLE_STK_SIZE   128u   /* Idle       task stack size (# of OS_STK wide entries)        */
+#define OS_TASK_INT_Q_STK_SIZE  128u   /* ISR post   task stack size (# of OS_STK wide entries)        */
+#define OS_TASK_TMR_CB_STK_SIZE 128u   /* Timer callback task stack size (# of OS_STK wide entries)    */
 
 
                                        /* --------------------- TASK MANAGEMENT ---------------------- */
@@ -69,10 +79,15 @@
 #define OS_TASK_DEL_EN            1u   /*     Include code for OSTaskDel()                             */
 #define OS_TASK_NAME_EN           1u   /*     Enable task names                                        */
 #define OS_TASK_PROFILE_EN        1u   /*     Include variables in OS_TCB for profiling                */
+#define OS_TASK_Q_EN              0u   /*     Include code for OSTaskQPost() and OSTaskQPend()         */
+#define OS_TASK_Q_SIZE            4u   /*     Size of each task's message queue (# of messages)        */
 #define OS_TASK_QUERY_EN          1u   /*     Include code for OSTaskQuery()                           */
 #define OS_TASK_REG_TBL_SIZE      1u   /*     Size of task variables array (#of INT32U entries)        */
+#define OS_TASK_SEM_EN            0u   /*     Include code for OSTaskSemPost() and OSTaskSemPend()     */
 #define OS_TASK_STAT_EN           1u   /*     Enable (1) or Disable(0) the statistics task             */
 #define OS_TASK_STAT_STK_CHK_EN   1u   /*     Check task stacks from statistic task                    */
+#define OS_TASK_STAT_TS_EN        0u   /*     Compute CPU usage from task run times, not the idle ctr  */
+#define OS_TASK_STAT_WINDOW      10u   /*     Period of the run time based CPU usage (# of ticks)      */
 #define OS_TASK_SUSPEND_EN        1u   /*     Include code for OSTaskSuspend() and OSTaskResume()      */
 #define OS_TASK_SW_HOOK_EN        1u   /*     Include code for OSTaskSwHook()                          */
 
@@ -80,11 +95,12 @@
                                        /* ----------------------- EVENT FLAGS ------------------------ */
 #define OS_FLAG_EN                1u   /* Enable (1) or Disable (0) code generation for EVENT FLAGS    */
 #define OS_FLAG_ACCEPT_EN         1u   /*     Include code for OSFlagAccept()                          */
+#define OS_FLAG_BIT_INDEX_EN      0u   /*     Index the waiting tasks by bit to speed up OSFlagPost()  */
 #define OS_FLAG_DEL_EN            1u   /*     Include code for OSFlagDel()                             */
 #define OS_FLAG_NAME_EN           1u   /*     Enable names for event flag group                        */
 #define OS_FLAG_QUERY_EN          1u   /*     Include code for OSFlagQuery()                           */
 #define OS_FLAG_WAIT_CLR_EN       1u   /* Include code for Wait on Clear EVENT FLAGS                   */
-#define OS_FLAGS_NBITS           16u   /* Size in #bits of OS_FLAGS data type (8, 16 or 32)            */
+#define OS_FLAGS_NBITS           16u   /* Size in #bits of OS_FLAGS data type (8, 16, 32 or 64)        */
 
 
                                        /* -------------------- MESSAGE MAILBOXES --------------------- */
@@ -107,6 +123,9 @@
 #define OS_MUTEX_EN               1u   /* Enable (1) or Disable (0) code generation for MUTEX          */
 #define OS_MUTEX_ACCEPT_EN        1u   /*     Include code for OSMutexAccept()                         */
 #define OS_MUTEX_DEL_EN           1u   /*     Include code for OSMutexDel()                            */
+#define OS_MUTEX_FAST_EN          0u   /*     Uncontended Pend/Post without disabling ints (port CAS)  */
+#define OS_MUTEX_INHERIT_EN       0u   /*     Priority inheritance mutexes (needs OS_SCHED_RR_EN)      */
+#define OS_MUTEX_NEST_EN          0u   /*     Include code for nestable mutexes (OSMutexCreateEx())    */
 #define OS_MUTEX_QUERY_EN         1u   /*     Include code for OSMutexQuery()                          */
 
 
@@ -114,7 +133,9 @@
 #define OS_Q_EN                   1u   /* Enable (1) or Disable (0) code generation for QUEUES         */
 #define OS_Q_ACCEPT_EN            1u   /*     Include code for OSQAccept()                             */
 #define OS_Q_DEL_EN               1u   /*     Include code for OSQDel()                                */
+#define OS_Q_EX_EN                0u   /*     Include code for by-value queues (OSQCreateEx() ...)     */
 #define OS_Q_FLUSH_EN             1u   /*     Include code for OSQFlush()                              */
+#define OS_Q_MULTI_EN             0u   /*     Include code for OSQPostMulti() and OSQPendMulti()       */
 #define OS_Q_PEND_ABORT_EN        1u   /*     Include code for OSQPendAbort()                          */
 #define OS_Q_POST_EN              1u   /*     Include code for OSQPost()                               */
 #define OS_Q_POST_FRONT_EN        1u   /*     Include code for OSQPostFront()                          */
@@ -122,10 +143,26 @@
 #define OS_Q_QUERY_EN             1u   /*     Include code for OSQQuery()                              */
 
 
+                                       /* ------------------------ BYTE PIPES ------------------------ */
+#define OS_PIPE_EN                0u   /* Enable (1) or Disable (0) code generation for PIPES          */
+#define OS_PIPE_DEL_EN            1u   /*     Include code for OSPipeDel()                             */
+
+
+                                       /* ------------------ ISR TO TASK RING BUFFERS ---------------- */
+#define OS_RING_EN                0u   /* Enable (1) or Disable (0) code generation for RING BUFFERS   */
+#define OS_RING_DEL_EN            1u   /*     Include code for OSRingDel()                             */
+
+
+                                       /* -------------------- READER-WRITER LOCKS ------------------- */
+#define OS_RWLOCK_EN              0u   /* Enable (1) or Disable (0) code generation for RW LOCKS       */
+#define OS_RWLOCK_DEL_EN          1u   /*     Include code for OSRWLockDel()                           */
+
+
                                        /* ------------------------ SEMAPHORES ------------------------ */
 #define OS_SEM_EN                 1u   /* Enable (1) or Disable (0) code generation for SEMAPHORES     */
 #define OS_SEM_ACCEPT_EN          1u   /*    Include code for OSSemAccept()                            */
 #define OS_SEM_DEL_EN             1u   /*    Include code for OSSemDel()                               */
+#define OS_SEM_FAST_EN            0u   /*     Uncontended Pend/Post without disabling ints (port CAS)  */
 #define OS_SEM_PEND_ABORT_EN      1u   /*    Include code for OSSemPendAbort()                         */
 #define OS_SEM_QUERY_EN           1u   /*    Include code for OSSemQuery()                             */
 #define OS_SEM_SET_EN             1u   /*    Include code for OSSemSet()                               */
@@ -136,6 +173,8 @@
 #define OS_TIME_DLY_RESUME_EN     1u   /*     Include code for OSTimeDlyResume()                       */
 #define OS_TIME_GET_SET_EN        1u   /*     Include code for OSTimeGet() and OSTimeSet()             */
 #define OS_TIME_TICK_HOOK_EN      1u   /*     Include code for OSTimeTickHook()                        */
+#define OS_TICK_LIST_EN           0u   /*     Keep delayed tasks in a sorted (delta) list              */
+#define OS_TICKLESS_EN            0u   /*     Suppress the tick interrupt while the CPU is idle        */
 
 
                                        /* --------------------- TIMER MANAGEMENT --------------------- */
@@ -143,7 +182,13 @@
 #define OS_TMR_CFG_MAX           16u   /*     Maximum number of timers                                 */
 #define OS_TMR_CFG_NAME_EN        1u   /*     Determine timer names                                    */
 #define OS_TMR_CFG_WHEEL_SIZE     7u   /*     Size of timer wheel (#Spokes)                            */
+#define OS_TMR_CFG_WHEEL_LVLS     3u   /*     Number of levels of the timer wheel (1 .. 4)             */
 #define OS_TMR_CFG_TICKS_PER_SEC 10u   /*     Rate at which timer management task runs (Hz)            */
+#define OS_TMR_CFG_LATE_EN        0u   /*     Keep per-timer expiry lateness statistics                */
+#define OS_TMR_CFG_CB_DEFER_EN    0u   /*     Run timer callbacks after releasing the scheduler lock   */
+#define OS_TMR_CFG_CB_TASKS       0u   /*     Nbr of callback tasks (0 = callbacks run in timer task)  */
+#define OS_TMR_CFG_TICK_EN        0u   /*     Process the timers in OSTimeTick(), no timer task        */
+#define OS_TMR_CFG_TICK_CB_MAX    4u   /*     Max. nbr of callbacks called per tick (TICK_EN only)     */
 
 
                                        /* ---------------------- TRACE RECORDER ---------------------- */
@@ -69,10 +69,6 @@
 #define  OS_CPU_ARM_ENDIAN_TYPE            OS_CPU_ARM_ENDIAN_LITTLE
 #endif
 
-#ifndef  OS_CPU_INT_DIS_MEAS_EN
-#define  OS_CPU_INT_DIS_MEAS_EN                           0u    /* Intrrupt dis time measurement disabled by default    */
-#endif
-
 
 /*
 *********************************************************************************************************
@@ -113,6 +109,8 @@ typedef  CPU_SR      OS_CPU_SR;                                 /* Define size o
 #define  OS_TASK_SW()                              OSCtxSw()
 #define  OS_STK_GROWTH                                    1u    /* Stack grows from HIGH to LOW memory on ARM           */
 
+#define  OS_CPU_TS_GET()                     OS_CPU_TS_Get()    /* Free running timestamp, generic timer (CNTVCT_EL0)   */
+
 
 /*
 *********************************************************************************************************
@@ -140,11 +138,11 @@ typedef  CPU_SR      OS_CPU_SR;                                 /* Define size o
 
 #if     (OS_CRITICAL_METHOD == 3u)
 
-#if     (OS_CPU_INT_DIS_MEAS_EN > 0u)
+#if     (OS_INT_DIS_MEAS_EN > 0u)
 
 #define  OS_ENTER_CRITICAL()  do { cpu_sr = CPU_SR_Save();  \
-                                   OS_CPU_IntDisMeasStart();  } while (0)
-#define  OS_EXIT_CRITICAL()   do { OS_CPU_IntDisMeasStop();    \
+                                   OS_IntDisMeasStart();  } while (0)
+#define  OS_EXIT_CRITICAL()   do { OS_IntDisMeasStop();    \
                                    CPU_SR_Restore(cpu_sr); } while (0)
 
 #else
@@ -152,7 +150,7 @@ typedef  CPU_SR      OS_CPU_SR;                                 /* Define size o
 #define  OS_ENTER_CRITICAL()  do {cpu_sr = CPU_SR_Save();} while (0)
 #define  OS_EXIT_CRITICAL()   do {CPU_SR_Restore(cpu_sr);} while (0)
 
-#endif                                                          /* OS_CPU_INT_DIS_MEAS_EN > 0u                          */
+#endif                                                          /* OS_INT_DIS_MEAS_EN > 0u                              */
 
 #endif                                                          /* OS_CRITICAL_METHOD == 3u                             */
 
@@ -163,16 +161,6 @@ typedef  CPU_SR      OS_CPU_SR;                                 /* Define size o
 *********************************************************************************************************
 */
 
-                                                                /* Variables used to measure interrupt disable time     */
-#if (OS_CPU_INT_DIS_MEAS_EN > 0u)
-OS_CPU_EXT  INT16U   OS_CPU_IntDisMeasNestingCtr;
-OS_CPU_EXT  INT16U   OS_CPU_IntDisMeasCntsEnter;
-OS_CPU_EXT  INT16U   OS_CPU_IntDisMeasCntsExit;
-OS_CPU_EXT  INT16U   OS_CPU_IntDisMeasCntsMax;
-OS_CPU_EXT  INT16U   OS_CPU_IntDisMeasCntsDelta;
-OS_CPU_EXT  INT16U   OS_CPU_IntDisMeasCntsOvrhd;
-#endif
-
 OS_CPU_EXT  OS_STK   OS_CPU_ExceptStk[OS_CPU_EXCEPT_STK_SIZE];
 OS_CPU_EXT  OS_STK  *OS_CPU_ExceptStkBase;
 
@@ -212,12 +200,8 @@ OS_CPU_EXT  OS_STK  *OS_CPU_ExceptStkBase;
 
     INT32U     OS_CPU_ExceptStkChk                (void);
 
-#if (OS_CPU_INT_DIS_MEAS_EN > 0u)
-    void       OS_CPU_IntDisMeasInit              (void);
-    void       OS_CPU_IntDisMeasStart             (void);
-    void       OS_CPU_IntDisMeasStop              (void);
-    INT16U     OS_CPU_IntDisMeasTmrRd             (void);
-#endif
+    INT32U     OS_CPU_TS_Get                      (void);
+
     INT64U     OS_CPU_SPSRGet                     (void);
     INT64U     OS_CPU_SIMDGet                     (void);
 #endif
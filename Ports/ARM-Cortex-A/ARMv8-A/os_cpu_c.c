@@ -112,9 +112,7 @@ void  OSInitHookBegin (void)
 
 void  OSInitHookEnd (void)
 {
-#if (OS_CPU_INT_DIS_MEAS_EN > 0u)
-    OS_CPU_IntDisMeasInit();
-#endif
+
 }
 
 
@@ -462,48 +460,25 @@ void  OSTimeTickHook (void)
 
 /*
 *********************************************************************************************************
-*                              INTERRUPT DISABLE TIME MEASUREMENT, START
+*                                             TIMESTAMP
+*
+* Description : Read the free running timestamp used by uC/OS-II to measure short intervals of time (see
+*               OS_CPU_TS_GET()).
+*
+* Argument(s) : none
+*
+* Return(s)   : The lower 32 bits of the virtual count of the generic timer (CNTVCT_EL0).
+*
+* Note(s)     : 1) The generic timer runs at the frequency given by CNTFRQ_EL0, not at the CPU clock.
 *********************************************************************************************************
 */
 
-#if (OS_CPU_INT_DIS_MEAS_EN > 0u)
-void  OS_CPU_IntDisMeasInit (void)
+INT32U  OS_CPU_TS_Get (void)
 {
-    OS_CPU_IntDisMeasNestingCtr = 0u;
-    OS_CPU_IntDisMeasCntsEnter  = 0u;
-    OS_CPU_IntDisMeasCntsExit   = 0u;
-    OS_CPU_IntDisMeasCntsMax    = 0u;
-    OS_CPU_IntDisMeasCntsDelta  = 0u;
-    OS_CPU_IntDisMeasCntsOvrhd  = 0u;
-    OS_CPU_IntDisMeasStart();                                   /* Measure the overhead of the functions                */
-    OS_CPU_IntDisMeasStop();
-    OS_CPU_IntDisMeasCntsOvrhd  = OS_CPU_IntDisMeasCntsDelta;
-}
+    INT64U  cnt;
 
 
-void  OS_CPU_IntDisMeasStart (void)
-{
-    OS_CPU_IntDisMeasNestingCtr++;
-    if (OS_CPU_IntDisMeasNestingCtr == 1u) {                    /* Only measure at the first nested level               */
-        OS_CPU_IntDisMeasCntsEnter = OS_CPU_IntDisMeasTmrRd();
-    }
-}
+    __asm__ volatile ("mrs %0, cntvct_el0" : "=r" (cnt));
 
-
-void  OS_CPU_IntDisMeasStop (void)
-{
-    OS_CPU_IntDisMeasNestingCtr--;                                      /* Decrement nesting ctr                                */
-    if (OS_CPU_IntDisMeasNestingCtr == 0u) {
-        OS_CPU_IntDisMeasCntsExit  = OS_CPU_IntDisMeasTmrRd();
-        OS_CPU_IntDisMeasCntsDelta = OS_CPU_IntDisMeasCntsExit - OS_CPU_IntDisMeasCntsEnter;
-        if (OS_CPU_IntDisMeasCntsDelta > OS_CPU_IntDisMeasCntsOvrhd) {  /* Ensure overhead < delta                              */
-            OS_CPU_IntDisMeasCntsDelta -= OS_CPU_IntDisMeasCntsOvrhd;
-        } else {
-            OS_CPU_IntDisMeasCntsDelta  = OS_CPU_IntDisMeasCntsOvrhd;
-        }
-        if (OS_CPU_IntDisMeasCntsDelta > OS_CPU_IntDisMeasCntsMax) {    /* Track MAXIMUM                                        */
-            OS_CPU_IntDisMeasCntsMax = OS_CPU_IntDisMeasCntsDelta;
-        }
-    }
+    return ((INT32U)cnt);
 }
-#endif
@@ -57,6 +57,8 @@ OS_KA_BASEPRI_BoundaryAddr:  .word  OS_KA_BASEPRI_Boundary
     .global  OSStartHighRdy                                     ; Functions declared in this file
     .global  OS_CPU_SR_Save
     .global  OS_CPU_SR_Restore
+    .global  OS_CPU_WaitForInt
+    .global  OS_CPU_CntTrailZeros
     .global  OSCtxSw
     .global  OSIntCtxSw
     .global  OS_CPU_PendSVHandler
@@ -208,6 +210,47 @@ OS_CPU_SR_Restore:
     .endasmfunc
 
 
+;********************************************************************************************************
+;                                  WAIT FOR INTERRUPT (TICKLESS IDLE)
+;                               void  OS_CPU_WaitForInt(OS_CPU_SR  basepri);
+;
+; Note(s) : 1) This function is called by OSTaskIdleTicklessHook() with Kernel Aware interrupts disabled.
+;              PRIMASK is set & BASEPRI cleared so that any pending interrupt wakes the CPU up from WFI
+;              without being taken.
+;
+;           2) On return, BASEPRI is set to 'basepri' (i.e. Kernel Aware interrupts remain disabled) and
+;              PRIMASK is cleared.
+;********************************************************************************************************
+    .asmfunc
+OS_CPU_WaitForInt:
+    CPSID   I                                   ; See Note #1
+    MOVS    R1, #0
+    MSR     BASEPRI, R1
+    DSB
+    WFI                                         ; Wait for a (pending) interrupt
+    MSR     BASEPRI, R0                         ; See Note #2
+    DSB
+    ISB
+    CPSIE   I
+    BX      LR
+    .endasmfunc
+
+
+;********************************************************************************************************
+;                                      COUNT TRAILING ZEROS
+;                               INT32U  OS_CPU_CntTrailZeros(INT32U  val);
+;
+; Note(s) : 1) Returns the index of the lowest bit set in 'val', which corresponds to the highest
+;              priority in the ready list bitmaps (see OS_SchedNew()).  'val' MUST NOT be 0.
+;********************************************************************************************************
+    .asmfunc
+OS_CPU_CntTrailZeros:
+    RBIT    R0, R0                              ; Reverse bits, lowest bit becomes highest
+    CLZ     R0, R0
+    BX      LR
+    .endasmfunc
+
+
 ;********************************************************************************************************
 ;                                         START MULTITASKING
 ;                                      void OSStartHighRdy(void)
@@ -160,12 +160,20 @@ typedef unsigned int   OS_CPU_SR;                /* Define size of CPU status re
 #define  OS_CRITICAL_METHOD   3u
 
 #if OS_CRITICAL_METHOD == 3u
+#if OS_INT_DIS_MEAS_EN > 0u                      /* Measure the time spent in the critical section ... */
+                                                 /* ... see OS_IntDisMeasStart()/OS_IntDisMeasStop()   */
+#define  OS_ENTER_CRITICAL()  do { cpu_sr = OS_CPU_SR_Save(CPU_CFG_KA_IPL_BOUNDARY << (8u - CPU_CFG_NVIC_PRIO_BITS)); \
+                                   OS_IntDisMeasStart();} while (0)
+#define  OS_EXIT_CRITICAL()   do { OS_IntDisMeasStop(); \
+                                   OS_CPU_SR_Restore(cpu_sr);} while (0)
+#else
                                                  /* Save current BASEPRI priority lvl for exception... */
                                                  /* .. and set BASEPRI to CPU_CFG_KA_IPL_BOUNDARY      */
 #define  OS_ENTER_CRITICAL()  do { cpu_sr = OS_CPU_SR_Save(CPU_CFG_KA_IPL_BOUNDARY << (8u - CPU_CFG_NVIC_PRIO_BITS));} while (0)
                                                  /* Restore CPU BASEPRI priority level.                */
 #define  OS_EXIT_CRITICAL()   do { OS_CPU_SR_Restore(cpu_sr);} while (0)
 #endif
+#endif
 
 
 /*
@@ -178,6 +186,19 @@ typedef unsigned int   OS_CPU_SR;                /* Define size of CPU status re
 
 #define  OS_TASK_SW()         OSCtxSw()
 
+                                                 /* Index of the lowest bit set (RBIT + CLZ)           */
+#define  OS_CPU_CNT_TRAIL_ZEROS(val)  ((INT32U)__builtin_ctz((unsigned int)(val)))
+
+                                                 /* Compare-and-swap (LDREX/STREX), OS_TRUE if swapped */
+#define  OS_CPU_CAS16(p, o, n)        ((BOOLEAN)__atomic_compare_exchange_n((p), &(INT16U){(o)}, (n), \
+                                          0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+#define  OS_CPU_CAS_PTR(p, o, n)      ((BOOLEAN)__atomic_compare_exchange_n((p), &(void *){(o)}, (n), \
+                                          0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+
+                                                 /* Free running timestamp, DWT cycle counter          */
+#define  OS_CPU_CM_DWT_CYCCNT         (*((volatile INT32U *)0xE0001004uL))
+#define  OS_CPU_TS_GET()              OS_CPU_CM_DWT_CYCCNT
+
 
 /*
 *********************************************************************************************************
@@ -200,6 +221,8 @@ OS_CPU_SR  OS_CPU_SR_Save         (OS_CPU_SR  new_basepri);
 void       OS_CPU_SR_Restore      (OS_CPU_SR  cpu_sr);
 #endif
 
+void       OS_CPU_WaitForInt      (OS_CPU_SR  basepri);
+
 void       OSCtxSw                (void);
 void       OSIntCtxSw             (void);
 void       OSStartHighRdy         (void);
@@ -54,6 +54,10 @@
 static  INT16U  OSTmrCtr;
 #endif
 
+#if OS_TICKLESS_EN > 0u
+static  INT32U  OS_CPU_SysTickCnts;                             /* Nbr of SysTick counts per OS tick.                   */
+#endif
+
 /*
 *********************************************************************************************************
 *                                       LOCAL GLOBAL VARIABLES
@@ -76,6 +80,7 @@ INT32U  OS_KA_BASEPRI_Boundary;                                 /* Base Priority
 #define  OS_CPU_CM_SCB_SHPRI1       (*((volatile INT32U *)0xE000ED18uL)) /* System Handlers  4 to  7 Prio.              */
 #define  OS_CPU_CM_SCB_SHPRI2       (*((volatile INT32U *)0xE000ED1CuL)) /* System Handlers  8 to 11 Prio.              */
 #define  OS_CPU_CM_SCB_SHPRI3       (*((volatile INT32U *)0xE000ED20uL)) /* System Handlers 12 to 15 Prio.              */
+#define  OS_CPU_CM_SCB_ICSR         (*((volatile INT32U *)0xE000ED04uL)) /* Interrupt Control & State Reg.              */
 
 
 #define  OS_CPU_CM_SYST_CSR_COUNTFLAG                     0x00010000uL   /* Count flag.                                 */
@@ -83,6 +88,9 @@ INT32U  OS_KA_BASEPRI_Boundary;                                 /* Base Priority
 #define  OS_CPU_CM_SYST_CSR_TICKINT                       0x00000002uL   /* Interrupt enable.                           */
 #define  OS_CPU_CM_SYST_CSR_ENABLE                        0x00000001uL   /* Counter mode.                               */
 
+#define  OS_CPU_CM_SYST_RVR_MAX                           0x00FFFFFFuL   /* Max reload value (24-bit counter).          */
+#define  OS_CPU_CM_SCB_ICSR_PENDSTSET                     0x04000000uL   /* SysTick exception pending.                  */
+
 
 /*
 *********************************************************************************************************
@@ -96,6 +104,21 @@ INT32U  OS_KA_BASEPRI_Boundary;                                 /* Base Priority
 #define  OS_CPU_CM_FPCCR_LAZY_STK                         0xC0000000uL   /* See Note 1.                                 */
 
 
+/*
+*********************************************************************************************************
+*                                      DATA WATCHPOINT AND TRACE DEFINES
+*
+* Note(s) : 1) The DWT cycle counter is the timestamp of the port (see OS_CPU_TS_GET()).
+*********************************************************************************************************
+*/
+
+#define  OS_CPU_CM_DEMCR            (*((volatile INT32U *)0xE000EDFCuL)) /* Debug Exception & Monitor Ctrl Reg.         */
+#define  OS_CPU_CM_DWT_CTRL         (*((volatile INT32U *)0xE0001000uL)) /* DWT Control Reg.                            */
+
+#define  OS_CPU_CM_DEMCR_TRCENA                           0x01000000uL   /* Enable the DWT unit.                        */
+#define  OS_CPU_CM_DWT_CTRL_CYCCNTENA                     0x00000001uL   /* Enable the cycle counter.                   */
+
+
 /*
 *********************************************************************************************************
 *                                       OS INITIALIZATION HOOK
@@ -109,6 +132,7 @@ INT32U  OS_KA_BASEPRI_Boundary;                                 /* Base Priority
 *              2) When using hardware floating point please do the following during the reset handler:
 *                 a) Set full access for CP10 & CP11 bits in CPACR register.
 *                 b) Set bits ASPEN and LSPEN in FPCCR register.
+*              3) The DWT cycle counter is started for OS_CPU_TS_GET().
 *********************************************************************************************************
 */
 #if OS_CPU_HOOKS_EN > 0u
@@ -140,6 +164,10 @@ void  OSInitHookBegin (void)
     }
 #endif
 
+                                                                /* Start the DWT cycle counter, see Note (3).           */
+    OS_CPU_CM_DEMCR    |= OS_CPU_CM_DEMCR_TRCENA;
+    OS_CPU_CM_DWT_CTRL |= OS_CPU_CM_DWT_CTRL_CYCCNTENA;
+
 #if OS_TMR_EN > 0u
     OSTmrCtr = 0u;
 #endif
@@ -238,6 +266,96 @@ void  OSTaskIdleHook (void)
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                        TICKLESS IDLE TASK HOOK
+*
+* Description: This function is called by the idle task when no task delay or timer expires for at least
+*              'ticks' ticks.  The SysTick is reprogrammed to expire after that many ticks and the CPU is
+*              put to sleep until an interrupt occurs.
+*
+* Arguments  : ticks     is the number of ticks which may be skipped.
+*
+* Returns    : The number of ticks which elapsed and are not processed by OS_CPU_SysTickHandler().
+*
+* Note(s)    : 1) Kernel Aware interrupts are disabled during this call and remain so on return.  Any
+*                 interrupt still wakes the CPU up, see OS_CPU_WaitForInt().
+*
+*              2) The number of ticks is limited by the 24-bit SysTick counter.
+*
+*              3) If the suppressed period expired, the SysTick exception is pending and the last tick is
+*                 processed by OS_CPU_SysTickHandler() as soon as interrupts are re-enabled.
+*
+*              4) The SysTick is restarted so that the next tick occurs at its regular time.  The counter
+*                 is stopped for a few cycles while it is reprogrammed, this small drift is not corrected.
+*
+*              5) OS_CPU_SysTickInit() MUST have been called.
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_HOOKS_EN > 0u) && (OS_TICKLESS_EN > 0u)
+INT32U  OSTaskIdleTicklessHook (INT32U  ticks)
+{
+    INT32U  cnts;
+    INT32U  cur;
+    INT32U  reload;
+    INT32U  elapsed;
+    INT32U  next;
+
+
+    cnts = OS_CPU_SysTickCnts;
+    if (ticks > (OS_CPU_CM_SYST_RVR_MAX / cnts)) {              /* See Note #2.                                         */
+        ticks = OS_CPU_CM_SYST_RVR_MAX / cnts;
+    }
+    if (ticks < 2u) {
+        return (0u);
+    }
+
+    OS_CPU_CM_SYST_CSR &= ~OS_CPU_CM_SYST_CSR_ENABLE;           /* Stop the SysTick.                                    */
+    cur = OS_CPU_CM_SYST_CVR;                                   /* Nbr of counts left in the current tick.              */
+    if ((cur == 0u) ||
+        ((OS_CPU_CM_SCB_ICSR & OS_CPU_CM_SCB_ICSR_PENDSTSET) != 0u)) {
+        OS_CPU_CM_SYST_CSR |= OS_CPU_CM_SYST_CSR_ENABLE;        /* A tick is already pending, don't sleep.              */
+        return (0u);
+    }
+
+    reload              = cur + (cnts * (ticks - 1u));          /* Expire on the boundary of the last tick.             */
+    OS_CPU_CM_SYST_RVR  = reload;
+    OS_CPU_CM_SYST_CVR  = 0u;
+    OS_CPU_CM_SYST_CSR |= OS_CPU_CM_SYST_CSR_ENABLE;
+
+    OS_CPU_WaitForInt(OS_KA_BASEPRI_Boundary);                  /* See Note #1.                                         */
+
+    OS_CPU_CM_SYST_CSR &= ~OS_CPU_CM_SYST_CSR_ENABLE;
+    cur = OS_CPU_CM_SYST_CVR;
+    if ((cur == 0u) ||
+        ((OS_CPU_CM_SCB_ICSR & OS_CPU_CM_SCB_ICSR_PENDSTSET) != 0u)) {
+        elapsed = ticks - 1u;                                   /* See Note #3.                                         */
+        next    = cnts;
+        if ((reload - cur) < cnts) {                            /* Counter was reloaded with 'reload' on expiry.        */
+            next = cnts - (reload - cur);
+        }
+    } else {                                                    /* Woken up early by another interrupt.                 */
+        elapsed = (ticks - 1u) - ((cur - 1u) / cnts);
+        next    = ((cur - 1u) % cnts) + 1u;
+    }
+    if (next < 2u) {
+        next = 2u;
+    }
+
+    OS_CPU_CM_SYST_RVR  = next - 1u;                            /* See Note #4.                                         */
+    OS_CPU_CM_SYST_CVR  = 0u;
+    OS_CPU_CM_SYST_CSR |= OS_CPU_CM_SYST_CSR_ENABLE;
+    while (OS_CPU_CM_SYST_CVR == 0u) {                          /* Wait for the counter to load 'next' ...              */
+        ;
+    }
+    OS_CPU_CM_SYST_RVR  = cnts - 1u;                            /* ... then resume the regular tick period.             */
+
+    return (elapsed);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                            TASK RETURN HOOK
@@ -712,6 +830,9 @@ void  OS_CPU_SysTickInit (INT32U  cnts)
                                                                 /* Set BASEPRI boundary from the configuration.         */
     basepri               = (INT32U)(CPU_CFG_KA_IPL_BOUNDARY << (8u - CPU_CFG_NVIC_PRIO_BITS));
     OS_CPU_CM_SYST_RVR    = cnts - 1u;                          /* Set Reload register.                                 */
+#if OS_TICKLESS_EN > 0u
+    OS_CPU_SysTickCnts    = cnts;                               /* Needed by OSTaskIdleTicklessHook().                  */
+#endif
 
                                                                 /* Set SysTick handler prio.                            */
     prio                  =  OS_CPU_CM_SCB_SHPRI3;
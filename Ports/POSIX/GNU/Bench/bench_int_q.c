@@ -0,0 +1,220 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-II
+*                                        The Real-Time Kernel
+*
+*                    Copyright 1992-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*
+*                                  DEFERRED ISR POST LATENCY BENCHMARK
+*
+* Filename : bench_int_q.c
+* Version  : V2.93.01
+*********************************************************************************************************
+* Note(s) : (1) This program measures how long an ISR keeps interrupts disabled to post to an event flag
+*               group while 1 to BENCH_N_WAIT_MAX tasks are waiting on it.  It is built from this
+*               directory, once posting directly and once deferring the posts (OS_ISR_POST_DEFERRED_EN):
+*
+*                   cc -O2 -I. -I.. -I../../../../Source -I../../../../Cfg/Template -o bench_int_q \
+*                      bench_int_q.c ../os_cpu_c.c ../../../../Source/ucos_ii.c                    \
+*                      ../../../../Cfg/Template/app_hooks.c -pthread
+*
+*                   cc -DBENCH_ISR_POST_DEFERRED=1 ... (same arguments)
+*
+*           (2) The ISR is emulated by the benchmark task: OSIntEnter(), the post and OSIntExit() are
+*               called with interrupts disabled, as they would be by an interrupt handler.  The time is
+*               taken around the post only, with OS_CPU_TS_GET().
+*
+*           (3) The host may preempt the benchmark at any time.  The maximum is therefore taken for
+*               each of BENCH_N_ROUND rounds and the smallest of these maxima is reported.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <ucos_ii.h>
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  BENCH_N_WAIT_MAX                 56u   /* Max. nbr of tasks waiting on the event flag group   */
+#define  BENCH_N_ROUND                     7u   /* Nbr of rounds, see Note #3                          */
+#define  BENCH_N_POST                   2000u   /* Nbr of posts per round                              */
+
+#define  BENCH_PRIO_WAIT                   4u   /* Priority of the first waiting task                  */
+#define  BENCH_PRIO_CTL                   60u   /* Below the waiting tasks, which re-pend at once      */
+
+#define  BENCH_STK_SIZE                 4096u
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL TABLES
+*********************************************************************************************************
+*/
+
+static  const  INT8U  BenchNWaitTbl[] = {1u, 4u, 16u, BENCH_N_WAIT_MAX};
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_STK        BenchCtlStk[BENCH_STK_SIZE];
+static  OS_STK        BenchWaitStk[BENCH_N_WAIT_MAX][BENCH_STK_SIZE];
+
+static  OS_FLAG_GRP  *BenchGrp;
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void    BenchCtlTask (void  *p_arg);
+static  void    BenchWaitTask(void  *p_arg);
+static  INT32U  BenchIntPost (void);
+
+
+/*
+*********************************************************************************************************
+*                                                main()
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    INT8U  err;
+
+
+    OSInit();
+    BenchGrp = OSFlagCreate((OS_FLAGS)0, &err);
+    (void)OSTaskCreate(BenchCtlTask, (void *)0, &BenchCtlStk[BENCH_STK_SIZE - 1u], BENCH_PRIO_CTL);
+    OSStart();
+    return (0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           BENCHMARK TASK
+*
+* Description: Adds waiting tasks step by step and measures the post of an emulated ISR for each step.
+*********************************************************************************************************
+*/
+
+static  void  BenchCtlTask (void  *p_arg)
+{
+    INT8U   n_wait;
+    INT8U   i;
+    INT32U  round;
+    INT32U  post;
+    INT32U  ts;
+    INT32U  ts_max;
+    INT32U  ts_min_max;
+    double  ts_tot;
+
+
+    (void)p_arg;
+    printf("OS_ISR_POST_DEFERRED_EN = %u\n", (unsigned)OS_ISR_POST_DEFERRED_EN);
+    n_wait = 0u;
+    for (i = 0u; i < (INT8U)(sizeof(BenchNWaitTbl) / sizeof(BenchNWaitTbl[0])); i++) {
+        while (n_wait < BenchNWaitTbl[i]) {                     /* Waiting tasks pend at once         */
+            (void)OSTaskCreate(BenchWaitTask,
+                               (void *)0,
+                               &BenchWaitStk[n_wait][BENCH_STK_SIZE - 1u],
+                               (INT8U)(BENCH_PRIO_WAIT + n_wait));
+            n_wait++;
+        }
+        ts_min_max = 0xFFFFFFFFu;
+        ts_tot     = 0.0;
+        for (round = 0u; round < BENCH_N_ROUND; round++) {
+            ts_max = 0u;
+            for (post = 0u; post < BENCH_N_POST; post++) {
+                ts      = BenchIntPost();
+                ts_tot += (double)ts;
+                if (ts_max < ts) {
+                    ts_max = ts;
+                }
+            }
+            if (ts_min_max > ts_max) {
+                ts_min_max = ts_max;
+            }
+        }
+        printf("%2u waiting tasks: %7.2f us max, %7.2f us avg per ISR post\n",
+               (unsigned)n_wait,
+               (double)ts_min_max / 1000.0,
+               ts_tot / (double)(BENCH_N_ROUND * BENCH_N_POST) / 1000.0);
+    }
+    exit(0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            WAITING TASK
+*
+* Description: Waits for the flag set by the emulated ISR.  The flag is consumed by the first task to
+*              run, all of the tasks are thus waiting again when the benchmark task resumes.
+*********************************************************************************************************
+*/
+
+static  void  BenchWaitTask (void  *p_arg)
+{
+    INT8U  err;
+
+
+    (void)p_arg;
+    for (;;) {
+        (void)OSFlagPend(BenchGrp, (OS_FLAGS)0x01u, OS_FLAG_WAIT_SET_ANY + OS_FLAG_CONSUME, 0u, &err);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                            EMULATED ISR
+*
+* Description: Posts to the event flag group from an emulated ISR (see Note #2).
+*
+* Returns    : The duration of the post, in OS_CPU_TS_GET() units (ns on the POSIX port).
+*********************************************************************************************************
+*/
+
+static  INT32U  BenchIntPost (void)
+{
+    INT8U      err;
+    INT32U     ts;
+#if OS_CRITICAL_METHOD == 3u                                    /* Storage for CPU status register    */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+    OS_ENTER_CRITICAL();
+    OSIntEnter();
+    ts = OS_CPU_TS_GET();
+    (void)OSFlagPost(BenchGrp, (OS_FLAGS)0x01u, OS_FLAG_SET, &err);
+    ts = OS_CPU_TS_GET() - ts;
+    OSIntExit();                                                /* Waiting tasks run                  */
+    OS_EXIT_CRITICAL();
+    return (ts);
+}
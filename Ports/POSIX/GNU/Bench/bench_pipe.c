@@ -0,0 +1,202 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-II
+*                                        The Real-Time Kernel
+*
+*                    Copyright 1992-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*
+*                                       PIPE THROUGHPUT BENCHMARK
+*
+* Filename : bench_pipe.c
+* Version  : V2.93.01
+*********************************************************************************************************
+* Note(s) : (1) This program compares the cost per byte of moving bytes through a pipe (OSPipeWrite()
+*               and OSPipeRead()) and through a queue, one byte per message (OSQPost() and OSQAccept()).
+*               It is built from this directory:
+*
+*                   cc -O2 -I. -I.. -I../../../../Source -I../../../../Cfg/Template -o bench_pipe \
+*                      bench_pipe.c ../os_cpu_c.c ../../../../Source/ucos_ii.c                    \
+*                      ../../../../Cfg/Template/app_hooks.c -pthread
+*
+*           (2) The benchmark task writes a chunk and then reads it back, the pipe and the queue are thus
+*               never waited on and the figures only include the transfers themselves.  The buffers are
+*               aligned alike, so that the pipe copies whole words (see os_pipe.c Note #4).
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <ucos_ii.h>
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  BENCH_N_BYTE                 800000u   /* Nbr of bytes moved per measurement                  */
+#define  BENCH_CHUNK_MAX                1000u   /* Largest chunk                                       */
+
+#define  BENCH_PRIO_CTL                   10u
+
+#define  BENCH_STK_SIZE                 4096u
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL TABLES
+*********************************************************************************************************
+*/
+
+static  const  INT16U  BenchChunkTbl[] = {1u, 16u, 200u, BENCH_CHUNK_MAX};
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_STK     BenchCtlStk[BENCH_STK_SIZE];
+
+static  INT32U     BenchPipeBuf[(BENCH_CHUNK_MAX / sizeof(INT32U)) + 1u];   /* One entry left empty  */
+static  void      *BenchQTbl[BENCH_CHUNK_MAX];
+
+static  INT32U     BenchTxBuf[BENCH_CHUNK_MAX / sizeof(INT32U)];
+static  INT32U     BenchRxBuf[BENCH_CHUNK_MAX / sizeof(INT32U)];
+
+static  OS_EVENT  *BenchPipe;
+static  OS_EVENT  *BenchQ;
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void    BenchCtlTask(void    *p_arg);
+static  double  BenchPipeRW (INT16U   chunk);
+static  double  BenchQRW    (INT16U   chunk);
+
+
+/*
+*********************************************************************************************************
+*                                                main()
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    OSInit();
+    BenchPipe = OSPipeCreate((void *)&BenchPipeBuf[0], (INT16U)sizeof(BenchPipeBuf));
+    BenchQ    = OSQCreate(&BenchQTbl[0], BENCH_CHUNK_MAX);
+    (void)OSTaskCreate(BenchCtlTask, (void *)0, &BenchCtlStk[BENCH_STK_SIZE - 1u], BENCH_PRIO_CTL);
+    OSStart();
+    return (0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           BENCHMARK TASK
+*
+* Description: Measures both ways of moving bytes for each chunk size.
+*********************************************************************************************************
+*/
+
+static  void  BenchCtlTask (void  *p_arg)
+{
+    INT16U  i;
+
+
+    (void)p_arg;
+    for (i = 0u; i < (INT16U)(sizeof(BenchChunkTbl) / sizeof(BenchChunkTbl[0])); i++) {
+        printf("%4u bytes per chunk: %7.1f ns through the pipe, %7.1f ns through the queue, per byte\n",
+               (unsigned)BenchChunkTbl[i],
+               BenchPipeRW(BenchChunkTbl[i]),
+               BenchQRW(BenchChunkTbl[i]));
+    }
+    exit(0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         THROUGH THE PIPE
+*
+* Description: Writes and reads the bytes one chunk per call.
+*
+* Arguments  : chunk         is the number of bytes written before they are read.
+*
+* Returns    : The average time per byte, in ns.
+*********************************************************************************************************
+*/
+
+static  double  BenchPipeRW (INT16U  chunk)
+{
+    INT32U  n;
+    INT8U   err;
+    INT32U  ts;
+
+
+    ts = OS_CPU_TS_GET();
+    for (n = 0u; n < BENCH_N_BYTE; n += chunk) {
+        (void)OSPipeWrite(BenchPipe, (void *)&BenchTxBuf[0], chunk, 0u, &err);
+        (void)OSPipeRead(BenchPipe, (void *)&BenchRxBuf[0], chunk, 0u, 0u, &err);
+    }
+    ts = OS_CPU_TS_GET() - ts;
+    return ((double)ts / (double)BENCH_N_BYTE);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         THROUGH THE QUEUE
+*
+* Description: Posts and receives the bytes one message per byte.
+*
+* Arguments  : chunk         is the number of bytes posted before they are received.
+*
+* Returns    : The average time per byte, in ns.
+*********************************************************************************************************
+*/
+
+static  double  BenchQRW (INT16U  chunk)
+{
+    INT32U   n;
+    INT16U   i;
+    INT8U    err;
+    INT8U   *ptx;
+    INT8U   *prx;
+    INT32U   ts;
+
+
+    ts = OS_CPU_TS_GET();
+    for (n = 0u; n < BENCH_N_BYTE; n += chunk) {
+        ptx = (INT8U *)&BenchTxBuf[0];
+        prx = (INT8U *)&BenchRxBuf[0];
+        for (i = 0u; i < chunk; i++) {
+            (void)OSQPost(BenchQ, (void *)ptx++);
+        }
+        for (i = 0u; i < chunk; i++) {
+            *prx++ = *(INT8U *)OSQAccept(BenchQ, &err);
+        }
+    }
+    ts = OS_CPU_TS_GET() - ts;
+    return ((double)ts / (double)BENCH_N_BYTE);
+}
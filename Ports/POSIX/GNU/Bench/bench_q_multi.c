@@ -0,0 +1,196 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-II
+*                                        The Real-Time Kernel
+*
+*                    Copyright 1992-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*
+*                                     QUEUE BATCH THROUGHPUT BENCHMARK
+*
+* Filename : bench_q_multi.c
+* Version  : V2.93.01
+*********************************************************************************************************
+* Note(s) : (1) This program compares the cost per message of moving messages through a queue one at a
+*               time (OSQPost() and OSQAccept()) and in batches (OSQPostMulti() and OSQPendMulti()).  It
+*               is built from this directory:
+*
+*                   cc -O2 -I. -I.. -I../../../../Source -I../../../../Cfg/Template -o bench_q_multi \
+*                      bench_q_multi.c ../os_cpu_c.c ../../../../Source/ucos_ii.c                    \
+*                      ../../../../Cfg/Template/app_hooks.c -pthread
+*
+*           (2) The benchmark task posts a batch and then receives it, the queue is thus never waited on
+*               and the figures only include the transfers themselves.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <ucos_ii.h>
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  BENCH_N_MSG                  640000u   /* Nbr of messages moved per measurement               */
+#define  BENCH_Q_SIZE                     64u   /* Largest batch                                       */
+
+#define  BENCH_PRIO_CTL                   10u
+
+#define  BENCH_STK_SIZE                 4096u
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL TABLES
+*********************************************************************************************************
+*/
+
+static  const  INT16U  BenchBatchTbl[] = {1u, 4u, 16u, BENCH_Q_SIZE};
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_STK     BenchCtlStk[BENCH_STK_SIZE];
+
+static  void      *BenchQTbl[BENCH_Q_SIZE];
+static  void      *BenchMsgTbl[BENCH_Q_SIZE];
+static  void      *BenchRxTbl[BENCH_Q_SIZE];
+
+static  OS_EVENT  *BenchQ;
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void    BenchCtlTask(void    *p_arg);
+static  double  BenchSingle (INT16U   batch);
+static  double  BenchMulti  (INT16U   batch);
+
+
+/*
+*********************************************************************************************************
+*                                                main()
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    OSInit();
+    BenchQ = OSQCreate(&BenchQTbl[0], BENCH_Q_SIZE);
+    (void)OSTaskCreate(BenchCtlTask, (void *)0, &BenchCtlStk[BENCH_STK_SIZE - 1u], BENCH_PRIO_CTL);
+    OSStart();
+    return (0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           BENCHMARK TASK
+*
+* Description: Measures both ways of moving messages for each batch size.
+*********************************************************************************************************
+*/
+
+static  void  BenchCtlTask (void  *p_arg)
+{
+    INT16U  i;
+
+
+    (void)p_arg;
+    for (i = 0u; i < BENCH_Q_SIZE; i++) {
+        BenchMsgTbl[i] = (void *)&BenchMsgTbl[i];
+    }
+    for (i = 0u; i < (INT16U)(sizeof(BenchBatchTbl) / sizeof(BenchBatchTbl[0])); i++) {
+        printf("%2u messages per batch: %7.1f ns one by one, %7.1f ns in batches, per message\n",
+               (unsigned)BenchBatchTbl[i],
+               BenchSingle(BenchBatchTbl[i]),
+               BenchMulti(BenchBatchTbl[i]));
+    }
+    exit(0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      ONE MESSAGE AT A TIME
+*
+* Description: Posts and receives the messages one call per message.
+*
+* Arguments  : batch         is the number of messages posted before they are received.
+*
+* Returns    : The average time per message, in ns.
+*********************************************************************************************************
+*/
+
+static  double  BenchSingle (INT16U  batch)
+{
+    INT32U  n;
+    INT16U  i;
+    INT8U   err;
+    INT32U  ts;
+
+
+    ts = OS_CPU_TS_GET();
+    for (n = 0u; n < BENCH_N_MSG; n += batch) {
+        for (i = 0u; i < batch; i++) {
+            (void)OSQPost(BenchQ, BenchMsgTbl[i]);
+        }
+        for (i = 0u; i < batch; i++) {
+            BenchRxTbl[i] = OSQAccept(BenchQ, &err);
+        }
+    }
+    ts = OS_CPU_TS_GET() - ts;
+    return ((double)ts / (double)BENCH_N_MSG);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        BATCHES OF MESSAGES
+*
+* Description: Posts and receives the messages with one call per batch.
+*
+* Arguments  : batch         is the number of messages per call.
+*
+* Returns    : The average time per message, in ns.
+*********************************************************************************************************
+*/
+
+static  double  BenchMulti (INT16U  batch)
+{
+    INT32U  n;
+    INT8U   err;
+    INT32U  ts;
+
+
+    ts = OS_CPU_TS_GET();
+    for (n = 0u; n < BENCH_N_MSG; n += batch) {
+        (void)OSQPostMulti(BenchQ, &BenchMsgTbl[0], batch, OS_POST_OPT_NONE, &err);
+        (void)OSQPendMulti(BenchQ, &BenchRxTbl[0], batch, 0u, &err);
+    }
+    ts = OS_CPU_TS_GET() - ts;
+    return ((double)ts / (double)BENCH_N_MSG);
+}
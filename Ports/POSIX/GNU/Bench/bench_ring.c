@@ -0,0 +1,249 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-II
+*                                        The Real-Time Kernel
+*
+*                    Copyright 1992-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*
+*                                    RING BUFFER THROUGHPUT BENCHMARK
+*
+* Filename : bench_ring.c
+* Version  : V2.93.01
+*********************************************************************************************************
+* Note(s) : (1) This program measures the cost per byte of the producer side of a ring buffer, called
+*               from an emulated ISR (OSRingPut() one byte at a time, or OSRingWrite() once per chunk),
+*               and of the consumer side, called from a task (OSRingRead()).  It is built from this
+*               directory:
+*
+*                   cc -O2 -I. -I.. -I../../../../Source -I../../../../Cfg/Template -o bench_ring \
+*                      bench_ring.c ../os_cpu_c.c ../../../../Source/ucos_ii.c                    \
+*                      ../../../../Cfg/Template/app_hooks.c -pthread
+*
+*               bench_pipe.c gives the cost per byte of a queue, one byte per message, for comparison.
+*
+*           (2) The ISR is emulated by the benchmark task: OSIntEnter(), the writes and OSIntExit() are
+*               called with interrupts disabled, as they would be by an interrupt handler.  The task then
+*               reads the chunk back with a threshold of 0.  The ring is thus never waited on and the
+*               figures only include the transfers themselves.
+*
+*           (3) The time is taken around the writes and around the read of each chunk, with
+*               OS_CPU_TS_GET().  The figures for small chunks include the cost of OS_CPU_TS_GET().
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <ucos_ii.h>
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  BENCH_N_BYTE                 800000u   /* Nbr of bytes moved per measurement                  */
+#define  BENCH_CHUNK_MAX                1000u   /* Largest chunk                                       */
+
+#define  BENCH_PRIO_CTL                   10u
+
+#define  BENCH_STK_SIZE                 4096u
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL TABLES
+*********************************************************************************************************
+*/
+
+static  const  INT16U  BenchChunkTbl[] = {1u, 16u, 200u, BENCH_CHUNK_MAX};
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_STK     BenchCtlStk[BENCH_STK_SIZE];
+
+static  INT8U      BenchRingBuf[BENCH_CHUNK_MAX + 1u];                      /* One entry left empty  */
+
+static  INT8U      BenchTxBuf[BENCH_CHUNK_MAX];
+static  INT8U      BenchRxBuf[BENCH_CHUNK_MAX];
+
+static  OS_EVENT  *BenchRing;
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void    BenchCtlTask(void     *p_arg);
+static  double  BenchRingRW (INT16U    chunk,
+                             BOOLEAN   put,
+                             double   *pread);
+static  INT32U  BenchIntPut (INT16U    chunk);
+static  INT32U  BenchIntWr  (INT16U    chunk);
+
+
+/*
+*********************************************************************************************************
+*                                                main()
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    OSInit();
+    BenchRing = OSRingCreate(&BenchRingBuf[0], (INT16U)sizeof(BenchRingBuf));
+    (void)OSTaskCreate(BenchCtlTask, (void *)0, &BenchCtlStk[BENCH_STK_SIZE - 1u], BENCH_PRIO_CTL);
+    OSStart();
+    return (0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           BENCHMARK TASK
+*
+* Description: Measures both producer services, and the consumer, for each chunk size.  The read figure
+*              is the average over both runs.
+*********************************************************************************************************
+*/
+
+static  void  BenchCtlTask (void  *p_arg)
+{
+    INT16U  i;
+    double  ts_put;
+    double  ts_wr;
+    double  ts_rd;
+
+
+    (void)p_arg;
+    for (i = 0u; i < (INT16U)(sizeof(BenchChunkTbl) / sizeof(BenchChunkTbl[0])); i++) {
+        ts_rd  = 0.0;
+        ts_put = BenchRingRW(BenchChunkTbl[i], OS_TRUE,  &ts_rd);
+        ts_wr  = BenchRingRW(BenchChunkTbl[i], OS_FALSE, &ts_rd);
+        printf("%4u bytes per chunk, per byte: %5.1f ns OSRingPut(), %5.1f ns OSRingWrite(), "
+               "%5.1f ns OSRingRead()\n",
+               (unsigned)BenchChunkTbl[i],
+               ts_put,
+               ts_wr,
+               ts_rd / 2.0);
+    }
+    exit(0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      THROUGH THE RING BUFFER
+*
+* Description: Writes the bytes one chunk per emulated ISR and reads each chunk back from the task.
+*
+* Arguments  : chunk         is the number of bytes written before they are read.
+*
+*              put           selects OSRingPut() (OS_TRUE) or OSRingWrite() (OS_FALSE) for the writes.
+*
+*              pread         is a pointer to where the average time per byte of the reads is added.
+*
+* Returns    : The average time per byte of the writes, in ns.
+*********************************************************************************************************
+*/
+
+static  double  BenchRingRW (INT16U    chunk,
+                             BOOLEAN   put,
+                             double   *pread)
+{
+    INT32U  n;
+    INT8U   err;
+    INT32U  ts;
+    INT32U  ts_wr;
+    INT32U  ts_rd;
+
+
+    ts_wr = 0u;
+    ts_rd = 0u;
+    for (n = 0u; n < BENCH_N_BYTE; n += chunk) {
+        if (put == OS_TRUE) {
+            ts_wr += BenchIntPut(chunk);
+        } else {
+            ts_wr += BenchIntWr(chunk);
+        }
+        ts     = OS_CPU_TS_GET();
+        (void)OSRingRead(BenchRing, &BenchRxBuf[0], chunk, 0u, 0u, &err);
+        ts_rd += OS_CPU_TS_GET() - ts;
+    }
+    *pread += (double)ts_rd / (double)BENCH_N_BYTE;
+    return ((double)ts_wr / (double)BENCH_N_BYTE);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            EMULATED ISRs
+*
+* Description: Write a chunk to the ring buffer from an emulated ISR (see Note #2), one byte at a time
+*              with OSRingPut() or all at once with OSRingWrite().
+*
+* Arguments  : chunk         is the number of bytes to write.
+*
+* Returns    : The duration of the writes, in OS_CPU_TS_GET() units (ns on the POSIX port).
+*********************************************************************************************************
+*/
+
+static  INT32U  BenchIntPut (INT16U  chunk)
+{
+    INT16U     i;
+    INT32U     ts;
+#if OS_CRITICAL_METHOD == 3u                                    /* Storage for CPU status register    */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+    OS_ENTER_CRITICAL();
+    OSIntEnter();
+    ts = OS_CPU_TS_GET();
+    for (i = 0u; i < chunk; i++) {
+        (void)OSRingPut(BenchRing, BenchTxBuf[i]);
+    }
+    ts = OS_CPU_TS_GET() - ts;
+    OSIntExit();
+    OS_EXIT_CRITICAL();
+    return (ts);
+}
+
+
+static  INT32U  BenchIntWr (INT16U  chunk)
+{
+    INT32U     ts;
+#if OS_CRITICAL_METHOD == 3u                                    /* Storage for CPU status register    */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+    OS_ENTER_CRITICAL();
+    OSIntEnter();
+    ts = OS_CPU_TS_GET();
+    (void)OSRingWrite(BenchRing, &BenchTxBuf[0], chunk);
+    ts = OS_CPU_TS_GET() - ts;
+    OSIntExit();
+    OS_EXIT_CRITICAL();
+    return (ts);
+}
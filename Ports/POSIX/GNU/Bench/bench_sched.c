@@ -0,0 +1,153 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-II
+*                                        The Real-Time Kernel
+*
+*                    Copyright 1992-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*
+*                                 HIGHEST PRIORITY LOOKUP BENCHMARK
+*
+* Filename : bench_sched.c
+* Version  : V2.93.01
+*********************************************************************************************************
+* Note(s) : (1) This program measures the lookup of the highest priority set in a priority bitmap, as
+*               done by OS_SchedNew() on the ready list and by OS_EventTaskRdy() on the wait list of an
+*               event.  It is built from this directory with and without the count trailing zeros hook of
+*               the port (OS_CPU_CNT_TRAIL_ZEROS()), for 64 and for 256 priorities:
+*
+*                   cc -O2 -I. -I.. -I../../../../Source -I../../../../Cfg/Template -o bench_sched \
+*                      bench_sched.c ../os_cpu_c.c ../../../../Source/ucos_ii.c                    \
+*                      ../../../../Cfg/Template/app_hooks.c -pthread
+*
+*                   cc -DBENCH_CNT_TRAIL_ZEROS=0 ... (same arguments)
+*                   cc -DBENCH_LOWEST_PRIO=254u ... (same arguments)
+*                   cc -DBENCH_CNT_TRAIL_ZEROS=0 -DBENCH_LOWEST_PRIO=254u ... (same arguments)
+*
+*           (2) The lookup is timed through OS_EventWaitPrioGet() on wait lists filled with random
+*               priorities, one per wait list so that the highest one falls anywhere in the bitmap.
+*               OS_SchedNew() can't be timed alone: the critical sections of the POSIX port around it
+*               cost far more than the lookup itself.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <ucos_ii.h>
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  BENCH_N_EVENT                  1024u   /* Nbr of wait lists looked up in turn                 */
+#define  BENCH_N_PRIO                      1u   /* Nbr of random priorities set in each wait list      */
+#define  BENCH_N_ROUND                  2000u   /* Nbr of passes over the wait lists                   */
+
+#define  BENCH_PRIO_CTL                   10u
+
+#define  BENCH_STK_SIZE                 4096u
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_STK            BenchCtlStk[BENCH_STK_SIZE];
+
+static  OS_EVENT          BenchEventTbl[BENCH_N_EVENT];   /* Only the wait lists are used             */
+
+static  volatile  INT32U  BenchSum;                       /* Keeps the lookups from being optimized   */
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  BenchCtlTask(void  *p_arg);
+
+
+/*
+*********************************************************************************************************
+*                                                main()
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    OSInit();
+    (void)OSTaskCreate(BenchCtlTask, (void *)0, &BenchCtlStk[BENCH_STK_SIZE - 1u], BENCH_PRIO_CTL);
+    OSStart();
+    return (0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           BENCHMARK TASK
+*
+* Description: Fills the wait lists with random priorities and measures the average time of a lookup.
+*********************************************************************************************************
+*/
+
+static  void  BenchCtlTask (void  *p_arg)
+{
+    OS_EVENT  *pevent;
+    INT32U     round;
+    INT32U     sum;
+    INT32U     ts;
+    INT16U     i;
+    INT8U      n;
+    INT8U      prio;
+
+
+    (void)p_arg;
+    srand(1u);
+    for (i = 0u; i < BENCH_N_EVENT; i++) {
+        pevent = &BenchEventTbl[i];
+        for (n = 0u; n < BENCH_N_PRIO; n++) {
+            prio = (INT8U)((unsigned)rand() % (OS_LOWEST_PRIO + 1u));
+#if OS_LOWEST_PRIO <= 63u
+            pevent->OSEventGrp                |= (OS_PRIO)(1u << (prio >> 3u));
+            pevent->OSEventTbl[prio >> 3u]    |= (OS_PRIO)(1u << (prio & 0x07u));
+#else
+            pevent->OSEventGrp                |= (OS_PRIO)(1u << (prio >> 4u));
+            pevent->OSEventTbl[prio >> 4u]    |= (OS_PRIO)(1u << (prio & 0x0Fu));
+#endif
+        }
+    }
+    sum = 0u;
+    ts  = OS_CPU_TS_GET();
+    for (round = 0u; round < BENCH_N_ROUND; round++) {
+        for (i = 0u; i < BENCH_N_EVENT; i++) {
+            sum += OS_EventWaitPrioGet(&BenchEventTbl[i]);
+        }
+    }
+    ts       = OS_CPU_TS_GET() - ts;
+    BenchSum = sum;
+#if defined(OS_CPU_CNT_TRAIL_ZEROS)
+    printf("OS_LOWEST_PRIO = %3u, OS_CPU_CNT_TRAIL_ZEROS(): ",  (unsigned)OS_LOWEST_PRIO);
+#else
+    printf("OS_LOWEST_PRIO = %3u, OSUnMapTbl[]:             ",  (unsigned)OS_LOWEST_PRIO);
+#endif
+    printf("%5.2f ns per lookup\n", (double)ts / ((double)BENCH_N_ROUND * (double)BENCH_N_EVENT));
+    exit(0);
+}
@@ -0,0 +1,167 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-II
+*                                        The Real-Time Kernel
+*
+*                    Copyright 1992-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*
+*                                        TIMER WHEEL BENCHMARK
+*
+* Filename : bench_tmr.c
+* Version  : V2.93.01
+*********************************************************************************************************
+* Note(s) : (1) This program measures the cost of one tick of the timer task while more and more timers
+*               are armed, far from their expiry.  It is built from this directory, once for each number
+*               of levels of the timer wheel (OS_TMR_CFG_WHEEL_LVLS) to compare:
+*
+*                   cc -O2 -DBENCH_TMR_WHEEL_LVLS=1 -I. -I.. -I../../../../Source            \
+*                      -I../../../../Cfg/Template -o bench_tmr bench_tmr.c ../os_cpu_c.c   \
+*                      ../../../../Source/ucos_ii.c ../../../../Cfg/Template/app_hooks.c -pthread
+*
+*                   cc -O2 -DBENCH_TMR_WHEEL_LVLS=3 ... (same arguments)
+*
+*           (2) The benchmark task runs below the timer task and signals it with OSTmrSignal().  Each
+*               signal thus includes the two context switches to and from the timer task.  The first line
+*               (no timer armed) gives this fixed cost.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <ucos_ii.h>
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  BENCH_N_TICK                  20000u   /* Nbr of timer ticks measured per step                */
+#define  BENCH_TMR_DLY               1000000u   /* Far beyond the ticks run by the whole benchmark     */
+
+#define  BENCH_PRIO_CTL       (OS_LOWEST_PRIO - 1u)   /* Below the timer task, see Note #2             */
+
+#define  BENCH_STK_SIZE                 4096u
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL TABLES
+*********************************************************************************************************
+*/
+
+static  const  INT16U  BenchNTmrTbl[] = {0u, 2000u, 20000u, OS_TMR_CFG_MAX};
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_STK  BenchCtlStk[BENCH_STK_SIZE];
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  BenchCtlTask(void  *p_arg);
+static  void  BenchTmrCb  (void  *ptmr, void  *parg);
+
+
+/*
+*********************************************************************************************************
+*                                                main()
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    OSInit();
+    (void)OSTaskCreate(BenchCtlTask, (void *)0, &BenchCtlStk[BENCH_STK_SIZE - 1u], BENCH_PRIO_CTL);
+    OSStart();
+    return (0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           BENCHMARK TASK
+*
+* Description: Arms timers step by step and measures the average time of a timer tick for each step.
+*********************************************************************************************************
+*/
+
+static  void  BenchCtlTask (void  *p_arg)
+{
+    OS_TMR  *ptmr;
+    INT8U    err;
+    INT8U    i;
+    INT16U   n_tmr;
+    INT32U   tick;
+    INT32U   ts;
+    double   ts_tot;
+
+
+    (void)p_arg;
+    printf("OS_TMR_CFG_WHEEL_LVLS = %u, OS_TMR_CFG_WHEEL_SIZE = %u\n",
+           (unsigned)OS_TMR_CFG_WHEEL_LVLS,
+           (unsigned)OS_TMR_CFG_WHEEL_SIZE);
+    n_tmr = 0u;
+    for (i = 0u; i < (INT8U)(sizeof(BenchNTmrTbl) / sizeof(BenchNTmrTbl[0])); i++) {
+        while (n_tmr < BenchNTmrTbl[i]) {
+            ptmr = OSTmrCreate(BENCH_TMR_DLY + n_tmr,
+                               0u,
+                               OS_TMR_OPT_ONE_SHOT,
+                               BenchTmrCb,
+                               (void *)0,
+                               (INT8U *)"Bench",
+                               &err);
+            (void)OSTmrStart(ptmr, &err);
+            n_tmr++;
+        }
+        ts_tot = 0.0;
+        for (tick = 0u; tick < BENCH_N_TICK; tick++) {
+            ts      = OS_CPU_TS_GET();
+            (void)OSTmrSignal();                                /* Timer task runs, see Note #2       */
+            ts_tot += (double)(OS_CPU_TS_GET() - ts);
+        }
+        printf("%5u timers armed: %7.2f us per timer tick\n",
+               (unsigned)n_tmr,
+               ts_tot / (double)BENCH_N_TICK / 1000.0);
+    }
+    exit(0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          TIMER CALLBACK
+*
+* Description: Never called, the timers do not expire while the benchmark runs.
+*********************************************************************************************************
+*/
+
+static  void  BenchTmrCb (void  *ptmr,
+                          void  *parg)
+{
+    (void)ptmr;
+    (void)parg;
+}
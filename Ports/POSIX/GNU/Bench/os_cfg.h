@@ -0,0 +1,94 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-II
+*                                        The Real-Time Kernel
+*
+*                    Copyright 1992-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*
+*                              uC/OS-II Configuration File for the POSIX Benchmarks
+*
+* Filename : os_cfg.h
+* Version  : V2.93.01
+*********************************************************************************************************
+* Note(s) : (1) The benchmarks use the template configuration (Cfg/Template/os_cfg.h) with the options
+*               below changed.  This directory MUST be searched before Cfg/Template for 'os_cfg.h'.
+*
+*           (2) The BENCH_xxx constants select the configuration being measured.  They default to the
+*               value of the template, or of the port for those of os_cpu.h, and can be #define'd on the
+*               command line, e.g.:
+*
+*                   cc -DBENCH_ISR_POST_DEFERRED=1 ...
+*
+*           (3) The timer pool is larger than 64K bytes.  The debug constants of os_dbg_r.c hold sizes on
+*               16 bits and are thus disabled: os_dbg_r.c is not part of the benchmarks.
+*********************************************************************************************************
+*/
+
+#ifndef  BENCH_OS_CFG_H
+#define  BENCH_OS_CFG_H
+
+#include  "../../../../Cfg/Template/os_cfg.h"
+
+
+/*
+*********************************************************************************************************
+*                                   OPTIONS CHANGED FROM THE TEMPLATE
+*********************************************************************************************************
+*/
+
+#undef   OS_MAX_TASKS
+#define  OS_MAX_TASKS                     60u   /* Room for the waiting tasks of the benchmarks        */
+#undef   OS_TASK_STAT_EN
+#define  OS_TASK_STAT_EN                   0u   /* Priority below the timer task used by benchmarks    */
+
+#undef   OS_Q_MULTI_EN
+#define  OS_Q_MULTI_EN                     1u   /* Used by bench_q_multi.c                             */
+
+#undef   OS_PIPE_EN
+#define  OS_PIPE_EN                        1u   /* Used by bench_pipe.c                                */
+
+#undef   OS_RING_EN
+#define  OS_RING_EN                        1u   /* Used by bench_ring.c                                */
+
+#undef   OS_DEBUG_EN
+#define  OS_DEBUG_EN                       0u   /* os_dbg_r.c sizes are INT16U, see Note #3           */
+
+#undef   OS_TMR_CFG_MAX
+#define  OS_TMR_CFG_MAX                60000u   /* Pool for the timer wheel benchmark                  */
+
+
+/*
+*********************************************************************************************************
+*                                 CONFIGURATION BEING MEASURED (see Note #2)
+*********************************************************************************************************
+*/
+
+#ifdef   BENCH_ISR_POST_DEFERRED
+#undef   OS_ISR_POST_DEFERRED_EN
+#define  OS_ISR_POST_DEFERRED_EN          BENCH_ISR_POST_DEFERRED
+#endif
+
+#ifdef   BENCH_LOWEST_PRIO
+#undef   OS_LOWEST_PRIO
+#define  OS_LOWEST_PRIO                   BENCH_LOWEST_PRIO
+#endif
+
+#ifdef   BENCH_TMR_WHEEL_LVLS
+#undef   OS_TMR_CFG_WHEEL_LVLS
+#define  OS_TMR_CFG_WHEEL_LVLS            BENCH_TMR_WHEEL_LVLS
+#endif
+
+#endif
@@ -0,0 +1,49 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-II
+*                                        The Real-Time Kernel
+*
+*                    Copyright 1992-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*
+*                                uC/OS-II CPU Port File for the POSIX Benchmarks
+*
+* Filename : os_cpu.h
+* Version  : V2.93.01
+*********************************************************************************************************
+* Note(s) : (1) The benchmarks use the POSIX port (../os_cpu.h) with the options below changed.  This
+*               directory MUST be searched before the port directory for 'os_cpu.h'.
+*
+*           (2) See os_cfg.h Note #2 for the BENCH_xxx constants.
+*********************************************************************************************************
+*/
+
+#ifndef  BENCH_OS_CPU_H
+#define  BENCH_OS_CPU_H
+
+#include  "../os_cpu.h"
+
+
+/*
+*********************************************************************************************************
+*                                 CONFIGURATION BEING MEASURED (see Note #2)
+*********************************************************************************************************
+*/
+
+#if defined(BENCH_CNT_TRAIL_ZEROS) && (BENCH_CNT_TRAIL_ZEROS == 0)
+#undef   OS_CPU_CNT_TRAIL_ZEROS                 /* Fall back on OSUnMapTbl[]                           */
+#endif
+
+#endif
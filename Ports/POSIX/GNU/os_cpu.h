@@ -0,0 +1,172 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-II
+*                                        The Real-Time Kernel
+*
+*                    Copyright 1992-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX Specific code
+*
+* Filename  : os_cpu.h
+* Version   : V2.93.01
+*********************************************************************************************************
+* For       : POSIX hosts (Linux, *BSD, ...)
+* Toolchain : GNU C Compiler
+*********************************************************************************************************
+* Note(s)   : (1) Every uC/OS-II task runs on its own POSIX thread.  Only the thread of 'OSTCBCur' is ever
+*                 allowed to run; the others are blocked on a private semaphore until they are switched in.
+*
+*             (2) The tick interrupt is emulated with a periodic SIGALRM.  'Disabling interrupts' blocks
+*                 SIGALRM in the calling thread.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CPU_H
+#define  OS_CPU_H
+
+#ifdef   OS_CPU_GLOBALS
+#define  OS_CPU_EXT
+#else
+#define  OS_CPU_EXT  extern
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     EXTERNAL C LANGUAGE LINKAGE
+*
+* Note(s) : (1) C++ compilers MUST 'extern'ally declare ALL C function prototypes & variable/object
+*               declarations for correct C language linkage.
+*********************************************************************************************************
+*/
+
+#ifdef __cplusplus
+extern  "C" {                                    /* See Note #1.                                       */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                              DATA TYPES
+*                                         (Compiler Specific)
+*********************************************************************************************************
+*/
+
+typedef  unsigned  char        BOOLEAN;          /* Unsigned  8 bit boolean or logical                 */
+typedef  unsigned  char        INT8U;            /* Unsigned  8 bit quantity                           */
+typedef  signed    char        INT8S;            /* Signed    8 bit quantity                           */
+typedef  unsigned  short       INT16U;           /* Unsigned 16 bit quantity                           */
+typedef  signed    short       INT16S;           /* Signed   16 bit quantity                           */
+typedef  unsigned  int         INT32U;           /* Unsigned 32 bit quantity                           */
+typedef  signed    int         INT32S;           /* Signed   32 bit quantity                           */
+typedef  unsigned  long  long  INT64U;           /* 64-bit unsigned integer                            */
+typedef  signed    long  long  INT64S;           /* 64-bit   signed integer                            */
+typedef  float                 FP32;             /* Single precision floating point                    */
+typedef  double                FP64;             /* Double precision floating point                    */
+
+typedef  unsigned  int         OS_STK;           /* Each stack entry is 32-bit wide                    */
+typedef  unsigned  int         OS_CPU_SR;        /* Previous 'interrupt' (i.e. signal) mask state      */
+
+
+/*
+*********************************************************************************************************
+*                                               POSIX
+*                                      Critical Section Management
+*
+* Method #3:  Disable/Enable interrupts by preserving the state of interrupts.  OS_CPU_SR_Save() blocks
+*             the tick signal in the calling thread and returns whether it was already blocked.
+*             OS_CPU_SR_Restore() only unblocks the signal if it was unblocked on entry, which allows
+*             critical sections to nest.
+*
+*             When OS_INT_DIS_MEAS_EN is set to 1, the time spent with the signal blocked is measured by
+*             uC/OS-II (see OS_IntDisMeasStart() and OS_IntDisMeasStop()).
+*********************************************************************************************************
+*/
+
+#define  OS_CRITICAL_METHOD   3u
+
+#if OS_CRITICAL_METHOD == 3u
+#if OS_INT_DIS_MEAS_EN > 0u
+#define  OS_ENTER_CRITICAL()  do { cpu_sr = OS_CPU_SR_Save(); OS_IntDisMeasStart();} while (0)
+#define  OS_EXIT_CRITICAL()   do { OS_IntDisMeasStop(); OS_CPU_SR_Restore(cpu_sr);} while (0)
+#else
+#define  OS_ENTER_CRITICAL()  do { cpu_sr = OS_CPU_SR_Save();} while (0)
+#define  OS_EXIT_CRITICAL()   do { OS_CPU_SR_Restore(cpu_sr);} while (0)
+#endif
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         POSIX Miscellaneous
+*********************************************************************************************************
+*/
+
+#define  OS_STK_GROWTH        1u                  /* Stack grows from HIGH to LOW memory               */
+
+#define  OS_TASK_SW()         OSCtxSw()
+
+                                                  /* Index of the lowest bit set                       */
+#define  OS_CPU_CNT_TRAIL_ZEROS(val)  ((INT32U)__builtin_ctz((unsigned int)(val)))
+
+                                                  /* Compare-and-swap, OS_TRUE if swapped              */
+#define  OS_CPU_CAS16(p, o, n)        ((BOOLEAN)__atomic_compare_exchange_n((p), &(INT16U){(o)}, (n), \
+                                          0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+#define  OS_CPU_CAS_PTR(p, o, n)      ((BOOLEAN)__atomic_compare_exchange_n((p), &(void *){(o)}, (n), \
+                                          0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+
+                                                  /* Free running timestamp, in nanoseconds            */
+#define  OS_CPU_TS_GET()      OS_CPU_TS_Get()
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+#if OS_CRITICAL_METHOD == 3u
+OS_CPU_SR  OS_CPU_SR_Save   (void);
+void       OS_CPU_SR_Restore(OS_CPU_SR  cpu_sr);
+#endif
+
+void       OSCtxSw          (void);
+void       OSIntCtxSw       (void);
+void       OSStartHighRdy   (void);
+
+void       OS_CPU_SysTickHandler(void);
+
+INT32U     OS_CPU_TS_Get    (void);
+
+
+/*
+*********************************************************************************************************
+*                                   EXTERNAL C LANGUAGE LINKAGE END
+*********************************************************************************************************
+*/
+
+#ifdef __cplusplus
+}                                                 /* End of 'extern'al C lang linkage.                 */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif
@@ -0,0 +1,927 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-II
+*                                        The Real-Time Kernel
+*
+*                    Copyright 1992-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX Specific code
+*
+* Filename  : os_cpu_c.c
+* Version   : V2.93.01
+*********************************************************************************************************
+* For       : POSIX hosts (Linux, *BSD, ...)
+* Toolchain : GNU C Compiler
+*********************************************************************************************************
+* Note(s)   : (1) Each task is backed by a POSIX thread which owns a private semaphore (the 'baton').  A
+*                 context switch posts the semaphore of the task being switched in, then blocks the
+*                 calling thread on its own semaphore.
+*
+*             (2) The tick is a periodic process-directed SIGALRM (see setitimer()).  Since every thread but
+*                 the one of the running task keeps SIGALRM blocked, the signal is always delivered to the
+*                 running task, exactly like a hardware interrupt would preempt it.  The signal handler
+*                 calls OS_CPU_SysTickHandler() which may in turn perform an interrupt level context switch.
+*
+*             (3) A task may be preempted while it is inside a C library function which is not
+*                 async-signal-safe (e.g. printf(), malloc()).  Such calls should be surrounded by
+*                 OSSchedLock()/OSSchedUnlock() or a critical section.
+*
+*             (4) Link with '-pthread'.
+*********************************************************************************************************
+*/
+
+#define  OS_CPU_GLOBALS
+
+#ifndef  _POSIX_C_SOURCE
+#define  _POSIX_C_SOURCE  200809L
+#endif
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <ucos_ii.h>
+
+#include  <errno.h>
+#include  <pthread.h>
+#include  <semaphore.h>
+#include  <signal.h>
+#include  <stdarg.h>
+#include  <stdint.h>
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <sys/time.h>
+#include  <time.h>
+#include  <unistd.h>
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  OS_CPU_TICK_SIGNAL                          SIGALRM            /* Signal used to emulate the tick interrupt.               */
+
+#define  OS_MSG_TRACE                                     1u            /* Allow print trace messages.                              */
+
+#if OS_CPU_HOOKS_EN == 0u
+#error  "OS_CFG.H, OS_CPU_HOOKS_EN must be set to 1 for the POSIX port"
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  os_task_thread {                                       /* Host thread backing a uC/OS-II task.                     */
+    pthread_t                  Thread;
+    sem_t                      Sem;                                     /* Posted when the task is switched in.                     */
+    volatile  BOOLEAN          Terminate;                               /* Task has been deleted, thread must exit.                 */
+    void                     (*Task)(void *p_arg);
+    void                      *TaskArgPtr;
+} OS_TASK_THREAD;
+
+
+typedef  struct  os_task_stk {                                          /* Frame placed at the top of the task's stack.             */
+    void                     (*Task)(void *p_arg);
+    void                      *TaskArgPtr;
+    INT16U                     TaskOpt;
+    OS_TASK_THREAD            *ThreadPtr;
+} OS_TASK_STK;
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+#if OS_TMR_EN > 0u
+static  INT16U                     OSTmrCtr;
+#endif
+
+static  __thread  OS_TASK_THREAD  *OSTaskThreadSelf;                   /* Thread backing the task running on this host thread.     */
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void   *OS_CPU_TaskThread   (void            *p_arg);
+static  void    OS_CPU_TaskWait     (OS_TASK_THREAD  *p_thread);
+static  void    OS_CPU_TaskTerminate(OS_TASK_THREAD  *p_thread);
+static  void    OS_CPU_CtxSw        (void);
+static  void    OS_CPU_SigHandler   (int              sig);
+
+#if (OS_MSG_TRACE > 0u)
+static  int     OS_Printf           (char            *p_str, ...);
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       OS INITIALIZATION HOOK
+*                                            (BEGINNING)
+*
+* Description: This function is called by OSInit() at the beginning of OSInit().
+*
+* Arguments  : none
+*
+* Note(s)    : 1) Interrupts should be disabled during this call.  The tick signal is blocked in the
+*                 calling (i.e. main()) thread and remains blocked there for the lifetime of the process.
+*********************************************************************************************************
+*/
+
+#if OS_CPU_HOOKS_EN > 0u
+void  OSInitHookBegin (void)
+{
+    struct sigaction  act;
+
+
+#if OS_TMR_EN > 0u
+    OSTmrCtr = 0u;
+#endif
+
+    (void)OS_CPU_SR_Save();                                             /* Disable 'interrupts' in main().                          */
+
+    act.sa_handler = OS_CPU_SigHandler;
+    act.sa_flags   = SA_RESTART;
+    (void)sigemptyset(&act.sa_mask);
+    (void)sigaddset(&act.sa_mask, OS_CPU_TICK_SIGNAL);
+    if (sigaction(OS_CPU_TICK_SIGNAL, &act, (struct sigaction *)0) != 0) {
+#if (OS_MSG_TRACE > 0u)
+        OS_Printf("Error: sigaction() [OSTick] failed.\n");
+#endif
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       OS INITIALIZATION HOOK
+*                                               (END)
+*
+* Description: This function is called by OSInit() at the end of OSInit().
+*
+* Arguments  : none
+*
+* Note(s)    : 1) Interrupts should be disabled during this call.
+*********************************************************************************************************
+*/
+
+#if OS_CPU_HOOKS_EN > 0u
+void  OSInitHookEnd (void)
+{
+
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          TASK CREATION HOOK
+*
+* Description: This function is called when a task is created.
+*
+* Arguments  : p_tcb   is a pointer to the task control block of the task being created.
+*
+* Note(s)    : 1) Interrupts are disabled during this call.
+*********************************************************************************************************
+*/
+
+#if OS_CPU_HOOKS_EN > 0u
+void  OSTaskCreateHook (OS_TCB  *p_tcb)
+{
+#if OS_APP_HOOKS_EN > 0u
+    App_TaskCreateHook(p_tcb);
+#else
+    (void)p_tcb;                                /* Prevent compiler warning                            */
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           TASK DELETION HOOK
+*
+* Description: This function is called when a task is deleted.
+*
+* Arguments  : p_tcb   is a pointer to the task control block of the task being deleted.
+*
+* Note(s)    : 1) Interrupts are disabled during this call.
+*
+*              2) A task deleting itself terminates its thread at the next context switch.  Any other
+*                 task is blocked on its semaphore; it is woken up so that its thread can exit.
+*********************************************************************************************************
+*/
+
+#if OS_CPU_HOOKS_EN > 0u
+void  OSTaskDelHook (OS_TCB  *p_tcb)
+{
+    OS_TASK_THREAD  *p_thread;
+
+
+#if OS_APP_HOOKS_EN > 0u
+    App_TaskDelHook(p_tcb);
+#endif
+
+    p_thread = ((OS_TASK_STK *)p_tcb->OSTCBStkPtr)->ThreadPtr;
+    if (p_thread == (OS_TASK_THREAD *)0) {                              /* Thread was never created.                                */
+        return;
+    }
+
+    p_thread->Terminate = OS_TRUE;
+    if (p_thread != OSTaskThreadSelf) {                                 /* See Note #2.                                             */
+        (void)sem_post(&p_thread->Sem);
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                             IDLE TASK HOOK
+*
+* Description: This function is called by the idle task.  This hook has been added to allow you to do
+*              such things as STOP the CPU to conserve power.
+*
+* Arguments  : none
+*
+* Note(s)    : 1) Interrupts are enabled during this call.
+*
+*              2) Only an interrupt (i.e. the tick signal) can make a task ready while the idle task runs,
+*                 the host thread is therefore suspended until the next signal.
+*********************************************************************************************************
+*/
+
+#if OS_CPU_HOOKS_EN > 0u
+void  OSTaskIdleHook (void)
+{
+#if OS_APP_HOOKS_EN > 0u
+    App_TaskIdleHook();
+#endif
+
+    (void)pause();                                                      /* See Note #2.                                             */
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        TICKLESS IDLE TASK HOOK
+*
+* Description: This function is called by the idle task, with interrupts disabled, when no task delay or
+*              timer expires for at least 'ticks' ticks.  The tick signal is postponed accordingly and the
+*              host thread is suspended until it is delivered.
+*
+* Arguments  : ticks       is the number of ticks which may be skipped.
+*
+* Returns    : The number of ticks which elapsed and were not processed by OS_CPU_SysTickHandler().
+*
+* Note(s)    : 1) The interval of the tick timer is not changed, the signal is thus periodic again after
+*                 the postponed one and the phase of the tick is preserved.
+*
+*              2) The signal is consumed with sigwait() rather than delivered to OS_CPU_SigHandler(), the
+*                 last tick is therefore accounted for in the returned value.
+*
+*              3) If the tick expired while the timer was being reprogrammed, the pending signal is left
+*                 to OS_CPU_SigHandler() and the tick timer restarted.
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_HOOKS_EN > 0u) && (OS_TICKLESS_EN > 0u)
+INT32U  OSTaskIdleTicklessHook (INT32U  ticks)
+{
+    struct  itimerval  tmr;
+    sigset_t           set;
+    sigset_t           set_pend;
+    INT64U             us;
+    int                sig;
+
+
+    (void)sigpending(&set_pend);
+    if (sigismember(&set_pend, OS_CPU_TICK_SIGNAL) == 1) {              /* A tick is already pending.                               */
+        return (0u);
+    }
+
+    (void)getitimer(ITIMER_REAL, &tmr);                                 /* Time left before the next tick.                          */
+    us                   = ((INT64U)tmr.it_value.tv_sec * 1000000u) + (INT64U)tmr.it_value.tv_usec;
+    us                  += (INT64U)(ticks - 1u) * (1000000u / OS_TICKS_PER_SEC);
+    tmr.it_value.tv_sec  = (time_t)(us / 1000000u);
+    tmr.it_value.tv_usec = (suseconds_t)(us % 1000000u);
+    (void)setitimer(ITIMER_REAL, &tmr, (struct itimerval *)0);          /* See Note #1.                                             */
+
+    (void)sigpending(&set_pend);
+    if (sigismember(&set_pend, OS_CPU_TICK_SIGNAL) == 1) {              /* See Note #3.                                             */
+        tmr.it_value = tmr.it_interval;
+        (void)setitimer(ITIMER_REAL, &tmr, (struct itimerval *)0);
+        return (0u);
+    }
+
+    (void)sigemptyset(&set);
+    (void)sigaddset(&set, OS_CPU_TICK_SIGNAL);
+    while (sigwait(&set, &sig) != 0) {                                  /* See Note #2.                                             */
+        ;
+    }
+
+    return (ticks);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            TASK RETURN HOOK
+*
+* Description: This function is called if a task accidentally returns.  In other words, a task should
+*              either be an infinite loop or delete itself when done.
+*
+* Arguments  : p_tcb      is a pointer to the task control block of the task that is returning.
+*
+* Note(s)    : none
+*********************************************************************************************************
+*/
+
+#if OS_CPU_HOOKS_EN > 0u
+void  OSTaskReturnHook (OS_TCB  *p_tcb)
+{
+#if OS_APP_HOOKS_EN > 0u
+    App_TaskReturnHook(p_tcb);
+#else
+    (void)p_tcb;                                /* Prevent compiler warning                            */
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           STATISTIC TASK HOOK
+*
+* Description: This function is called every second by uC/OS-II's statistics task.  This allows your
+*              application to add functionality to the statistics task.
+*
+* Arguments  : none
+*********************************************************************************************************
+*/
+
+#if OS_CPU_HOOKS_EN > 0u
+void  OSTaskStatHook (void)
+{
+#if OS_APP_HOOKS_EN > 0u
+    App_TaskStatHook();
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        INITIALIZE A TASK'S STACK
+*
+* Description: This function is called by either OSTaskCreate() or OSTaskCreateExt() to initialize the
+*              stack frame of the task being created.  This function is highly processor specific.
+*
+* Arguments  : task          is a pointer to the task code
+*
+*              p_arg         is a pointer to a user supplied data area that will be passed to the task
+*                            when the task first executes.
+*
+*              p_tos         is a pointer to the top of stack.  It is assumed that 'ptos' points to
+*                            the HIGHEST valid address of the stack.
+*
+*              opt           specifies options that can be used to alter the behavior of OSTaskStkInit().
+*                            (see uCOS_II.H for OS_TASK_OPT_xxx).
+*
+* Returns    : Always returns the location of the new top-of-stack.
+*
+* Note(s)    : 1) The task runs on the stack of its host thread.  Only a small OS_TASK_STK frame is stored
+*                 at the top of the uC/OS-II stack; the thread itself is created by OSTCBInitHook().
+*********************************************************************************************************
+*/
+
+OS_STK  *OSTaskStkInit (void   (*task)(void *p_arg),
+                        void    *p_arg,
+                        OS_STK  *p_tos,
+                        INT16U   opt)
+{
+    OS_TASK_STK  *p_stk;
+
+                                                                        /* Load stack pointer and align it to 16-bytes.             */
+    p_stk = (OS_TASK_STK *)(((uintptr_t)(p_tos + 1u) - sizeof(OS_TASK_STK)) & ~(uintptr_t)0xFu);
+
+    p_stk->Task       = task;
+    p_stk->TaskArgPtr = p_arg;
+    p_stk->TaskOpt    = opt;
+    p_stk->ThreadPtr  = (OS_TASK_THREAD *)0;
+
+    return ((OS_STK *)p_stk);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           TASK SWITCH HOOK
+*
+* Description: This function is called when a task switch is performed.  This allows you to perform other
+*              operations during a context switch.
+*
+* Arguments  : none
+*
+* Note(s)    : 1) Interrupts are disabled during this call.
+*              2) It is assumed that the global pointer 'OSTCBHighRdy' points to the TCB of the task that
+*                 will be 'switched in' (i.e. the highest priority task) and, 'OSTCBCur' points to the
+*                 task being switched out (i.e. the preempted task).
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_HOOKS_EN > 0u) && (OS_TASK_SW_HOOK_EN > 0u)
+void  OSTaskSwHook (void)
+{
+#if OS_APP_HOOKS_EN > 0u
+    App_TaskSwHook();
+#endif
+
+    OS_TRACE_TASK_SWITCHED_IN(OSTCBHighRdy);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           OS_TCBInit() HOOK
+*
+* Description: This function is called by OS_TCBInit() after setting up most of the TCB.
+*
+* Arguments  : p_tcb    is a pointer to the TCB of the task being created.
+*
+* Note(s)    : 1) Interrupts may or may not be ENABLED during this call.
+*
+*              2) The host thread is created with the tick signal blocked.  It waits on its semaphore until
+*                 the task is switched in for the first time.
+*********************************************************************************************************
+*/
+
+#if OS_CPU_HOOKS_EN > 0u
+void  OSTCBInitHook (OS_TCB  *p_tcb)
+{
+    OS_TASK_STK     *p_stk;
+    OS_TASK_THREAD  *p_thread;
+    pthread_attr_t   attr;
+    int              err;
+    OS_CPU_SR        cpu_sr;
+
+
+#if OS_APP_HOOKS_EN > 0u
+    App_TCBInitHook(p_tcb);
+#endif
+
+    p_stk    = (OS_TASK_STK *)p_tcb->OSTCBStkPtr;
+    p_thread = (OS_TASK_THREAD *)malloc(sizeof(OS_TASK_THREAD));
+    if (p_thread == (OS_TASK_THREAD *)0) {
+#if (OS_MSG_TRACE > 0u)
+        OS_Printf("Task[%3.1d] cannot allocate thread control block.\n", p_tcb->OSTCBPrio);
+#endif
+        return;
+    }
+
+    p_thread->Terminate  = OS_FALSE;
+    p_thread->Task       = p_stk->Task;
+    p_thread->TaskArgPtr = p_stk->TaskArgPtr;
+    if (sem_init(&p_thread->Sem, 0, 0u) != 0) {
+#if (OS_MSG_TRACE > 0u)
+        OS_Printf("Task[%3.1d] cannot allocate signal semaphore.\n", p_tcb->OSTCBPrio);
+#endif
+        free(p_thread);
+        return;
+    }
+
+    (void)pthread_attr_init(&attr);
+    (void)pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+    OS_ENTER_CRITICAL();                                                /* See Note #2.                                             */
+    err = pthread_create(&p_thread->Thread, &attr, OS_CPU_TaskThread, p_thread);
+    OS_EXIT_CRITICAL();
+
+    (void)pthread_attr_destroy(&attr);
+    if (err != 0) {
+#if (OS_MSG_TRACE > 0u)
+        OS_Printf("Task[%3.1d] failed to be created.\n", p_tcb->OSTCBPrio);
+#endif
+        (void)sem_destroy(&p_thread->Sem);
+        free(p_thread);
+        return;
+    }
+
+    p_stk->ThreadPtr = p_thread;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                               TICK HOOK
+*
+* Description: This function is called every tick.
+*
+* Arguments  : none
+*
+* Note(s)    : 1) Interrupts may or may not be ENABLED during this call.
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_HOOKS_EN > 0u) && (OS_TIME_TICK_HOOK_EN > 0u)
+void  OSTimeTickHook (void)
+{
+#if OS_APP_HOOKS_EN > 0u
+    App_TimeTickHook();
+#endif
+
+#if OS_TMR_EN > 0u
+    OSTmrCtr++;
+    if (OSTmrCtr >= (OS_TICKS_PER_SEC / OS_TMR_CFG_TICKS_PER_SEC)) {
+        OSTmrCtr = 0u;
+        OSTmrSignal();
+    }
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    CRITICAL SECTION MANAGEMENT
+*
+* Description: Disable/Enable 'interrupts' by blocking/unblocking the tick signal in the calling thread.
+*
+* Arguments  : cpu_sr      is the value returned by OS_CPU_SR_Save() (OS_CPU_SR_Restore() only).
+*
+* Returns    : 1 if the tick signal was already blocked, 0 otherwise (OS_CPU_SR_Save() only).
+*********************************************************************************************************
+*/
+
+OS_CPU_SR  OS_CPU_SR_Save (void)
+{
+    sigset_t  set;
+    sigset_t  set_prev;
+
+
+    (void)sigemptyset(&set);
+    (void)sigaddset(&set, OS_CPU_TICK_SIGNAL);
+    (void)pthread_sigmask(SIG_BLOCK, &set, &set_prev);
+
+    if (sigismember(&set_prev, OS_CPU_TICK_SIGNAL) == 1) {
+        return (1u);
+    }
+    return (0u);
+}
+
+
+void  OS_CPU_SR_Restore (OS_CPU_SR  cpu_sr)
+{
+    sigset_t  set;
+
+
+    if (cpu_sr == 0u) {
+        (void)sigemptyset(&set);
+        (void)sigaddset(&set, OS_CPU_TICK_SIGNAL);
+        (void)pthread_sigmask(SIG_UNBLOCK, &set, (sigset_t *)0);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                              START HIGHEST PRIORITY TASK READY-TO-RUN
+*
+* Description: This function is called by OSStart() to start the highest priority task that was created
+*              by your application before calling OSStart().
+*
+* Arguments  : none
+*
+* Note(s)    : 1) OSStartHighRdy() MUST:
+*                      a) Call OSTaskSwHook() then,
+*                      b) Set OSRunning to TRUE,
+*                      c) Switch to the highest priority task.
+*
+*              2) The main() thread keeps the tick signal blocked and never returns from this function.
+*
+*              3) The critical section is left by the first task in OS_CPU_TaskThread().
+*********************************************************************************************************
+*/
+
+void  OSStartHighRdy (void)
+{
+    OS_TASK_THREAD    *p_thread;
+    struct  itimerval  tmr;
+
+
+    (void)OS_CPU_SR_Save();                                             /* See Note #2.                                             */
+#if OS_INT_DIS_MEAS_EN > 0u
+    OS_IntDisMeasStart();                                               /* See Note #3.                                             */
+#endif
+
+#if OS_TASK_SW_HOOK_EN > 0u
+    OSTaskSwHook();
+#endif
+    OSRunning = OS_TRUE;
+
+    tmr.it_interval.tv_sec  = 0;                                        /* Start the tick source.                                   */
+    tmr.it_interval.tv_usec = 1000000L / OS_TICKS_PER_SEC;
+    tmr.it_value            = tmr.it_interval;
+    if (setitimer(ITIMER_REAL, &tmr, (struct itimerval *)0) != 0) {
+#if (OS_MSG_TRACE > 0u)
+        OS_Printf("Error: setitimer() [OSTick] failed.\n");
+#endif
+    }
+
+    p_thread = ((OS_TASK_STK *)OSTCBHighRdy->OSTCBStkPtr)->ThreadPtr;
+    (void)sem_post(&p_thread->Sem);
+
+    for (;;) {
+        (void)pause();
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                      TASK LEVEL CONTEXT SWITCH
+*
+* Description: This function is called when a task makes a higher priority task ready-to-run.
+*
+* Arguments  : none
+*
+* Note(s)    : 1) Upon entry,
+*                 OSTCBCur     points to the OS_TCB of the task to suspend
+*                 OSTCBHighRdy points to the OS_TCB of the task to resume
+*
+*              2) Interrupts are disabled during this call.
+*********************************************************************************************************
+*/
+
+void  OSCtxSw (void)
+{
+    OS_CPU_CtxSw();
+}
+
+
+/*
+*********************************************************************************************************
+*                                   INTERRUPT LEVEL CONTEXT SWITCH
+*
+* Description: This function is called by OSIntExit() to perform a context switch from an ISR.
+*
+* Arguments  : none
+*
+* Note(s)    : 1) The tick signal handler runs on the host thread of the interrupted task, the switch is
+*                 therefore identical to a task level one.  The interrupted task resumes from the signal
+*                 handler when it is switched back in.
+*********************************************************************************************************
+*/
+
+void  OSIntCtxSw (void)
+{
+    OS_CPU_CtxSw();
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SYS TICK HANDLER
+*
+* Description: Handle the system tick, which is used to generate the uC/OS-II tick interrupt.
+*
+* Arguments  : none
+*
+* Note(s)    : 1) Called from the tick signal handler, with the tick signal blocked.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_SysTickHandler (void)
+{
+    OSIntEnter();                                                       /* Tell uC/OS-II that we are starting an ISR                */
+
+    OSTimeTick();                                                       /* Call uC/OS-II's OSTimeTick()                             */
+
+    OSIntExit();                                                        /* Tell uC/OS-II that we are leaving the ISR                */
+}
+
+
+/*
+*********************************************************************************************************
+*                                             TIMESTAMP
+*
+* Description: Read the free running timestamp used by uC/OS-II to measure short intervals of time (see
+*              OS_CPU_TS_GET()).
+*
+* Arguments  : none
+*
+* Returns    : The monotonic clock of the host, in nanoseconds, truncated to 32 bits.
+*********************************************************************************************************
+*/
+
+INT32U  OS_CPU_TS_Get (void)
+{
+    struct  timespec  ts;
+
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((INT32U)ts.tv_sec * 1000000000u + (INT32U)ts.tv_nsec);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          OS_CPU_CtxSw()
+*
+* Description: Hand the CPU over to the task pointed to by 'OSTCBHighRdy' and block the calling thread
+*              until its own task is switched back in.
+*
+* Arguments  : none
+*
+* Note(s)    : 1) OSTCBCur may point to a TCB which was already freed by OSTaskDel(), the calling thread is
+*                 therefore identified through 'OSTaskThreadSelf' rather than through OSTCBCur.
+*********************************************************************************************************
+*/
+
+static  void  OS_CPU_CtxSw (void)
+{
+    OS_TASK_THREAD  *p_thread_cur;
+    OS_TASK_THREAD  *p_thread_new;
+
+
+#if OS_TASK_SW_HOOK_EN > 0u
+    OSTaskSwHook();
+#endif
+
+    OSTCBCur     = OSTCBHighRdy;
+    OSPrioCur    = OSPrioHighRdy;
+
+    p_thread_cur = OSTaskThreadSelf;                                    /* See Note #1.                                             */
+    p_thread_new = ((OS_TASK_STK *)OSTCBHighRdy->OSTCBStkPtr)->ThreadPtr;
+    if (p_thread_new == p_thread_cur) {
+        return;
+    }
+
+    (void)sem_post(&p_thread_new->Sem);
+
+    if (p_thread_cur->Terminate == OS_TRUE) {                           /* Current task deleted itself.                             */
+        OS_CPU_TaskTerminate(p_thread_cur);
+    }
+    OS_CPU_TaskWait(p_thread_cur);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        OS_CPU_TaskThread()
+*
+* Description: This function is the generic host thread wrapper for uC/OS-II tasks.
+*
+* Arguments  : p_arg        Pointer to the OS_TASK_THREAD of the task.
+*
+* Note(s)    : 1) Interrupts are enabled when task starts executing.  The critical section being left
+*                 was entered by the thread which switched to this task (or by OSStartHighRdy()).
+*********************************************************************************************************
+*/
+
+static  void  *OS_CPU_TaskThread (void  *p_arg)
+{
+    OS_TASK_THREAD  *p_thread;
+
+
+    p_thread         = (OS_TASK_THREAD *)p_arg;
+    OSTaskThreadSelf =  p_thread;
+
+    OS_CPU_TaskWait(p_thread);                                          /* Wait until the task is switched in.                      */
+
+#if OS_INT_DIS_MEAS_EN > 0u
+    OS_IntDisMeasStop();                                                /* See Note #1.                                             */
+#endif
+    OS_CPU_SR_Restore(0u);                                              /* See Note #1.                                             */
+
+    p_thread->Task(p_thread->TaskArgPtr);
+
+    OS_TaskReturn();                                                    /* Thread exits at OS_CPU_CtxSw().                          */
+
+    return ((void *)0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         OS_CPU_TaskWait()
+*
+* Description: Block the calling thread until its task is switched in, or terminate it if the task was
+*              deleted in the meantime.
+*
+* Arguments  : p_thread     Pointer to the OS_TASK_THREAD of the calling thread.
+*********************************************************************************************************
+*/
+
+static  void  OS_CPU_TaskWait (OS_TASK_THREAD  *p_thread)
+{
+    while (sem_wait(&p_thread->Sem) != 0) {
+        ;
+    }
+
+    if (p_thread->Terminate == OS_TRUE) {
+        OS_CPU_TaskTerminate(p_thread);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                       OS_CPU_TaskTerminate()
+*
+* Description: Release the resources of the calling thread and exit it.
+*
+* Arguments  : p_thread     Pointer to the OS_TASK_THREAD of the calling thread.
+*
+* Note(s)    : 1) This function never returns.
+*********************************************************************************************************
+*/
+
+static  void  OS_CPU_TaskTerminate (OS_TASK_THREAD  *p_thread)
+{
+    (void)sem_destroy(&p_thread->Sem);
+    free(p_thread);
+
+    pthread_exit((void *)0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         OS_CPU_SigHandler()
+*
+* Description: Tick signal handler.
+*
+* Arguments  : sig          Signal number.
+*********************************************************************************************************
+*/
+
+static  void  OS_CPU_SigHandler (int  sig)
+{
+    int  err_prev;
+
+
+    (void)sig;
+
+    err_prev = errno;                                                   /* Preserve 'errno' of the interrupted task.                */
+    OS_CPU_SysTickHandler();
+    errno    = err_prev;
+}
+
+
+/*
+*********************************************************************************************************
+*                                             OS_Printf()
+*
+* Description: This function is analog of printf.
+*
+* Arguments  : p_str        Pointer to format string output.
+*
+* Returns    : Number of characters written.
+*********************************************************************************************************
+*/
+
+#if (OS_MSG_TRACE > 0u)
+static  int  OS_Printf (char  *p_str, ...)
+{
+    va_list  param;
+    int      ret;
+
+
+    va_start(param, p_str);
+    ret = vfprintf(stderr, p_str, param);
+    va_end(param);
+
+    return (ret);
+}
+#endif
@@ -57,9 +57,28 @@ extern  "C" {                                    /* See Note #1.
 /*
 *********************************************************************************************************
 *                                               DEFINES
+*
+* Note(s) : (1) The tickless idle mode (OS_TICKLESS_EN) reprograms the machine timer compare register.
+*               OS_CPU_CFG_MTIME_CNTS_PER_TICK (number of 'mtime' counts per OS tick) MUST be #define'd
+*               in 'app_cfg.h'.  The addresses of 'mtime' and 'mtimecmp' default to the usual CLINT
+*               layout and can be overridden in 'app_cfg.h' as well.
 *********************************************************************************************************
 */
 
+#if (OS_TICKLESS_EN > 0u)
+#ifndef  OS_CPU_CFG_MTIME_CNTS_PER_TICK
+#error  "OS_CPU_CFG_MTIME_CNTS_PER_TICK not #define'd in 'app_cfg.h'    "   /* See Note # 1            */
+#endif
+
+#ifndef  OS_CPU_CFG_MTIME_ADDR
+#define  OS_CPU_CFG_MTIME_ADDR       0x0200BFF8uL         /* CLINT 'mtime'    register                     */
+#endif
+
+#ifndef  OS_CPU_CFG_MTIMECMP_ADDR
+#define  OS_CPU_CFG_MTIMECMP_ADDR    0x02004000uL         /* CLINT 'mtimecmp' register (hart 0)            */
+#endif
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -109,9 +128,14 @@ typedef  unsigned  int         OS_CPU_SR;        /* Define size of Machine statu
 #define  OS_CRITICAL_METHOD   3u
 
 #if OS_CRITICAL_METHOD == 3u
+#if OS_INT_DIS_MEAS_EN > 0u                       /* Measure the time spent in the critical section    */
+#define  OS_ENTER_CRITICAL()  do { cpu_sr = OS_CPU_SR_Save(); OS_IntDisMeasStart();} while (0)
+#define  OS_EXIT_CRITICAL()   do { OS_IntDisMeasStop(); OS_CPU_SR_Restore(cpu_sr);} while (0)
+#else
 #define  OS_ENTER_CRITICAL()  do { cpu_sr = OS_CPU_SR_Save();} while (0)
 #define  OS_EXIT_CRITICAL()   do { OS_CPU_SR_Restore(cpu_sr);} while (0)
 #endif
+#endif
 
 
 /*
@@ -124,6 +148,20 @@ typedef  unsigned  int         OS_CPU_SR;        /* Define size of Machine statu
 
 #define  OS_TASK_SW()         OSCtxSw()
 
+#if defined(__riscv_zbb)                          /* Index of the lowest bit set ('ctz', Zbb extension)*/
+#define  OS_CPU_CNT_TRAIL_ZEROS(val)  ((INT32U)__builtin_ctz((unsigned int)(val)))
+#endif
+
+#if defined(__riscv_atomic)                       /* Compare-and-swap ('lr'/'sc', A extension)         */
+#define  OS_CPU_CAS16(p, o, n)        ((BOOLEAN)__atomic_compare_exchange_n((p), &(INT16U){(o)}, (n), \
+                                          0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+#define  OS_CPU_CAS_PTR(p, o, n)      ((BOOLEAN)__atomic_compare_exchange_n((p), &(void *){(o)}, (n), \
+                                          0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+#endif
+
+                                                  /* Free running timestamp, 'mcycle' CSR              */
+#define  OS_CPU_TS_GET()      OS_CPU_TS_Get()
+
 
 /*
 *********************************************************************************************************
@@ -140,6 +178,8 @@ void       OSCtxSw          (void);
 void       OSIntCtxSw       (void);
 void       OSStartHighRdy   (void);
 
+INT32U     OS_CPU_TS_Get    (void);
+
 
 /*
 *********************************************************************************************************
@@ -40,6 +40,19 @@
 
 #include  <ucos_ii.h>
 
+/*
+*********************************************************************************************************
+*                                           LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#if OS_TICKLESS_EN > 0u
+#define  OS_CPU_MTIME_LO         (*((volatile INT32U *)(OS_CPU_CFG_MTIME_ADDR       )))
+#define  OS_CPU_MTIME_HI         (*((volatile INT32U *)(OS_CPU_CFG_MTIME_ADDR    + 4u)))
+#define  OS_CPU_MTIMECMP_LO      (*((volatile INT32U *)(OS_CPU_CFG_MTIMECMP_ADDR    )))
+#define  OS_CPU_MTIMECMP_HI      (*((volatile INT32U *)(OS_CPU_CFG_MTIMECMP_ADDR + 4u)))
+#endif
+
 /*
 *********************************************************************************************************
 *                                           LOCAL VARIABLES
@@ -51,6 +64,19 @@ static  INT16U  OSTmrCtr;
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+#if OS_TICKLESS_EN > 0u
+static  INT64U  OS_CPU_MTimeGet   (void);
+static  INT64U  OS_CPU_MTimeCmpGet(void);
+static  void    OS_CPU_MTimeCmpSet(INT64U  cmp);
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                       OS INITIALIZATION HOOK
@@ -166,6 +192,63 @@ void  OSTaskIdleHook (void)
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                        TICKLESS IDLE TASK HOOK
+*
+* Description: This function is called by the idle task when no task delay or timer expires for at least
+*              'ticks' ticks.  The machine timer compare register is moved forward by that many ticks and
+*              the hart waits for an interrupt.
+*
+* Arguments  : ticks     is the number of ticks which may be skipped.
+*
+* Returns    : The number of ticks which elapsed and are not processed by SysTick_Handler().
+*
+* Note(s)    : 1) Interrupts are disabled (mstatus.MIE cleared) during this call.  WFI still returns when
+*                 an enabled interrupt becomes pending.
+*
+*              2) If the suppressed period expired, the timer interrupt is pending and the last tick is
+*                 processed by SysTick_Handler() as soon as interrupts are re-enabled.  Otherwise, the
+*                 compare register is set back to the next regular tick.
+*
+*              3) The compare register is assumed to hold the time of the next tick on entry, as set by the
+*                 timer interrupt handler.
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_HOOKS_EN > 0u) && (OS_TICKLESS_EN > 0u)
+INT32U  OSTaskIdleTicklessHook (INT32U  ticks)
+{
+    INT64U  cmp;
+    INT64U  now;
+    INT32U  elapsed;
+
+
+    cmp = OS_CPU_MTimeCmpGet();                                 /* Time of the next tick, see Note #3.                  */
+    now = OS_CPU_MTimeGet();
+    if (now >= cmp) {                                           /* A tick is already pending, don't sleep.              */
+        return (0u);
+    }
+
+    OS_CPU_MTimeCmpSet(cmp + ((INT64U)(ticks - 1u) * OS_CPU_CFG_MTIME_CNTS_PER_TICK));
+
+    __asm__ volatile ("wfi");                                   /* See Note #1.                                         */
+
+    now = OS_CPU_MTimeGet();
+    if (now < cmp) {                                            /* Woken up before the first tick boundary.             */
+        elapsed = 0u;
+    } else {
+        elapsed = (INT32U)((now - cmp) / OS_CPU_CFG_MTIME_CNTS_PER_TICK) + 1u;
+    }
+    if (elapsed >= ticks) {                                     /* See Note #2.                                         */
+        return (ticks - 1u);
+    }
+    OS_CPU_MTimeCmpSet(cmp + ((INT64U)elapsed * OS_CPU_CFG_MTIME_CNTS_PER_TICK));
+    return (elapsed);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                            TASK RETURN HOOK
@@ -439,3 +522,74 @@ void  SysTick_Handler (void)
 
     OSIntExit();                               /* Tell uC/OS-II that we are leaving the ISR            */
 }
+
+
+/*
+*********************************************************************************************************
+*                                             TIMESTAMP
+*
+* Description: Read the free running timestamp used by uC/OS-II to measure short intervals of time (see
+*              OS_CPU_TS_GET()).
+*
+* Arguments  : none
+*
+* Returns    : The lower 32 bits of the 'mcycle' CSR, i.e. the number of CPU clock cycles.
+*********************************************************************************************************
+*/
+
+INT32U  OS_CPU_TS_Get (void)
+{
+    INT32U  cyc;
+
+
+    __asm__ volatile ("csrr %0, mcycle" : "=r" (cyc));
+
+    return (cyc);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       MACHINE TIMER ACCESS
+*
+* Description: Read the 64-bit 'mtime' and 'mtimecmp' registers and write 'mtimecmp' using 32-bit
+*              accesses.
+*
+* Arguments  : cmp       is the new value of 'mtimecmp' (OS_CPU_MTimeCmpSet() only).
+*
+* Note(s)    : 1) 'mtime' is read until its upper half is stable, since it may carry between both reads.
+*
+*              2) The upper half of 'mtimecmp' is first set to its maximum so that no spurious interrupt
+*                 is requested while the lower half is written.
+*********************************************************************************************************
+*/
+
+#if OS_TICKLESS_EN > 0u
+static  INT64U  OS_CPU_MTimeGet (void)
+{
+    INT32U  hi;
+    INT32U  lo;
+
+
+    do {                                                        /* See Note #1.                                         */
+        hi = OS_CPU_MTIME_HI;
+        lo = OS_CPU_MTIME_LO;
+    } while (hi != OS_CPU_MTIME_HI);
+
+    return (((INT64U)hi << 32u) | (INT64U)lo);
+}
+
+
+static  INT64U  OS_CPU_MTimeCmpGet (void)
+{
+    return (((INT64U)OS_CPU_MTIMECMP_HI << 32u) | (INT64U)OS_CPU_MTIMECMP_LO);
+}
+
+
+static  void  OS_CPU_MTimeCmpSet (INT64U  cmp)
+{
+    OS_CPU_MTIMECMP_HI = 0xFFFFFFFFu;                           /* See Note #2.                                         */
+    OS_CPU_MTIMECMP_LO = (INT32U)cmp;
+    OS_CPU_MTIMECMP_HI = (INT32U)(cmp >> 32u);
+}
+#endif
@@ -50,6 +50,8 @@ typedef  CPU_INT16U     INT16U;                                         /* Unsig
 typedef  CPU_INT16S     INT16S;                                         /* Signed   16 bit quantity                                 */
 typedef  CPU_INT32U     INT32U;                                         /* Unsigned 32 bit quantity                                 */
 typedef  CPU_INT32S     INT32S;                                         /* Signed   32 bit quantity                                 */
+typedef  CPU_INT64U     INT64U;                                         /* Unsigned 64 bit quantity                                 */
+typedef  CPU_INT64S     INT64S;                                         /* Signed   64 bit quantity                                 */
 typedef  CPU_FP32       FP32;                                           /* Single precision floating point                          */
 typedef  CPU_FP64       FP64;                                           /* Double precision floating point                          */
 
@@ -41,9 +41,11 @@
 *
 * Note: Index into table is bit pattern to resolve highest priority
 *       Indexed value corresponds to highest priority bit position (i.e. 0..7)
+*       The table is not needed when the port provides OS_CPU_CNT_TRAIL_ZEROS() (see OS_SchedNew())
 *********************************************************************************************************
 */
 
+#ifndef OS_CPU_CNT_TRAIL_ZEROS
 INT8U  const  OSUnMapTbl[256] = {
     0u, 0u, 1u, 0u, 2u, 0u, 1u, 0u, 3u, 0u, 1u, 0u, 2u, 0u, 1u, 0u, /* 0x00 to 0x0F                   */
     4u, 0u, 1u, 0u, 2u, 0u, 1u, 0u, 3u, 0u, 1u, 0u, 2u, 0u, 1u, 0u, /* 0x10 to 0x1F                   */
@@ -62,6 +64,7 @@ INT8U  const  OSUnMapTbl[256] = {
     5u, 0u, 1u, 0u, 2u, 0u, 1u, 0u, 3u, 0u, 1u, 0u, 2u, 0u, 1u, 0u, /* 0xE0 to 0xEF                   */
     4u, 0u, 1u, 0u, 2u, 0u, 1u, 0u, 3u, 0u, 1u, 0u, 2u, 0u, 1u, 0u  /* 0xF0 to 0xFF                   */
 };
+#endif
 
 
 /*
@@ -84,8 +87,42 @@ static  void  OS_InitTaskStat(void);
 
 static  void  OS_InitTCBList(void);
 
+#if OS_INT_DIS_MEAS_EN > 0u
+static  void  OS_IntDisMeasInit(void);
+#endif
+
 static  void  OS_SchedNew(void);
 
+#if OS_TASK_PROFILE_TS_EN > 0u
+static  void  OS_TaskProfileIntEnter(void);
+
+static  void  OS_TaskProfileIntExit(void);
+
+static  void  OS_TaskProfileSw(void);
+
+#if OS_TASK_STAT_EN > 0u
+static  INT16U  OS_TaskStatUsageCalc(INT32U cycles, INT32U window);
+#endif
+#endif
+
+#if OS_SCHED_RR_EN > 0u
+static  OS_TCB  *OS_SchedRRRdyOther(OS_TCB *ptcb);
+
+static  void     OS_SchedRRTick(void);
+
+#if (OS_EVENT_EN)
+static  BOOLEAN  OS_SchedRRIsWaiting(OS_TCB *ptcb, OS_EVENT *pevent);
+#endif
+#endif
+
+#if (OS_TICK_LIST_EN > 0u) || (OS_TICKLESS_EN > 0u)
+static  void    OS_TickExpire(OS_TCB *ptcb);
+#endif
+
+#if OS_TICKLESS_EN > 0u
+static  INT32U  OS_TicklessTicksGet(INT32U int_ctr);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -151,6 +188,18 @@ INT8U  OSEventNameGet (OS_EVENT   *pevent,
         case OS_EVENT_TYPE_MUTEX:
         case OS_EVENT_TYPE_MBOX:
         case OS_EVENT_TYPE_Q:
+#if (OS_Q_EN > 0u) && (OS_MAX_QS > 0u) && (OS_Q_EX_EN > 0u)
+        case OS_EVENT_TYPE_Q_EX:
+#endif
+#if (OS_RING_EN > 0u) && (OS_MAX_RINGS > 0u)
+        case OS_EVENT_TYPE_RING:
+#endif
+#if (OS_PIPE_EN > 0u) && (OS_MAX_PIPES > 0u)
+        case OS_EVENT_TYPE_PIPE:
+#endif
+#if OS_RWLOCK_EN > 0u
+        case OS_EVENT_TYPE_RWLOCK:
+#endif
              break;
 
         default:
@@ -230,6 +279,18 @@ void  OSEventNameSet (OS_EVENT  *pevent,
         case OS_EVENT_TYPE_MUTEX:
         case OS_EVENT_TYPE_MBOX:
         case OS_EVENT_TYPE_Q:
+#if (OS_Q_EN > 0u) && (OS_MAX_QS > 0u) && (OS_Q_EX_EN > 0u)
+        case OS_EVENT_TYPE_Q_EX:
+#endif
+#if (OS_RING_EN > 0u) && (OS_MAX_RINGS > 0u)
+        case OS_EVENT_TYPE_RING:
+#endif
+#if (OS_PIPE_EN > 0u) && (OS_MAX_PIPES > 0u)
+        case OS_EVENT_TYPE_PIPE:
+#endif
+#if OS_RWLOCK_EN > 0u
+        case OS_EVENT_TYPE_RWLOCK:
+#endif
              break;
 
         default:
@@ -484,6 +545,9 @@ INT16U  OSEventPendMulti (OS_EVENT  **pevents_pend,
                                OS_STAT_MULTI;           /* ... pend on multiple events                 */
     OSTCBCur->OSTCBStatPend  = OS_STAT_PEND_OK;
     OSTCBCur->OSTCBDly       = timeout;                 /* Store pend timeout in TCB                   */
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListInsert(OSTCBCur);                        /* Add task to the list of delayed tasks       */
+#endif
     OS_EventTaskWaitMulti(pevents_pend);                /* Suspend task until events or timeout occurs */
 
     OS_EXIT_CRITICAL();
@@ -609,6 +673,14 @@ void  OSInit (void)
     OS_QInit();                                                  /* Initialize the message queue structures  */
 #endif
 
+#if (OS_PIPE_EN > 0u) && (OS_MAX_PIPES > 0u)
+    OS_PipeInit();                                               /* Initialize the pipe structures           */
+#endif
+
+#if (OS_RING_EN > 0u) && (OS_MAX_RINGS > 0u)
+    OS_RingInit();                                               /* Initialize the ring buffer structures    */
+#endif
+
 #if OS_TASK_CREATE_EXT_EN > 0u
 #if defined(OS_TLS_TBL_SIZE) && (OS_TLS_TBL_SIZE > 0u)
     OS_TLS_Init(&err);                                           /* Initialize TLS, before creating tasks    */
@@ -623,6 +695,10 @@ void  OSInit (void)
     OS_InitTaskStat();                                           /* Create the Statistic Task                */
 #endif
 
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    OSIntQ_Init();                                               /* Initialize the deferred ISR post ring    */
+#endif
+
 #if OS_TMR_EN > 0u
     OSTmr_Init();                                                /* Initialize the Timer Manager             */
 #endif
@@ -635,6 +711,86 @@ void  OSInit (void)
 }
 
 
+/*
+*********************************************************************************************************
+*                                QUERY INTERRUPT DISABLE TIME MEASUREMENT
+*
+* Description: This function is called to obtain the length of the last and of the longest critical
+*              section (i.e. interrupts disabled by OS_ENTER_CRITICAL()) and scheduler lock since OSInit()
+*              or since the last call to OSIntDisMeasReset().
+*
+* Arguments  : p_int_dis_data  is a pointer to a structure that will contain the measured times.
+*
+* Returns    : OS_ERR_NONE         The call was successful and the times have been copied.
+*              OS_ERR_PDATA_NULL   If 'p_int_dis_data' is a NULL pointer.
+*
+* Notes      : 1) The times are expressed in OS_CPU_TS_GET() counts, see the port's os_cpu.h.
+*              2) The overhead of the measurement itself is subtracted from the critical section times.
+*              3) The scheduler lock times cover OSSchedLock()/OSSchedUnlock() as well as the locks taken
+*                 internally by uC/OS-II, from the outermost lock to the matching unlock.
+*********************************************************************************************************
+*/
+
+#if OS_INT_DIS_MEAS_EN > 0u
+INT8U  OSIntDisMeasQuery (OS_INT_DIS_DATA  *p_int_dis_data)
+{
+#if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#if OS_ARG_CHK_EN > 0u
+    if (p_int_dis_data == (OS_INT_DIS_DATA *)0) {          /* Validate 'p_int_dis_data'                */
+        return (OS_ERR_PDATA_NULL);
+    }
+#endif
+    OS_ENTER_CRITICAL();
+    p_int_dis_data->OSIntDisTimeCur    = OSIntDisTimeCur;
+    p_int_dis_data->OSIntDisTimeMax    = OSIntDisTimeMax;
+    p_int_dis_data->OSSchedLockTimeCur = OSSchedLockTimeCur;
+    p_int_dis_data->OSSchedLockTimeMax = OSSchedLockTimeMax;
+    OS_EXIT_CRITICAL();
+    return (OS_ERR_NONE);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                RESET INTERRUPT DISABLE TIME MEASUREMENT
+*
+* Description: This function clears the measured critical section and scheduler lock times, e.g. to
+*              ignore the start-up code of the application.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Notes      : 1) The critical section of this function is itself measured once its interrupts are
+*                 re-enabled.
+*********************************************************************************************************
+*/
+
+#if OS_INT_DIS_MEAS_EN > 0u
+void  OSIntDisMeasReset (void)
+{
+#if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+    OS_ENTER_CRITICAL();
+    OSIntDisTimeCur    = 0u;
+    OSIntDisTimeMax    = 0u;
+    OSSchedLockTimeCur = 0u;
+    OSSchedLockTimeMax = 0u;
+    OS_EXIT_CRITICAL();
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                              ENTER ISR
@@ -657,6 +813,9 @@ void  OSInit (void)
 *              5) You are allowed to nest interrupts up to 255 levels deep.
 *              6) I removed the OS_ENTER_CRITICAL() and OS_EXIT_CRITICAL() around the increment because
 *                 OSIntEnter() is always called with interrupts disabled.
+*              7) When the kernel profiles the tasks (see OS_TaskProfileSw()), the time spent in ISRs is
+*                 accumulated in OSIntCyclesTot instead of being charged to the interrupted task.  ISRs
+*                 which increment OSIntNesting directly are charged to the interrupted task.
 *********************************************************************************************************
 */
 
@@ -666,6 +825,11 @@ void  OSIntEnter (void)
         if (OSIntNesting < 255u) {
             OSIntNesting++;                      /* Increment ISR nesting level                        */
         }
+#if OS_TASK_PROFILE_TS_EN > 0u
+        if (OSIntNesting == 1u) {                /* Outermost ISR, stop charging the current task      */
+            OS_TaskProfileIntEnter();
+        }
+#endif
         OS_TRACE_ISR_ENTER();
     }
 }
@@ -703,11 +867,22 @@ void  OSIntExit (void)
         if (OSIntNesting > 0u) {                           /* Prevent OSIntNesting from wrapping       */
             OSIntNesting--;
         }
+#if OS_TICKLESS_EN > 0u
+        OSIntExitCtr++;                                    /* Tell the idle task an ISR ran            */
+#endif
         if (OSIntNesting == 0u) {                          /* Reschedule only if all ISRs complete ... */
+#if OS_TASK_PROFILE_TS_EN > 0u
+            OS_TaskProfileIntExit();                       /* Account for the time spent in ISRs       */
+#endif
             if (OSLockNesting == 0u) {                     /* ... and not locked.                      */
                 OS_SchedNew();
+#if OS_SCHED_RR_EN > 0u
+                OSTCBHighRdy = OS_SchedRRNext(OSPrioHighRdy);
+                if (OSTCBHighRdy != OSTCBCur) {            /* No Ctx Sw if current task is highest rdy */
+#else
                 OSTCBHighRdy = OSTCBPrioTbl[OSPrioHighRdy];
                 if (OSPrioHighRdy != OSPrioCur) {          /* No Ctx Sw if current task is highest rdy */
+#endif
 #if OS_TASK_PROFILE_EN > 0u
                     OSTCBHighRdy->OSTCBCtxSwCtr++;         /* Inc. # of context switches to this task  */
 #endif
@@ -717,6 +892,9 @@ void  OSIntExit (void)
 #if defined(OS_TLS_TBL_SIZE) && (OS_TLS_TBL_SIZE > 0u)
                     OS_TLS_TaskSw();
 #endif
+#endif
+#if OS_TASK_PROFILE_TS_EN > 0u
+                    OS_TaskProfileSw();                    /* Charge the task being switched out       */
 #endif
                     OS_TRACE_ISR_EXIT_TO_SCHEDULER();
 
@@ -792,6 +970,9 @@ void  OSSchedLock (void)
         if (OSIntNesting == 0u) {                /* Can't call from an ISR                             */
             if (OSLockNesting < 255u) {          /* Prevent OSLockNesting from wrapping back to 0      */
                 OSLockNesting++;                 /* Increment lock nesting level                       */
+#if OS_INT_DIS_MEAS_EN > 0u
+                OS_SchedLockMeasStart();
+#endif
             }
         }
         OS_EXIT_CRITICAL();
@@ -829,6 +1010,9 @@ void  OSSchedUnlock (void)
         if (OSIntNesting == 0u) {                          /* Can't call from an ISR                   */
             if (OSLockNesting > 0u) {                      /* Do not decrement if already 0            */
                 OSLockNesting--;                           /* Decrement lock nesting level             */
+#if OS_INT_DIS_MEAS_EN > 0u
+                OS_SchedLockMeasStop();
+#endif
                 if (OSLockNesting == 0u) {                 /* See if scheduler is enabled              */
                     OS_EXIT_CRITICAL();
                     OS_Sched();                            /* See if a HPT is ready                    */
@@ -846,6 +1030,131 @@ void  OSSchedUnlock (void)
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                   CONFIGURE ROUND-ROBIN SCHEDULING
+*
+* Description: This function is used to enable or disable the time slicing of tasks sharing the same
+*              priority and to change the default time quanta.
+*
+* Arguments  : en                 OS_TRUE  to time slice the tasks sharing a priority (the default)
+*                                 OS_FALSE to let each task run until it blocks or yields
+*
+*              dflt_time_quanta   is the number of ticks a task runs before the next task at the same
+*                                 priority is given the CPU when the task doesn't specify its own time
+*                                 quanta (see OSTaskTimeQuantaSet()).  0 selects OS_TICKS_PER_SEC / 10.
+*
+*              perr               is a pointer to an error code:
+*
+*                                 OS_ERR_NONE        the call was successful
+*
+* Returns    : none
+*
+* Notes      : 1) The new default time quanta is used the next time a task using it is scheduled.
+*********************************************************************************************************
+*/
+
+#if OS_SCHED_RR_EN > 0u
+void  OSSchedRoundRobinCfg (BOOLEAN   en,
+                            INT32U    dflt_time_quanta,
+                            INT8U    *perr)
+{
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    if (dflt_time_quanta == 0u) {
+        dflt_time_quanta = OS_TICKS_PER_SEC / 10u;
+    }
+    OS_ENTER_CRITICAL();
+    if (en == OS_FALSE) {
+        OSSchedRREn = OS_FALSE;
+    } else {
+        OSSchedRREn = OS_TRUE;
+    }
+    OSSchedRRDfltTimeQuanta = dflt_time_quanta;
+    OS_EXIT_CRITICAL();
+    *perr = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                            GIVE UP THE CPU TO A TASK AT THE SAME PRIORITY
+*
+* Description: This function is called by a task to give up the remainder of its time quanta to the next
+*              ready task at the same priority.  The calling task is placed at the end of the list of
+*              tasks at its priority.
+*
+* Arguments  : perr     is a pointer to an error code:
+*
+*                       OS_ERR_NONE                   the CPU was given to another task
+*                       OS_ERR_ROUND_ROBIN_1          no other task at this priority is ready to run
+*                       OS_ERR_ROUND_ROBIN_DISABLED   round-robin scheduling is disabled
+*                       OS_ERR_SCHED_LOCKED           the scheduler is locked
+*                       OS_ERR_YIELD_ISR              if you called this function from an ISR
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+#if OS_SCHED_RR_EN > 0u
+void  OSSchedRoundRobinYield (INT8U  *perr)
+{
+    OS_TCB    *ptcb;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    if (OSIntNesting > 0u) {                     /* Can't call from an ISR                             */
+        *perr = OS_ERR_YIELD_ISR;
+        return;
+    }
+    if (OSLockNesting > 0u) {                    /* Can't yield when the scheduler is locked           */
+        *perr = OS_ERR_SCHED_LOCKED;
+        return;
+    }
+    OS_ENTER_CRITICAL();
+    if (OSSchedRREn == OS_FALSE) {
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_ROUND_ROBIN_DISABLED;
+        return;
+    }
+    ptcb = OSTCBCur;
+    if (OS_SchedRRRdyOther(ptcb) == (OS_TCB *)0) {   /* See if another task at this priority is ready  */
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_ROUND_ROBIN_1;
+        return;
+    }
+    OS_SchedRRRemove(ptcb);                      /* Move the task to the end of its priority ...       */
+    OS_SchedRRInsert(ptcb);
+    ptcb->OSTCBTimeQuantaCtr = 0u;               /* ... and give up the rest of its time quanta        */
+    OS_EXIT_CRITICAL();
+    OS_Sched();
+    *perr = OS_ERR_NONE;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                         START MULTITASKING
@@ -871,8 +1180,18 @@ void  OSStart (void)
     if (OSRunning == OS_FALSE) {
         OS_SchedNew();                               /* Find highest priority's task priority number   */
         OSPrioCur     = OSPrioHighRdy;
+#if OS_SCHED_RR_EN > 0u
+        OSTCBHighRdy  = OS_SchedRRNext(OSPrioHighRdy);   /* First ready task at the highest priority   */
+#else
         OSTCBHighRdy  = OSTCBPrioTbl[OSPrioHighRdy]; /* Point to highest priority task ready to run    */
+#endif
         OSTCBCur      = OSTCBHighRdy;
+#if OS_TASK_PROFILE_TS_EN > 0u
+        OSTCBCur->OSTCBCyclesStart = OS_CPU_TS_GET();  /* First task starts running                  */
+#if OS_TASK_STAT_EN > 0u
+        OSStatTS = OSTCBCur->OSTCBCyclesStart;       /* Start of the first statistics period           */
+#endif
+#endif
         OSStartHighRdy();                            /* Execute target specific code to start task     */
     }
 }
@@ -895,6 +1214,10 @@ void  OSStart (void)
 * Arguments  : none
 *
 * Returns    : none
+*
+* Note(s)    : 1) When OS_TASK_STAT_TS_EN is set to 1, the CPU usage is computed from the run time of the
+*                 idle task (see OS_TaskStat()) and no calibration is needed.  This function then returns
+*                 immediately and calling it is optional.
 *********************************************************************************************************
 */
 
@@ -907,14 +1230,18 @@ void  OSStatInit (void)
 
 
 
+#if OS_TASK_STAT_TS_EN == 0u
     OSTimeDly(2u);                               /* Synchronize with clock tick                        */
     OS_ENTER_CRITICAL();
     OSIdleCtr    = 0uL;                          /* Clear idle counter                                 */
     OS_EXIT_CRITICAL();
     OSTimeDly(OS_TICKS_PER_SEC / 10u);           /* Determine MAX. idle counter value for 1/10 second  */
+#endif
     OS_ENTER_CRITICAL();
+#if OS_TASK_STAT_TS_EN == 0u
     OSIdleCtrMax = OSIdleCtr;                    /* Store maximum idle counter count in 1/10 second    */
-    OSStatRdy    = OS_TRUE;
+#endif
+    OSStatRdy    = OS_TRUE;                      /* See Note #1                                        */
     OS_EXIT_CRITICAL();
 }
 #endif
@@ -931,6 +1258,9 @@ void  OSStatInit (void)
 * Arguments  : none
 *
 * Returns    : none
+*
+* Note(s)    : 1) When OS_TICK_LIST_EN is set to 1, only the tasks whose delay or timeout expires on this
+*                 tick are processed.  Otherwise, every task in OSTCBList is visited.
 *********************************************************************************************************
 */
 
@@ -946,6 +1276,9 @@ void  OSTimeTick (void)
 
 
 
+#if (OS_TMR_EN > 0u) && (OS_TICKLESS_EN > 0u) && (OS_TMR_CFG_TICK_EN == 0u)
+    OSTmrTickCtr++;                                        /* Ticks since the timer task was signaled      */
+#endif
 #if OS_TIME_TICK_HOOK_EN > 0u
     OSTimeTickHook();                                      /* Call user definable hook                     */
 #endif
@@ -980,6 +1313,27 @@ void  OSTimeTick (void)
             return;
         }
 #endif
+#if OS_SCHED_RR_EN > 0u
+        OS_ENTER_CRITICAL();
+        OS_SchedRRTick();                              /* Charge the tick to the current time quanta   */
+        OS_EXIT_CRITICAL();
+#endif
+#if OS_TICK_LIST_EN > 0u
+        OS_ENTER_CRITICAL();
+        ptcb = OSTickList;                                 /* Only the head of the list is decremented     */
+        if (ptcb != (OS_TCB *)0) {
+            ptcb->OSTCBTickDelta--;
+            while ((ptcb != (OS_TCB *)0) && (ptcb->OSTCBTickDelta == 0u)) {
+                OS_TickListRemove(ptcb);                   /* Delay or timeout expired                     */
+                ptcb->OSTCBDly = 0u;
+                OS_TickExpire(ptcb);
+                OS_EXIT_CRITICAL();                        /* Give interrupts a chance between tasks       */
+                OS_ENTER_CRITICAL();
+                ptcb = OSTickList;
+            }
+        }
+        OS_EXIT_CRITICAL();
+#else
         ptcb = OSTCBList;                                  /* Point at first TCB in TCB list               */
         while (ptcb->OSTCBPrio != OS_TASK_IDLE_PRIO) {     /* Go through all TCBs in TCB list              */
             OS_ENTER_CRITICAL();
@@ -1004,8 +1358,109 @@ void  OSTimeTick (void)
             ptcb = ptcb->OSTCBNext;                        /* Point at next TCB in TCB list                */
             OS_EXIT_CRITICAL();
         }
+#endif
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_TICK_EN > 0u)
+        OSTmr_Tick();                                      /* Process the timers at the tick rate          */
+#endif
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    PROCESS SEVERAL SYSTEM TICKS
+*
+* Description: This function is used to signal to uC/OS-II that 'ticks' system ticks elapsed at once.  It
+*              is used by the idle task to catch up after the tick interrupt was suppressed (see
+*              OSTaskIdleTicklessHook()) but can also be called by a tick ISR which missed ticks.
+*
+* Arguments  : ticks     is the number of ticks which elapsed.
+*
+* Returns    : none
+*
+* Note(s)    : 1) The effect is the same as calling OSTimeTick() 'ticks' times except that the delayed
+*                 tasks are only visited once.  OSTimeTickHook() is still called once per tick so that the
+*                 ports and the application can keep their tick based counters (e.g. the timer task
+*                 signal) in step.
+*              2) This function MUST be called either from an ISR or with the scheduler locked.
+*              3) Tick stepping (OS_TICK_STEP_EN) is not honored by this function.
+*********************************************************************************************************
+*/
+
+#if OS_TICKLESS_EN > 0u
+void  OSTimeTickN (INT32U  ticks)
+{
+    OS_TCB    *ptcb;
+#if (OS_TMR_EN > 0u) || (OS_TIME_TICK_HOOK_EN > 0u)
+    INT32U     i;
+#endif
+#if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register     */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+    if (ticks == 0u) {
+        return;
+    }
+#if (OS_TMR_EN > 0u) || (OS_TIME_TICK_HOOK_EN > 0u)
+    for (i = 0u; i < ticks; i++) {                         /* See Note #1                                  */
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_TICK_EN == 0u)
+        OSTmrTickCtr++;                                    /* Ticks since the timer task was signaled      */
+#endif
+#if OS_TIME_TICK_HOOK_EN > 0u
+        OSTimeTickHook();                                  /* Call user definable hook                     */
+#endif
+    }
+#endif
+#if OS_TIME_GET_SET_EN > 0u
+    OS_ENTER_CRITICAL();                                   /* Update the 32-bit tick counter               */
+    OSTime += ticks;
+    OS_TRACE_TICK_INCREMENT(OSTime);
+    OS_EXIT_CRITICAL();
+#endif
+    if (OSRunning == OS_TRUE) {
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_TICK_EN > 0u)
+        for (i = 0u; i < ticks; i++) {                     /* Catch up with the timers one tick at a time  */
+            OSTmr_Tick();
+        }
+#endif
+#if OS_TICK_LIST_EN > 0u
+        OS_ENTER_CRITICAL();
+        ptcb = OSTickList;                                 /* Consume the deltas from the head of the list */
+        while ((ptcb != (OS_TCB *)0) && (ptcb->OSTCBTickDelta <= ticks)) {
+            ticks               -= ptcb->OSTCBTickDelta;
+            ptcb->OSTCBTickDelta = 0u;
+            OS_TickListRemove(ptcb);                       /* Delay or timeout expired                     */
+            ptcb->OSTCBDly       = 0u;
+            OS_TickExpire(ptcb);
+            OS_EXIT_CRITICAL();                            /* Give interrupts a chance between tasks       */
+            OS_ENTER_CRITICAL();
+            ptcb = OSTickList;
+        }
+        if (ptcb != (OS_TCB *)0) {
+            ptcb->OSTCBTickDelta -= ticks;
+        }
+        OS_EXIT_CRITICAL();
+#else
+        ptcb = OSTCBList;                                  /* Point at first TCB in TCB list               */
+        while (ptcb->OSTCBPrio != OS_TASK_IDLE_PRIO) {     /* Go through all TCBs in TCB list              */
+            OS_ENTER_CRITICAL();
+            if (ptcb->OSTCBDly != 0u) {                    /* No, Delayed or waiting for event with TO     */
+                if (ptcb->OSTCBDly > ticks) {
+                    ptcb->OSTCBDly -= ticks;               /* Still delayed after 'ticks'                  */
+                } else {
+                    ptcb->OSTCBDly  = 0u;                  /* Delay or timeout expired                     */
+                    OS_TickExpire(ptcb);
+                }
+            }
+            ptcb = ptcb->OSTCBNext;                        /* Point at next TCB in TCB list                */
+            OS_EXIT_CRITICAL();
+        }
+#endif
     }
 }
+#endif
 
 
 /*
@@ -1049,52 +1504,43 @@ void  OS_Dummy (void)
 
 /*
 *********************************************************************************************************
-*                           MAKE TASK READY TO RUN BASED ON EVENT OCCURING
+*                            FIND THE HIGHEST PRIORITY TASK WAITING FOR AN EVENT
 *
-* Description: This function is called by other uC/OS-II services and is used to ready a task that was
-*              waiting for an event to occur.
+* Description: This function returns the priority of the highest priority task waiting on an event.
 *
-* Arguments  : pevent      is a pointer to the event control block corresponding to the event.
+* Arguments  : pevent      is a pointer to the event control block.  At least one task MUST be waiting
+*                          on it.
 *
-*              pmsg        is a pointer to a message.  This pointer is used by message oriented services
-*                          such as MAILBOXEs and QUEUEs.  The pointer is not used when called by other
-*                          service functions.
+* Returns    : The priority of the task.
 *
-*              msk         is a mask that is used to clear the status byte of the TCB.  For example,
-*                          OSSemPost() will pass OS_STAT_SEM, OSMboxPost() will pass OS_STAT_MBOX etc.
-*
-*              pend_stat   is used to indicate the readied task's pending status:
-*
-*                          OS_STAT_PEND_OK      Task ready due to a post (or delete), not a timeout or
-*                                               an abort.
-*                          OS_STAT_PEND_ABORT   Task ready due to an abort.
-*
-* Returns    : none
-*
-* Note       : This function is INTERNAL to uC/OS-II and your application should not call it.
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) This function is called with interrupts disabled.
 *********************************************************************************************************
 */
 #if (OS_EVENT_EN)
-INT8U  OS_EventTaskRdy (OS_EVENT  *pevent,
-                        void      *pmsg,
-                        INT8U      msk,
-                        INT8U      pend_stat)
+INT8U  OS_EventWaitPrioGet (OS_EVENT  *pevent)
 {
-    OS_TCB   *ptcb;
     INT8U     y;
     INT8U     x;
-    INT8U     prio;
-#if OS_LOWEST_PRIO > 63u
+#if (OS_LOWEST_PRIO > 63u) && !defined(OS_CPU_CNT_TRAIL_ZEROS)
     OS_PRIO  *ptbl;
 #endif
 
 
+#if defined(OS_CPU_CNT_TRAIL_ZEROS)                     /* See OS_SchedNew(), Note #3                  */
+    y    = (INT8U)OS_CPU_CNT_TRAIL_ZEROS(pevent->OSEventGrp);
+    x    = (INT8U)OS_CPU_CNT_TRAIL_ZEROS(pevent->OSEventTbl[y]);
 #if OS_LOWEST_PRIO <= 63u
-    y    = OSUnMapTbl[pevent->OSEventGrp];              /* Find HPT waiting for message                */
+    return ((INT8U)((y << 3u) + x));
+#else
+    return ((INT8U)((y << 4u) + x));
+#endif
+#elif OS_LOWEST_PRIO <= 63u
+    y    = OSUnMapTbl[pevent->OSEventGrp];              /* Find HPT waiting for the event              */
     x    = OSUnMapTbl[pevent->OSEventTbl[y]];
-    prio = (INT8U)((y << 3u) + x);                      /* Find priority of task getting the msg       */
+    return ((INT8U)((y << 3u) + x));
 #else
-    if ((pevent->OSEventGrp & 0xFFu) != 0u) {           /* Find HPT waiting for message                */
+    if ((pevent->OSEventGrp & 0xFFu) != 0u) {           /* Find HPT waiting for the event              */
         y = OSUnMapTbl[ pevent->OSEventGrp & 0xFFu];
     } else {
         y = OSUnMapTbl[(OS_PRIO)(pevent->OSEventGrp >> 8u) & 0xFFu] + 8u;
@@ -1105,12 +1551,74 @@ INT8U  OS_EventTaskRdy (OS_EVENT  *pevent,
     } else {
         x = OSUnMapTbl[(OS_PRIO)(*ptbl >> 8u) & 0xFFu] + 8u;
     }
-    prio = (INT8U)((y << 4u) + x);                      /* Find priority of task getting the msg       */
+    return ((INT8U)((y << 4u) + x));
+#endif
+}
 #endif
 
+
+/*
+*********************************************************************************************************
+*                           MAKE TASK READY TO RUN BASED ON EVENT OCCURING
+*
+* Description: This function is called by other uC/OS-II services and is used to ready a task that was
+*              waiting for an event to occur.
+*
+* Arguments  : pevent      is a pointer to the event control block corresponding to the event.
+*
+*              pmsg        is a pointer to a message.  This pointer is used by message oriented services
+*                          such as MAILBOXEs and QUEUEs.  The pointer is not used when called by other
+*                          service functions.  For a by-value queue (see OSQCreateEx()), 'pmsg' points to
+*                          the element that is copied to the buffer of the waiting task.
+*
+*              msk         is a mask that is used to clear the status byte of the TCB.  For example,
+*                          OSSemPost() will pass OS_STAT_SEM, OSMboxPost() will pass OS_STAT_MBOX etc.
+*
+*              pend_stat   is used to indicate the readied task's pending status:
+*
+*                          OS_STAT_PEND_OK      Task ready due to a post (or delete), not a timeout or
+*                                               an abort.
+*                          OS_STAT_PEND_ABORT   Task ready due to an abort.
+*
+* Returns    : none
+*
+* Note       : This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+#if (OS_EVENT_EN)
+INT8U  OS_EventTaskRdy (OS_EVENT  *pevent,
+                        void      *pmsg,
+                        INT8U      msk,
+                        INT8U      pend_stat)
+{
+    OS_TCB   *ptcb;
+    INT8U     prio;
+
+
+    prio = OS_EventWaitPrioGet(pevent);                 /* Find priority of task getting the msg       */
+
+#if OS_SCHED_RR_EN > 0u
+    ptcb                  =  OS_SchedRREventTCB(prio, pevent);  /* First task at 'prio' waiting        */
+    OS_SchedRRRemove(ptcb);                             /* Move it to the tail of its priority, see    */
+    OS_SchedRRInsert(ptcb);                             /* ... OS_SchedRRNext()                        */
+#else
     ptcb                  =  OSTCBPrioTbl[prio];        /* Point to this task's OS_TCB                 */
+#endif
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListRemove(ptcb);                            /* Remove task from list of delayed tasks      */
+#endif
     ptcb->OSTCBDly        =  0u;                        /* Prevent OSTimeTick() from readying task     */
-#if ((OS_Q_EN > 0u) && (OS_MAX_QS > 0u)) || (OS_MBOX_EN > 0u)
+#if (OS_Q_EN > 0u) && (OS_MAX_QS > 0u) && (OS_Q_EX_EN > 0u)
+    if (pevent->OSEventType == OS_EVENT_TYPE_Q_EX) {    /* Copy element to the waiting task's buffer   */
+        if (pend_stat == OS_STAT_PEND_OK) {
+            OS_MemCopy((INT8U *)ptcb->OSTCBMsg,
+                       (INT8U *)pmsg,
+                       ((OS_Q *)pevent->OSEventPtr)->OSQElemSize);
+        }
+    } else {
+        ptcb->OSTCBMsg    =  pmsg;                      /* Send message directly to waiting task       */
+    }
+#elif ((OS_Q_EN > 0u) && (OS_MAX_QS > 0u)) || (OS_MBOX_EN > 0u)
     ptcb->OSTCBMsg        =  pmsg;                      /* Send message directly to waiting task       */
 #else
     pmsg                  =  pmsg;                      /* Prevent compiler warning if not used        */
@@ -1120,7 +1628,7 @@ INT8U  OS_EventTaskRdy (OS_EVENT  *pevent,
                                                         /* See if task is ready (could be susp'd)      */
     if ((ptcb->OSTCBStat &   OS_STAT_SUSPEND) == OS_STAT_RDY) {
         OSRdyGrp         |=  ptcb->OSTCBBitY;           /* Put task in the ready to run list           */
-        OSRdyTbl[y]      |=  ptcb->OSTCBBitX;
+        OSRdyTbl[ptcb->OSTCBY] |=  ptcb->OSTCBBitX;
         OS_TRACE_TASK_READY(ptcb);
     }
 
@@ -1169,6 +1677,9 @@ void  OS_EventTaskWait (OS_EVENT *pevent)
     if (OSRdyTbl[y] == 0u) {                      /* Clear event grp bit if this was only task pending */
         OSRdyGrp &= (OS_PRIO)~OSTCBCur->OSTCBBitY;
     }
+#if OS_SCHED_RR_EN > 0u
+    OS_SchedRRRdyRestore(OSTCBCur);               /* Other tasks at this priority may still be ready   */
+#endif
 }
 #endif
 
@@ -1214,6 +1725,9 @@ void  OS_EventTaskWaitMulti (OS_EVENT **pevents_wait)
     if (OSRdyTbl[y] == 0u) {                      /* Clear event grp bit if this was only task pending */
         OSRdyGrp &= (OS_PRIO)~OSTCBCur->OSTCBBitY;
     }
+#if OS_SCHED_RR_EN > 0u
+    OS_SchedRRRdyRestore(OSTCBCur);               /* Other tasks at this priority may still be ready   */
+#endif
 }
 #endif
 
@@ -1245,6 +1759,9 @@ void  OS_EventTaskRemove (OS_TCB   *ptcb,
     if (pevent->OSEventTbl[y] == 0u) {
         pevent->OSEventGrp &= (OS_PRIO)~ptcb->OSTCBBitY;
     }
+#if OS_SCHED_RR_EN > 0u
+    OS_SchedRREventRestore(ptcb, pevent);                   /* Other tasks at this prio may still wait */
+#endif
     ptcb->OSTCBEventPtr     = (OS_EVENT  *)0;               /* Unlink OS_EVENT from OS_TCB             */
 }
 #endif
@@ -1286,6 +1803,9 @@ void  OS_EventTaskRemoveMulti (OS_TCB    *ptcb,
         if (pevent->OSEventTbl[y] == 0u) {
             pevent->OSEventGrp &= (OS_PRIO)~bity;
         }
+#if OS_SCHED_RR_EN > 0u
+        OS_SchedRREventRestore(ptcb, pevent);           /* Other tasks at this prio may still wait     */
+#endif
         pevents++;
         pevent = *pevents;
     }
@@ -1393,6 +1913,9 @@ static  void  OS_InitMisc (void)
 #endif
 
     OSIntNesting              = 0u;                        /* Clear the interrupt nesting counter      */
+#if OS_TICKLESS_EN > 0u
+    OSIntExitCtr              = 0uL;
+#endif
     OSLockNesting             = 0u;                        /* Clear the scheduling lock counter        */
 
     OSTaskCtr                 = 0u;                        /* Clear the number of tasks                */
@@ -1402,10 +1925,33 @@ static  void  OS_InitMisc (void)
     OSCtxSwCtr                = 0u;                        /* Clear the context switch counter         */
     OSIdleCtr                 = 0uL;                       /* Clear the 32-bit idle counter            */
 
+#if OS_TICK_LIST_EN > 0u
+    OSTickList                = (OS_TCB *)0;               /* No task is delayed                       */
+#endif
+
+#if OS_SCHED_RR_EN > 0u
+    OSSchedRREn               = OS_TRUE;                   /* Time slice tasks sharing a priority ...  */
+    OSSchedRRDfltTimeQuanta   = OS_TICKS_PER_SEC / 10u;    /* ... every 1/10 second by default         */
+#endif
+
 #if OS_TASK_STAT_EN > 0u
     OSIdleCtrRun              = 0uL;
     OSIdleCtrMax              = 0uL;
     OSStatRdy                 = OS_FALSE;                  /* Statistic task is not ready              */
+#if OS_TASK_STAT_TS_EN > 0u
+    OSCPUUsageHiRes           = 0u;
+#endif
+#endif
+
+#if OS_TASK_PROFILE_TS_EN > 0u
+    OSIntCyclesRun            = OS_FALSE;                  /* Clear the ISR run time accounting        */
+    OSIntCyclesStart          = 0uL;
+    OSIntCyclesTot            = 0uL;
+    OSIntCyclesTotPrev        = 0uL;
+    OSIntCPUUsage             = 0u;
+#if OS_TASK_STAT_EN > 0u
+    OSStatTS                  = 0uL;
+#endif
 #endif
 
 #ifdef OS_SAFETY_CRITICAL_IEC61508
@@ -1415,6 +1961,10 @@ static  void  OS_InitMisc (void)
 #if OS_TASK_REG_TBL_SIZE > 0u
     OSTaskRegNextAvailID      = 0u;                        /* Initialize the task register ID          */
 #endif
+
+#if OS_INT_DIS_MEAS_EN > 0u
+    OS_IntDisMeasInit();                                   /* Calibrate the interrupt disable meas.    */
+#endif
 }
 
 
@@ -1617,6 +2167,78 @@ static  void  OS_InitTCBList (void)
 }
 
 
+/*
+*********************************************************************************************************
+*                                   INTERRUPT DISABLE TIME MEASUREMENT
+*
+* Description: The port calls OS_IntDisMeasStart() right after disabling interrupts in OS_ENTER_CRITICAL()
+*              and OS_IntDisMeasStop() right before restoring them in OS_EXIT_CRITICAL().  Only the
+*              outermost critical section is timed, with the OS_CPU_TS_GET() timestamp of the port.
+*
+*              OS_IntDisMeasInit() is called by OSInit() to measure the overhead of a Start/Stop pair,
+*              which is subtracted from every measurement.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-II and your application should not call them.
+*              2) OS_IntDisMeasStart() and OS_IntDisMeasStop() MUST be called with interrupts disabled.
+*              3) The subtraction wraps correctly as long as a critical section is shorter than a
+*                 full period of the timestamp.
+*********************************************************************************************************
+*/
+
+#if OS_INT_DIS_MEAS_EN > 0u
+static  void  OS_IntDisMeasInit (void)
+{
+    OSIntDisMeasNestingCtr = 0u;
+    OSIntDisMeasOvrhd      = 0u;
+    OS_IntDisMeasStart();                                  /* First pass warms up the cache            */
+    OS_IntDisMeasStop();
+    OS_IntDisMeasStart();                                  /* Measure the overhead of the functions    */
+    OS_IntDisMeasStop();
+    OSIntDisMeasOvrhd      = OSIntDisTimeCur;
+    OSIntDisTimeCur        = 0u;
+    OSIntDisTimeMax        = 0u;
+    OSSchedLockTimeCur     = 0u;
+    OSSchedLockTimeMax     = 0u;
+}
+
+
+void  OS_IntDisMeasStart (void)
+{
+    OSIntDisMeasNestingCtr++;
+    if (OSIntDisMeasNestingCtr == 1u) {                    /* Only measure at the first nested level   */
+        OSIntDisMeasTS = OS_CPU_TS_GET();
+    }
+}
+
+
+void  OS_IntDisMeasStop (void)
+{
+    INT32U  delta;
+
+
+    if (OSIntDisMeasNestingCtr > 0u) {                     /* Ignore an unbalanced stop                */
+        OSIntDisMeasNestingCtr--;
+        if (OSIntDisMeasNestingCtr == 0u) {
+            delta = OS_CPU_TS_GET() - OSIntDisMeasTS;      /* See Note #3                              */
+            if (delta > OSIntDisMeasOvrhd) {               /* Remove the overhead of the measurement   */
+                delta -= OSIntDisMeasOvrhd;
+            } else {
+                delta  = 0u;
+            }
+            OSIntDisTimeCur = delta;
+            if (delta > OSIntDisTimeMax) {                 /* Track the maximum                        */
+                OSIntDisTimeMax = delta;
+            }
+        }
+    }
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                      CLEAR A SECTION OF MEMORY
@@ -1711,8 +2333,13 @@ void  OS_Sched (void)
     if (OSIntNesting == 0u) {                          /* Schedule only if all ISRs done and ...       */
         if (OSLockNesting == 0u) {                     /* ... scheduler is not locked                  */
             OS_SchedNew();
+#if OS_SCHED_RR_EN > 0u
+            OSTCBHighRdy = OS_SchedRRNext(OSPrioHighRdy);
+            if (OSTCBHighRdy != OSTCBCur) {            /* No Ctx Sw if current task is highest rdy     */
+#else
             OSTCBHighRdy = OSTCBPrioTbl[OSPrioHighRdy];
             if (OSPrioHighRdy != OSPrioCur) {          /* No Ctx Sw if current task is highest rdy     */
+#endif
 #if OS_TASK_PROFILE_EN > 0u
                 OSTCBHighRdy->OSTCBCtxSwCtr++;         /* Inc. # of context switches to this task      */
 #endif
@@ -1722,6 +2349,9 @@ void  OS_Sched (void)
 #if defined(OS_TLS_TBL_SIZE) && (OS_TLS_TBL_SIZE > 0u)
                 OS_TLS_TaskSw();
 #endif
+#endif
+#if OS_TASK_PROFILE_TS_EN > 0u
+                OS_TaskProfileSw();                    /* Charge the task being switched out           */
 #endif
 
                 OS_TASK_SW();                          /* Perform a context switch                     */
@@ -1745,12 +2375,25 @@ void  OS_Sched (void)
 *
 * Notes      : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
 *              2) Interrupts are assumed to be disabled when this function is called.
+*              3) The lowest bit set in OSRdyGrp and OSRdyTbl[] corresponds to the highest priority.  If the
+*                 port provides OS_CPU_CNT_TRAIL_ZEROS(), which returns the number of trailing zero bits of
+*                 a non-zero value, it is used (e.g. CLZ or CTZ instructions) instead of OSUnMapTbl[].
 *********************************************************************************************************
 */
 
 static  void  OS_SchedNew (void)
 {
-#if OS_LOWEST_PRIO <= 63u                        /* See if we support up to 64 tasks                   */
+#if defined(OS_CPU_CNT_TRAIL_ZEROS)              /* See Note #3                                        */
+    INT8U   y;
+
+
+    y             = (INT8U)OS_CPU_CNT_TRAIL_ZEROS(OSRdyGrp);
+#if OS_LOWEST_PRIO <= 63u
+    OSPrioHighRdy = (INT8U)((y << 3u) + OS_CPU_CNT_TRAIL_ZEROS(OSRdyTbl[y]));
+#else
+    OSPrioHighRdy = (INT8U)((y << 4u) + OS_CPU_CNT_TRAIL_ZEROS(OSRdyTbl[y]));
+#endif
+#elif OS_LOWEST_PRIO <= 63u                      /* See if we support up to 64 tasks                   */
     INT8U   y;
 
 
@@ -1778,159 +2421,781 @@ static  void  OS_SchedNew (void)
 
 /*
 *********************************************************************************************************
-*                               DETERMINE THE LENGTH OF AN ASCII STRING
+*                                  SCHEDULER LOCK TIME MEASUREMENT
 *
-* Description: This function is called by other uC/OS-II services to determine the size of an ASCII string
-*              (excluding the NUL character).
+* Description: OS_SchedLockMeasStart() is called right after OSLockNesting is incremented and
+*              OS_SchedLockMeasStop() right after it is decremented.  Only the outermost lock is timed,
+*              from the 0 to 1 transition of OSLockNesting to the matching 1 to 0 transition.
 *
-* Arguments  : psrc     is a pointer to the string for which we need to know the size.
+* Arguments  : none
 *
-* Returns    : The size of the string (excluding the NUL terminating character)
+* Returns    : none
 *
-* Notes      : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
-*              2) The string to check must be less than 255 characters long.
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-II and your application should not call them.
+*              2) These functions MUST be called with interrupts disabled.
 *********************************************************************************************************
 */
 
-#if (OS_EVENT_NAME_EN > 0u) || (OS_FLAG_NAME_EN > 0u) || (OS_MEM_NAME_EN > 0u) || (OS_TASK_NAME_EN > 0u) || (OS_TMR_CFG_NAME_EN > 0u)
-INT8U  OS_StrLen (INT8U *psrc)
+#if OS_INT_DIS_MEAS_EN > 0u
+void  OS_SchedLockMeasStart (void)
 {
-    INT8U  len;
+    if (OSLockNesting == 1u) {                   /* Only measure the outermost lock                    */
+        OSSchedLockTS = OS_CPU_TS_GET();
+    }
+}
 
 
-#if OS_ARG_CHK_EN > 0u
-    if (psrc == (INT8U *)0) {
-        return (0u);
-    }
-#endif
+void  OS_SchedLockMeasStop (void)
+{
+    INT32U  delta;
 
-    len = 0u;
-    while (*psrc != OS_ASCII_NUL) {
-        psrc++;
-        len++;
+
+    if (OSLockNesting == 0u) {                   /* Scheduler is unlocked                              */
+        delta              = OS_CPU_TS_GET() - OSSchedLockTS;
+        OSSchedLockTimeCur = delta;
+        if (delta > OSSchedLockTimeMax) {        /* Track the maximum                                  */
+            OSSchedLockTimeMax = delta;
+        }
     }
-    return (len);
 }
 #endif
 
 
 /*
 *********************************************************************************************************
-*                                              IDLE TASK
+*                                        PER-TASK RUN TIME PROFILING
 *
-* Description: This task is internal to uC/OS-II and executes whenever no other higher priority tasks
-*              executes because they are ALL waiting for event(s) to occur.
+* Description: When OS_TASK_PROFILE_EN is set to 1 and the port provides OS_CPU_TS_GET(), the kernel
+*              accumulates in OSTCBCyclesTot the number of timestamp counts each task has been running.
+*
+*              OS_TaskProfileSw()        is called by OS_Sched() and OSIntExit() right before a context
+*                                        switch.  It charges OSTCBCur for the time elapsed since it was
+*                                        switched in (or since the last ISR returned to it) and marks the
+*                                        start of OSTCBHighRdy.
+*
+*              OS_TaskProfileIntEnter()  is called by OSIntEnter() when the outermost ISR starts.  It
+*                                        charges OSTCBCur and starts measuring the ISR time.
+*
+*              OS_TaskProfileIntExit()   is called by OSIntExit() when the outermost ISR completes.  It
+*                                        adds the ISR time to OSIntCyclesTot and resumes charging
+*                                        OSTCBCur.
 *
 * Arguments  : none
 *
 * Returns    : none
 *
-* Note(s)    : 1) OSTaskIdleHook() is called after the critical section to ensure that interrupts will be
-*                 enabled for at least a few instructions.  On some processors (ex. Philips XA), enabling
-*                 and then disabling interrupts didn't allow the processor enough time to have interrupts
-*                 enabled before they were disabled again.  uC/OS-II would thus never recognize
-*                 interrupts.
-*              2) This hook has been added to allow you to do such things as STOP the CPU to conserve
-*                 power.
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-II and MUST be called with interrupts disabled.
+*
+*              2) The totals wrap around.  The differences computed by OS_TaskStatCPUUsage() remain valid
+*                 as long as the statistics period is shorter than the period of the timestamp.
 *********************************************************************************************************
 */
 
-void  OS_TaskIdle (void *p_arg)
+#if OS_TASK_PROFILE_TS_EN > 0u
+static  void  OS_TaskProfileSw (void)
 {
-#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
-    OS_CPU_SR  cpu_sr = 0u;
-#endif
+    INT32U  ts;
 
-    (void)p_arg;                                 /* Prevent compiler warning for not using 'p_arg'     */
-    for (;;) {
-        OS_ENTER_CRITICAL();
-        OSIdleCtr++;
-        OS_EXIT_CRITICAL();
-        OSTaskIdleHook();                        /* Call user definable HOOK                           */
+
+    ts                              = OS_CPU_TS_GET();
+    OSTCBCur->OSTCBCyclesTot       += ts - OSTCBCur->OSTCBCyclesStart;
+    OSTCBHighRdy->OSTCBCyclesStart  = ts;
+}
+
+
+static  void  OS_TaskProfileIntEnter (void)
+{
+    INT32U  ts;
+
+
+    ts                        = OS_CPU_TS_GET();
+    OSTCBCur->OSTCBCyclesTot += ts - OSTCBCur->OSTCBCyclesStart;
+    OSIntCyclesStart          = ts;
+    OSIntCyclesRun            = OS_TRUE;
+}
+
+
+static  void  OS_TaskProfileIntExit (void)
+{
+    INT32U  ts;
+
+
+    if (OSIntCyclesRun == OS_TRUE) {             /* Only if the outermost ISR called OSIntEnter()      */
+        ts                         = OS_CPU_TS_GET();
+        OSIntCyclesTot            += ts - OSIntCyclesStart;
+        OSTCBCur->OSTCBCyclesStart = ts;
+        OSIntCyclesRun             = OS_FALSE;
     }
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                           STATISTICS TASK
+*                                  ROUND-ROBIN: LISTS OF TASKS PER PRIORITY
 *
-* Description: This task is internal to uC/OS-II and is used to compute some statistics about the
-*              multitasking environment.  Specifically, OS_TaskStat() computes the CPU usage.
-*              CPU usage is determined by:
+* Description: When OS_SCHED_RR_EN is set to 1, several tasks can share a priority.  OSTCBPrioTbl[prio]
+*              then points to the first of a list of the TCBs at 'prio', linked through OSTCBPrioNext.
+*              The OSTCBPrioPrev link of the first TCB points to the last one so that tasks can be
+*              appended without walking the list.  OSRdyTbl[] and the event wait lists keep one bit per
+*              priority which is set as long as at least one of the tasks at that priority is ready
+*              (or waiting for the event).
 *
-*                                          OSIdleCtr
-*                 OSCPUUsage = 100 * (1 - ------------)     (units are in %)
-*                                         OSIdleCtrMax
+*              OS_SchedRRInsert()        appends 'ptcb' to the list of its priority.  A priority reserved
+*                                        with OS_TCB_RESERVED (i.e. a mutex PCP) is taken over.
 *
-* Arguments  : parg     this pointer is not used at this time.
+*              OS_SchedRRRemove()        unlinks 'ptcb' from the list of its priority.
 *
-* Returns    : none
+*              OS_SchedRRNext()          returns the task to run at 'prio': the current task unless its
+*                                        time quanta expired or it is not ready anymore, otherwise the
+*                                        first ready task in the list.  A task that starts a new time
+*                                        quanta gets its counter reloaded.
 *
-* Notes      : 1) This task runs at a priority level higher than the idle task.  In fact, it runs at the
-*                 next higher priority, OS_TASK_IDLE_PRIO-1.
-*              2) You can disable this task by setting the configuration #define OS_TASK_STAT_EN to 0.
-*              3) You MUST have at least a delay of 2/10 seconds to allow for the system to establish the
-*                 maximum value for the idle counter.
+*              OS_SchedRRRdyRestore()    must be called after the ready bit of 'ptcb' was cleared and sets
+*                                        it back if another task at the same priority is still ready.
+*
+*              OS_SchedRREventTCB()      returns the first task at 'prio' waiting for 'pevent'.
+*
+*              OS_SchedRREventRestore()  must be called after the wait list bit of 'ptcb' was cleared in
+*                                        'pevent' and sets it back if another task at the same priority
+*                                        is still waiting for 'pevent'.
+*
+* Arguments  : ptcb      is a pointer to the TCB of the task.
+*
+*              prio      is the priority to look at.
+*
+*              pevent    is a pointer to the event control block.
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-II and your application should not call them.
+*              2) These functions assume that interrupts are disabled.
+*              3) A task readied by an event is moved to the end of the list of its priority (see
+*                 OS_EventTaskRdy()) so that it doesn't get ahead of the tasks that were already ready.
 *********************************************************************************************************
 */
 
-#if OS_TASK_STAT_EN > 0u
-void  OS_TaskStat (void *p_arg)
+#if OS_SCHED_RR_EN > 0u
+void  OS_SchedRRInsert (OS_TCB  *ptcb)
 {
-    INT8S  usage;
-#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
-    OS_CPU_SR  cpu_sr = 0u;
-#endif
-
-
-
-    p_arg = p_arg;                               /* Prevent compiler warning for not using 'p_arg'     */
-    while (OSStatRdy == OS_FALSE) {
-        OSTimeDly(2u * OS_TICKS_PER_SEC / 10u);  /* Wait until statistic task is ready                 */
-    }
-    OSIdleCtrMax /= 100uL;
-    if (OSIdleCtrMax == 0uL) {
-        OSCPUUsage = 0u;
-#if OS_TASK_SUSPEND_EN > 0u
-        (void)OSTaskSuspend(OS_PRIO_SELF);
-#else
-        for (;;) {
-            OSTimeDly(OS_TICKS_PER_SEC);
-        }
-#endif
+    OS_TCB  *phead;
+
+
+    phead               = OSTCBPrioTbl[ptcb->OSTCBPrio];
+    ptcb->OSTCBPrioNext = (OS_TCB *)0;
+    if ((phead == (OS_TCB *)0) ||
+        (phead == OS_TCB_RESERVED)) {                /* See if first task at this priority             */
+        ptcb->OSTCBPrioPrev           = ptcb;
+        OSTCBPrioTbl[ptcb->OSTCBPrio] = ptcb;
+    } else {                                         /* No, append after the last task                 */
+        ptcb->OSTCBPrioPrev                 = phead->OSTCBPrioPrev;
+        phead->OSTCBPrioPrev->OSTCBPrioNext = ptcb;
+        phead->OSTCBPrioPrev                = ptcb;
     }
-    OS_ENTER_CRITICAL();
-    OSIdleCtr = OSIdleCtrMax * 100uL;            /* Set initial CPU usage as 0%                        */
-    OS_EXIT_CRITICAL();
-    for (;;) {
-        OSTimeDly(1);                            /* Synchronize with clock tick                        */
+}
 
-        OS_ENTER_CRITICAL();
-        OSIdleCtr = 0uL;                        /* Reset the idle counter for the next second         */
-        OS_EXIT_CRITICAL();
 
-        OSTimeDly(OS_TICKS_PER_SEC / 10u);       /* Accumulate OSIdleCtr for the next 1/10 second      */
+void  OS_SchedRRRemove (OS_TCB  *ptcb)
+{
+    OS_TCB  *phead;
+    OS_TCB  *pnext;
 
-        OS_ENTER_CRITICAL();
-        OSIdleCtrRun = OSIdleCtr;                /* Store number of cycles which elapsed while idle    */
-        OS_EXIT_CRITICAL();
 
-        usage            = 100 - (INT8S)(OSIdleCtrRun / OSIdleCtrMax);
-        if (usage >= 0) {                        /* Make sure we don't have a negative percentage      */
-            OSCPUUsage   = (INT8U)usage;
+    phead = OSTCBPrioTbl[ptcb->OSTCBPrio];
+    pnext = ptcb->OSTCBPrioNext;
+    if (ptcb == phead) {                             /* See if removing the first task                 */
+        OSTCBPrioTbl[ptcb->OSTCBPrio] = pnext;
+        if (pnext != (OS_TCB *)0) {
+            pnext->OSTCBPrioPrev = ptcb->OSTCBPrioPrev; /* New first task points to the last one       */
+        }
+    } else {
+        ptcb->OSTCBPrioPrev->OSTCBPrioNext = pnext;
+        if (pnext != (OS_TCB *)0) {
+            pnext->OSTCBPrioPrev = ptcb->OSTCBPrioPrev;
         } else {
-            OSCPUUsage   = 0u;
-            OSIdleCtrMax = OSIdleCtrRun / 100uL; /* Update max counter value to current one            */
+            phead->OSTCBPrioPrev = ptcb->OSTCBPrioPrev; /* Removing the last task                      */
         }
-
-        OSTaskStatHook();                        /* Invoke user definable hook                         */
-#if (OS_TASK_STAT_STK_CHK_EN > 0u) && (OS_TASK_CREATE_EXT_EN > 0u)
-        OS_TaskStatStkChk();                     /* Check the stacks for each task                     */
-#endif
     }
+    ptcb->OSTCBPrioNext = (OS_TCB *)0;
+    ptcb->OSTCBPrioPrev = (OS_TCB *)0;               /* Indicate that the task is not linked           */
 }
-#endif
+
+
+OS_TCB  *OS_SchedRRNext (INT8U  prio)
+{
+    OS_TCB  *ptcb;
+
+
+    ptcb = OSTCBCur;
+    if (ptcb != (OS_TCB *)0) {                       /* Let the current task use up its time quanta    */
+        if ((ptcb->OSTCBPrio          == prio)        &&
+            (ptcb->OSTCBPrioPrev      != (OS_TCB *)0) &&
+            (ptcb->OSTCBTimeQuantaCtr != 0u)          &&
+            (OS_SchedRRIsRdy(ptcb)    == OS_TRUE)) {
+            return (ptcb);
+        }
+    }
+    ptcb = OSTCBPrioTbl[prio];
+    while (ptcb != (OS_TCB *)0) {                    /* Find the first ready task                      */
+        if (OS_SchedRRIsRdy(ptcb) == OS_TRUE) {
+            if (ptcb->OSTCBTimeQuantaCtr == 0u) {    /* Start a new time quanta                        */
+                if (ptcb->OSTCBTimeQuanta != 0u) {
+                    ptcb->OSTCBTimeQuantaCtr = ptcb->OSTCBTimeQuanta;
+                } else {
+                    ptcb->OSTCBTimeQuantaCtr = OSSchedRRDfltTimeQuanta;
+                }
+            }
+            return (ptcb);
+        }
+        ptcb = ptcb->OSTCBPrioNext;
+    }
+    return (OSTCBPrioTbl[prio]);
+}
+
+
+void  OS_SchedRRRdyRestore (OS_TCB  *ptcb)
+{
+    if (OS_SchedRRRdyOther(ptcb) != (OS_TCB *)0) {
+        OSRdyGrp               |= ptcb->OSTCBBitY;
+        OSRdyTbl[ptcb->OSTCBY] |=  ptcb->OSTCBBitX;
+    }
+}
+
+
+#if (OS_EVENT_EN)
+OS_TCB  *OS_SchedRREventTCB (INT8U      prio,
+                             OS_EVENT  *pevent)
+{
+    OS_TCB  *ptcb;
+
+
+    ptcb = OSTCBPrioTbl[prio];
+    while (ptcb != (OS_TCB *)0) {
+        if (OS_SchedRRIsWaiting(ptcb, pevent) == OS_TRUE) {
+            return (ptcb);
+        }
+        ptcb = ptcb->OSTCBPrioNext;
+    }
+    return (OSTCBPrioTbl[prio]);
+}
+
+
+void  OS_SchedRREventRestore (OS_TCB    *ptcb,
+                              OS_EVENT  *pevent)
+{
+    OS_TCB  *pnext;
+
+
+    pnext = OSTCBPrioTbl[ptcb->OSTCBPrio];
+    while (pnext != (OS_TCB *)0) {
+        if ((pnext != ptcb) &&
+            (OS_SchedRRIsWaiting(pnext, pevent) == OS_TRUE)) {
+            pevent->OSEventGrp                |= ptcb->OSTCBBitY;
+            pevent->OSEventTbl[ptcb->OSTCBY]  |= ptcb->OSTCBBitX;
+            return;
+        }
+        pnext = pnext->OSTCBPrioNext;
+    }
+}
+#endif
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  ROUND-ROBIN: STATE OF A TASK IN ITS LIST
+*
+* Description: OS_SchedRRIsRdy() determines whether a task is ready to run from its state (the ready list
+*              only tells whether a priority is ready).
+*
+*              OS_SchedRRRdyOther() returns the first task, other than 'ptcb', which is ready to run at the
+*              priority of 'ptcb' or, a NULL pointer if there is none.
+*
+*              OS_SchedRRIsWaiting() determines whether a task waits for an event, alone or as part of a
+*              call to OSEventPendMulti().
+*
+*              OS_SchedRRTick() charges a tick to the time quanta of the current task.  When it expires
+*              and another task at the same priority is ready, the current task is moved to the end of
+*              the list of its priority and OS_SchedRRNext() selects the next one.
+*
+* Arguments  : ptcb      is a pointer to the TCB of the task.
+*
+*              pevent    is a pointer to the event control block.
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-II and your application should not call them.
+*              2) These functions assume that interrupts are disabled.
+*********************************************************************************************************
+*/
+
+#if OS_SCHED_RR_EN > 0u
+BOOLEAN  OS_SchedRRIsRdy (OS_TCB  *ptcb)
+{
+    if (((ptcb->OSTCBStat & (OS_STAT_PEND_ANY | OS_STAT_SUSPEND)) == OS_STAT_RDY) &&
+         (ptcb->OSTCBDly == 0u)) {
+        return (OS_TRUE);
+    }
+    return (OS_FALSE);
+}
+
+
+static  OS_TCB  *OS_SchedRRRdyOther (OS_TCB  *ptcb)
+{
+    OS_TCB  *pnext;
+
+
+    pnext = OSTCBPrioTbl[ptcb->OSTCBPrio];
+    while (pnext != (OS_TCB *)0) {
+        if ((pnext != ptcb) &&
+            (OS_SchedRRIsRdy(pnext) == OS_TRUE)) {
+            return (pnext);
+        }
+        pnext = pnext->OSTCBPrioNext;
+    }
+    return ((OS_TCB *)0);
+}
+
+
+#if (OS_EVENT_EN)
+static  BOOLEAN  OS_SchedRRIsWaiting (OS_TCB    *ptcb,
+                                      OS_EVENT  *pevent)
+{
+#if (OS_EVENT_MULTI_EN > 0u)
+    OS_EVENT  **pevents;
+#endif
+
+
+    if (ptcb->OSTCBEventPtr == pevent) {
+        return (OS_TRUE);
+    }
+#if (OS_EVENT_MULTI_EN > 0u)
+    pevents = ptcb->OSTCBEventMultiPtr;
+    if (pevents != (OS_EVENT **)0) {
+        while (*pevents != (OS_EVENT *)0) {
+            if (*pevents == pevent) {
+                return (OS_TRUE);
+            }
+            pevents++;
+        }
+    }
+#endif
+    return (OS_FALSE);
+}
+#endif
+
+
+static  void  OS_SchedRRTick (void)
+{
+    OS_TCB  *ptcb;
+
+
+    ptcb = OSTCBCur;
+    if (OSSchedRREn == OS_FALSE) {
+        return;
+    }
+    if ((ptcb->OSTCBPrioPrev == ptcb) ||             /* Alone at its priority or, being deleted        */
+        (ptcb->OSTCBPrioPrev == (OS_TCB *)0)) {
+        return;
+    }
+    if (ptcb->OSTCBTimeQuantaCtr == 0u) {            /* Expired, waiting for the scheduler to run      */
+        return;
+    }
+    ptcb->OSTCBTimeQuantaCtr--;
+    if (ptcb->OSTCBTimeQuantaCtr > 0u) {
+        return;
+    }
+    if (OS_SchedRRRdyOther(ptcb) != (OS_TCB *)0) {   /* Time quanta expired, let the next task run     */
+        OS_SchedRRRemove(ptcb);
+        OS_SchedRRInsert(ptcb);
+    } else if (ptcb->OSTCBTimeQuanta != 0u) {        /* No other task is ready, start a new quanta     */
+        ptcb->OSTCBTimeQuantaCtr = ptcb->OSTCBTimeQuanta;
+    } else {
+        ptcb->OSTCBTimeQuantaCtr = OSSchedRRDfltTimeQuanta;
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                               DETERMINE THE LENGTH OF AN ASCII STRING
+*
+* Description: This function is called by other uC/OS-II services to determine the size of an ASCII string
+*              (excluding the NUL character).
+*
+* Arguments  : psrc     is a pointer to the string for which we need to know the size.
+*
+* Returns    : The size of the string (excluding the NUL terminating character)
+*
+* Notes      : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) The string to check must be less than 255 characters long.
+*********************************************************************************************************
+*/
+
+#if (OS_EVENT_NAME_EN > 0u) || (OS_FLAG_NAME_EN > 0u) || (OS_MEM_NAME_EN > 0u) || (OS_TASK_NAME_EN > 0u) || (OS_TMR_CFG_NAME_EN > 0u)
+INT8U  OS_StrLen (INT8U *psrc)
+{
+    INT8U  len;
+
+
+#if OS_ARG_CHK_EN > 0u
+    if (psrc == (INT8U *)0) {
+        return (0u);
+    }
+#endif
+
+    len = 0u;
+    while (*psrc != OS_ASCII_NUL) {
+        psrc++;
+        len++;
+    }
+    return (len);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                              IDLE TASK
+*
+* Description: This task is internal to uC/OS-II and executes whenever no other higher priority tasks
+*              executes because they are ALL waiting for event(s) to occur.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) OSTaskIdleHook() is called after the critical section to ensure that interrupts will be
+*                 enabled for at least a few instructions.  On some processors (ex. Philips XA), enabling
+*                 and then disabling interrupts didn't allow the processor enough time to have interrupts
+*                 enabled before they were disabled again.  uC/OS-II would thus never recognize
+*                 interrupts.
+*              2) This hook has been added to allow you to do such things as STOP the CPU to conserve
+*                 power.
+*              3) When OS_TICKLESS_EN is set to 1 and no task delay or timer expires on the next tick, the
+*                 tick interrupt is suppressed until the earliest expiry by OSTaskIdleTicklessHook() and
+*                 the ticks which elapsed meanwhile are processed at once by OSTimeTickN().  The
+*                 scheduler is locked while doing so, the task(s) made ready run when it is unlocked.
+*                 Note that OSIdleCtr only counts once per suppressed period in this case.
+*              4) When nothing is pending at all, the port is asked for OS_TICKLESS_TICKS_MAX ticks and
+*                 sleeps for as long as its timer allows.
+*              5) The delays and timers are scanned with interrupts enabled between entries.  Any ISR
+*                 which ran meanwhile (OSIntExitCtr changed) may have altered them, the tick is then not
+*                 suppressed and the scan is started over on the next pass.
+*********************************************************************************************************
+*/
+
+void  OS_TaskIdle (void *p_arg)
+{
+#if OS_TICKLESS_EN > 0u
+    INT32U     ticks;
+    INT32U     int_ctr;
+#endif
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+    (void)p_arg;                                 /* Prevent compiler warning for not using 'p_arg'     */
+    for (;;) {
+        OS_ENTER_CRITICAL();
+        OSIdleCtr++;
+#if OS_TICKLESS_EN > 0u
+        int_ctr = OSIntExitCtr;
+        OS_EXIT_CRITICAL();
+        ticks   = OS_TicklessTicksGet(int_ctr);  /* Nbr of ticks to the next delay or timer expiry     */
+        if (ticks == 0u) {                       /* See Note #4                                        */
+            ticks = OS_TICKLESS_TICKS_MAX;
+        }
+        OS_ENTER_CRITICAL();
+        if ((ticks > 1u) && (int_ctr == OSIntExitCtr)) {   /* See Note #5                              */
+            ticks = OSTaskIdleTicklessHook(ticks);   /* Sleep, returns nbr of ticks which elapsed      */
+            if (ticks > 0u) {
+                OSLockNesting++;                 /* See Note #3                                        */
+#if OS_INT_DIS_MEAS_EN > 0u
+                OS_SchedLockMeasStart();
+#endif
+            }
+            OS_EXIT_CRITICAL();
+            if (ticks > 0u) {
+                OSTimeTickN(ticks);
+                OS_ENTER_CRITICAL();
+                OSLockNesting--;
+#if OS_INT_DIS_MEAS_EN > 0u
+                OS_SchedLockMeasStop();
+#endif
+                OS_EXIT_CRITICAL();
+                OS_Sched();
+            }
+            continue;
+        }
+#endif
+        OS_EXIT_CRITICAL();
+        OSTaskIdleHook();                        /* Call user definable HOOK                           */
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        TICK SUPPRESSION SUPPORT
+*
+* Description: OS_TicklessTicksGet() returns the number of ticks until the earliest task delay or timeout
+*              expires or, when timers are enabled, until the timer task may have to run.  0 is returned
+*              when nothing is pending.
+*
+* Arguments  : int_ctr   is the value of OSIntExitCtr when the idle task started the scan.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) This function is called with interrupts enabled and only disables them to read one
+*                 entry at a time.  Since the idle task is the only one ready, the task and timer lists
+*                 can only change if an ISR runs.  The scan is abandoned, and 1 returned so that the tick
+*                 is not suppressed, as soon as OSIntExitCtr no longer matches 'int_ctr'.
+*              3) The timer task is signaled by the port every (OS_TICKS_PER_SEC / OS_TMR_CFG_TICKS_PER_SEC)
+*                 ticks.  OSTmrTickCtr holds the number of ticks since the last signal and thus gives the
+*                 number of ticks to the next one.  If the port signals the timer task from another time
+*                 base, the remaining timer time is converted to the smallest number of ticks it could
+*                 correspond to.  When OS_TMR_CFG_TICK_EN is set to 1, the timers are processed on every
+*                 tick and the remaining timer time already is a number of ticks.
+*********************************************************************************************************
+*/
+
+#if OS_TICKLESS_EN > 0u
+static  INT32U  OS_TicklessTicksGet (INT32U  int_ctr)
+{
+    INT32U     ticks;
+#if OS_TICK_LIST_EN == 0u
+    OS_TCB    *ptcb;
+#endif
+#if OS_TMR_EN > 0u
+    INT32U     tmr_ticks;
+#if OS_TMR_CFG_TICK_EN == 0u
+    INT32U     tmr_ratio;
+    INT32U     tmr_first;
+#endif
+#endif
+#if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register     */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+    ticks = 0u;
+    OS_ENTER_CRITICAL();
+#if OS_TICK_LIST_EN > 0u
+    if (OSTickList != (OS_TCB *)0) {                       /* Head of the list expires first               */
+        ticks = OSTickList->OSTCBTickDelta;
+    }
+#else
+    ptcb  = OSTCBList;
+    while (ptcb->OSTCBPrio != OS_TASK_IDLE_PRIO) {         /* Find the shortest delay or timeout           */
+        if (ptcb->OSTCBDly != 0u) {
+            if ((ticks == 0u) || (ptcb->OSTCBDly < ticks)) {
+                ticks = ptcb->OSTCBDly;
+            }
+        }
+        ptcb = ptcb->OSTCBNext;
+        OS_EXIT_CRITICAL();                                /* See Note #2                                  */
+        OS_ENTER_CRITICAL();
+        if (int_ctr != OSIntExitCtr) {
+            OS_EXIT_CRITICAL();
+            return (1u);
+        }
+    }
+#endif
+    OS_EXIT_CRITICAL();
+
+#if OS_TMR_EN > 0u
+    tmr_ticks = OSTmr_NextGet(int_ctr);
+#if OS_TMR_CFG_TICK_EN > 0u
+    if (tmr_ticks != 0u) {                                 /* See Note #3                                  */
+        if ((ticks == 0u) || (tmr_ticks < ticks)) {
+            ticks = tmr_ticks;
+        }
+    }
+#else
+    if (tmr_ticks != 0u) {                                 /* See Note #3                                  */
+        tmr_ratio = OS_TICKS_PER_SEC / OS_TMR_CFG_TICKS_PER_SEC;
+        tmr_first = 1u;                                    /* Ticks to the next signal of the timer task   */
+        OS_ENTER_CRITICAL();
+        if (OSTmrTickCtr < tmr_ratio) {
+            tmr_first = tmr_ratio - OSTmrTickCtr;
+        }
+        OS_EXIT_CRITICAL();
+        if ((tmr_ticks - 1u) < ((0xFFFFFFFFuL - tmr_first) / tmr_ratio)) {
+            tmr_ticks = ((tmr_ticks - 1u) * tmr_ratio) + tmr_first;
+            if ((ticks == 0u) || (tmr_ticks < ticks)) {
+                ticks = tmr_ticks;
+            }
+        }
+    }
+#endif
+#endif
+    return (ticks);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   TASK DELAY OR TIMEOUT EXPIRED
+*
+* Description: This function updates the state of a task whose delay or timeout just expired and makes it
+*              ready to run unless it is suspended.  It is called by OSTimeTick() when the delayed tasks
+*              are kept in the tick list, and by OSTimeTickN().
+*
+* Arguments  : ptcb      is a pointer to the TCB of the task.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) This function assumes that interrupts are disabled.
+*********************************************************************************************************
+*/
+
+#if (OS_TICK_LIST_EN > 0u) || (OS_TICKLESS_EN > 0u)
+static  void  OS_TickExpire (OS_TCB  *ptcb)
+{
+    if ((ptcb->OSTCBStat & OS_STAT_PEND_ANY) != OS_STAT_RDY) {
+        ptcb->OSTCBStat  &= (INT8U)~(INT8U)OS_STAT_PEND_ANY;   /* Yes, Clear status flag               */
+        ptcb->OSTCBStatPend = OS_STAT_PEND_TO;                 /* Indicate PEND timeout                */
+    } else {
+        ptcb->OSTCBStatPend = OS_STAT_PEND_OK;
+    }
+
+    if ((ptcb->OSTCBStat & OS_STAT_SUSPEND) == OS_STAT_RDY) {  /* Is task suspended?                   */
+        OSRdyGrp               |= ptcb->OSTCBBitY;             /* No,  Make ready                      */
+        OSRdyTbl[ptcb->OSTCBY] |=  ptcb->OSTCBBitX;
+        OS_TRACE_TASK_READY(ptcb);
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           STATISTICS TASK
+*
+* Description: This task is internal to uC/OS-II and is used to compute some statistics about the
+*              multitasking environment.  Specifically, OS_TaskStat() computes the CPU usage.
+*              CPU usage is determined by:
+*
+*                                          OSIdleCtr
+*                 OSCPUUsage = 100 * (1 - ------------)     (units are in %)
+*                                         OSIdleCtrMax
+*
+*              When the kernel profiles the tasks (see OS_TaskProfileSw()), the CPU usage of each task is
+*              also computed in its OSTCBCPUUsage and the CPU usage of the ISRs in OSIntCPUUsage (see
+*              OS_TaskStatCPUUsage()).
+*
+*              When OS_TASK_STAT_TS_EN is set to 1, the idle counter is not used.  The CPU usage is
+*              computed every OS_TASK_STAT_WINDOW ticks from the time the idle task actually ran:
+*
+*                 OSCPUUsageHiRes = 10000 - OSTCBCPUUsage of the idle task    (units are 0.01 %)
+*
+*                 OSCPUUsage      = OSCPUUsageHiRes / 100                     (units are in %)
+*
+*              This remains exact when the idle task is preempted or when OSTaskIdleHook() puts the CPU
+*              to sleep, as long as OS_CPU_TS_GET() keeps counting while the CPU sleeps.
+*
+* Arguments  : parg     this pointer is not used at this time.
+*
+* Returns    : none
+*
+* Notes      : 1) This task runs at a priority level higher than the idle task.  In fact, it runs at the
+*                 next higher priority, OS_TASK_IDLE_PRIO-1.
+*              2) You can disable this task by setting the configuration #define OS_TASK_STAT_EN to 0.
+*              3) You MUST have at least a delay of 2/10 seconds to allow for the system to establish the
+*                 maximum value for the idle counter.  This does not apply when OS_TASK_STAT_TS_EN is 1.
+*********************************************************************************************************
+*/
+
+#if (OS_TASK_STAT_EN > 0u) && (OS_TASK_STAT_TS_EN > 0u)
+void  OS_TaskStat (void *p_arg)
+{
+    OS_TCB  *ptcb;
+    INT16U   usage;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+    p_arg = p_arg;                               /* Prevent compiler warning for not using 'p_arg'     */
+    for (;;) {
+        OSTimeDly(OS_TASK_STAT_WINDOW);          /* Accumulate the run times over the next window      */
+
+        OS_TaskStatCPUUsage();                   /* Compute the CPU usage of each task                 */
+
+        OS_ENTER_CRITICAL();
+        ptcb            = OSTCBPrioTbl[OS_TASK_IDLE_PRIO];
+        usage           = 10000u - ptcb->OSTCBCPUUsage;  /* Everything but the idle task               */
+        OSCPUUsageHiRes = usage;
+        OSCPUUsage      = (INT8U)(usage / 100u);
+        OS_EXIT_CRITICAL();
+
+        OSTaskStatHook();                        /* Invoke user definable hook                         */
+#if (OS_TASK_STAT_STK_CHK_EN > 0u) && (OS_TASK_CREATE_EXT_EN > 0u)
+        OS_TaskStatStkChk();                     /* Check the stacks for each task                     */
+#endif
+    }
+}
+#endif
+
+#if (OS_TASK_STAT_EN > 0u) && (OS_TASK_STAT_TS_EN == 0u)
+void  OS_TaskStat (void *p_arg)
+{
+    INT8S  usage;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+    p_arg = p_arg;                               /* Prevent compiler warning for not using 'p_arg'     */
+    while (OSStatRdy == OS_FALSE) {
+        OSTimeDly(2u * OS_TICKS_PER_SEC / 10u);  /* Wait until statistic task is ready                 */
+    }
+    OSIdleCtrMax /= 100uL;
+    if (OSIdleCtrMax == 0uL) {
+        OSCPUUsage = 0u;
+#if OS_TASK_SUSPEND_EN > 0u
+        (void)OSTaskSuspend(OS_PRIO_SELF);
+#else
+        for (;;) {
+            OSTimeDly(OS_TICKS_PER_SEC);
+        }
+#endif
+    }
+    OS_ENTER_CRITICAL();
+    OSIdleCtr = OSIdleCtrMax * 100uL;            /* Set initial CPU usage as 0%                        */
+    OS_EXIT_CRITICAL();
+    for (;;) {
+        OSTimeDly(1);                            /* Synchronize with clock tick                        */
+
+        OS_ENTER_CRITICAL();
+        OSIdleCtr = 0uL;                        /* Reset the idle counter for the next second         */
+        OS_EXIT_CRITICAL();
+
+        OSTimeDly(OS_TICKS_PER_SEC / 10u);       /* Accumulate OSIdleCtr for the next 1/10 second      */
+
+        OS_ENTER_CRITICAL();
+        OSIdleCtrRun = OSIdleCtr;                /* Store number of cycles which elapsed while idle    */
+        OS_EXIT_CRITICAL();
+
+        usage            = 100 - (INT8S)(OSIdleCtrRun / OSIdleCtrMax);
+        if (usage >= 0) {                        /* Make sure we don't have a negative percentage      */
+            OSCPUUsage   = (INT8U)usage;
+        } else {
+            OSCPUUsage   = 0u;
+            OSIdleCtrMax = OSIdleCtrRun / 100uL; /* Update max counter value to current one            */
+        }
+
+#if OS_TASK_PROFILE_TS_EN > 0u
+        OS_TaskStatCPUUsage();                   /* Compute the CPU usage of each task                 */
+#endif
+        OSTaskStatHook();                        /* Invoke user definable hook                         */
+#if (OS_TASK_STAT_STK_CHK_EN > 0u) && (OS_TASK_CREATE_EXT_EN > 0u)
+        OS_TaskStatStkChk();                     /* Check the stacks for each task                     */
+#endif
+    }
+}
+#endif
 
 
 /*
@@ -1976,6 +3241,117 @@ void  OS_TaskStatStkChk (void)
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                      COMPUTE PER-TASK CPU USAGE
+*
+* Description: This function is called by OS_TaskStat() to compute the CPU usage of each task, and of the
+*              ISRs, over the period elapsed since the previous call:
+*
+*                                           OSTCBCyclesTot - OSTCBCyclesTotPrev
+*                 OSTCBCPUUsage = 10000 * --------------------------------------   (units are 0.01 %)
+*                                         timestamp counts elapsed since OSStatTS
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) The scheduler is locked while the list of tasks is walked so that no task gets deleted
+*                 under our feet.  Interrupts are only disabled while a single task is processed.
+*
+*              2) The time slice of the running task (i.e. the statistic task) which is in progress is
+*                 included in its total.
+*
+*              3) The usage of the tasks and of the ISRs adds up to about 10000.
+*********************************************************************************************************
+*/
+
+#if (OS_TASK_STAT_EN > 0u) && (OS_TASK_PROFILE_TS_EN > 0u)
+void  OS_TaskStatCPUUsage (void)
+{
+    OS_TCB     *ptcb;
+    INT32U      ts;
+    INT32U      window;
+    INT32U      cycles;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR   cpu_sr = 0u;
+#endif
+
+
+
+    OS_ENTER_CRITICAL();
+    ts                 = OS_CPU_TS_GET();
+    window             = ts - OSStatTS;          /* Length of the statistics period                    */
+    OSStatTS           = ts;
+    cycles             = OSIntCyclesTot - OSIntCyclesTotPrev;
+    OSIntCyclesTotPrev = OSIntCyclesTot;
+    OSIntCPUUsage      = OS_TaskStatUsageCalc(cycles, window);
+    OSLockNesting++;                             /* See Note #1                                        */
+#if OS_INT_DIS_MEAS_EN > 0u
+    OS_SchedLockMeasStart();
+#endif
+    ptcb               = OSTCBList;
+    OS_EXIT_CRITICAL();
+
+    while (ptcb != (OS_TCB *)0) {
+        OS_ENTER_CRITICAL();
+        cycles = ptcb->OSTCBCyclesTot;
+        if (ptcb == OSTCBCur) {                  /* See Note #2                                        */
+            cycles += OS_CPU_TS_GET() - ptcb->OSTCBCyclesStart;
+        }
+        ptcb->OSTCBCPUUsage      = OS_TaskStatUsageCalc(cycles - ptcb->OSTCBCyclesTotPrev, window);
+        ptcb->OSTCBCyclesTotPrev = cycles;
+        ptcb                     = ptcb->OSTCBNext;
+        OS_EXIT_CRITICAL();
+    }
+
+    OS_ENTER_CRITICAL();
+    OSLockNesting--;
+#if OS_INT_DIS_MEAS_EN > 0u
+    OS_SchedLockMeasStop();
+#endif
+    OS_EXIT_CRITICAL();
+    OS_Sched();                                  /* Run the tasks readied while locked                 */
+}
+
+
+/*
+*********************************************************************************************************
+*                                    CONVERT CYCLES TO A CPU USAGE
+*
+* Description: This function converts a number of cycles spent over a period of 'window' cycles into a
+*              CPU usage in 0.01 % units, without requiring 64-bit arithmetic.
+*
+* Arguments  : cycles     is the number of cycles spent running.
+*
+*              window     is the length of the period, in cycles.
+*
+* Returns    : the CPU usage, from 0 to 10000.
+*********************************************************************************************************
+*/
+
+static  INT16U  OS_TaskStatUsageCalc (INT32U  cycles,
+                                      INT32U  window)
+{
+    INT32U  usage;
+
+
+    if (window == 0u) {
+        return (0u);
+    }
+    if (window >= 10000u) {                      /* Scale the period down to avoid overflows           */
+        usage = cycles / (window / 10000u);
+    } else {
+        usage = (cycles * 10000u) / window;
+    }
+    if (usage > 10000u) {                        /* Timestamps are sampled at slightly different times */
+        usage = 10000u;
+    }
+    return ((INT16U)usage);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                           INITIALIZE TCB
@@ -2051,6 +3427,11 @@ INT8U  OS_TCBInit (INT8U    prio,
         ptcb->OSTCBStat          = OS_STAT_RDY;            /* Task is ready to run                     */
         ptcb->OSTCBStatPend      = OS_STAT_PEND_OK;        /* Clear pend status                        */
         ptcb->OSTCBDly           = 0u;                     /* Task is not delayed                      */
+#if OS_TICK_LIST_EN > 0u
+        ptcb->OSTCBTickNext      = (OS_TCB *)0;            /* Task is not in the list of delayed tasks */
+        ptcb->OSTCBTickPrev      = (OS_TCB *)0;
+        ptcb->OSTCBTickDelta     = 0u;
+#endif
 
 #if OS_TASK_CREATE_EXT_EN > 0u
         ptcb->OSTCBExtPtr        = pext;                   /* Store pointer to TCB extension           */
@@ -2081,6 +3462,22 @@ INT8U  OS_TCBInit (INT8U    prio,
         ptcb->OSTCBBitY          = (OS_PRIO)(1uL << ptcb->OSTCBY);
         ptcb->OSTCBBitX          = (OS_PRIO)(1uL << ptcb->OSTCBX);
 
+#if OS_SCHED_RR_EN > 0u
+        ptcb->OSTCBPrioNext      = (OS_TCB *)0;            /* Not yet linked at its priority           */
+        ptcb->OSTCBPrioPrev      = (OS_TCB *)0;
+        ptcb->OSTCBTimeQuanta    = 0u;                     /* Use the default time quanta ...          */
+        ptcb->OSTCBTimeQuantaCtr = 0u;                     /* ... loaded when the task is scheduled    */
+#endif
+
+#if (OS_MUTEX_EN > 0u) && (OS_MUTEX_INHERIT_EN > 0u)
+        ptcb->OSTCBBasePrio      = prio;                   /* Task has not inherited any priority      */
+        ptcb->OSTCBMutexHeld     = (OS_EVENT *)0;          /* Task owns no inheritance mutex           */
+#endif
+
+#if OS_RWLOCK_EN > 0u
+        ptcb->OSTCBRWLockWr      = OS_FALSE;               /* Not waiting to write a RW lock           */
+#endif
+
 #if (OS_EVENT_EN)
         ptcb->OSTCBEventPtr      = (OS_EVENT  *)0;         /* Task is not pending on an  event         */
 #if (OS_EVENT_MULTI_EN > 0u)
@@ -2097,10 +3494,22 @@ INT8U  OS_TCBInit (INT8U    prio,
         ptcb->OSTCBMsg           = (void *)0;              /* No message received                      */
 #endif
 
+#if OS_TASK_SEM_EN > 0u
+        ptcb->OSTCBSemCtr        = 0u;                     /* Task semaphore not signaled              */
+#endif
+
+#if OS_TASK_Q_EN > 0u
+        ptcb->OSTCBQIn           = 0u;                     /* Task message queue is empty              */
+        ptcb->OSTCBQOut          = 0u;
+        ptcb->OSTCBQEntries      = 0u;
+#endif
+
 #if OS_TASK_PROFILE_EN > 0u
         ptcb->OSTCBCtxSwCtr      = 0uL;                    /* Initialize profiling variables           */
         ptcb->OSTCBCyclesStart   = 0uL;
         ptcb->OSTCBCyclesTot     = 0uL;
+        ptcb->OSTCBCyclesTotPrev = 0uL;
+        ptcb->OSTCBCPUUsage      = 0u;
         ptcb->OSTCBStkBase       = (OS_STK *)0;
         ptcb->OSTCBStkUsed       = 0uL;
 #endif
@@ -2118,7 +3527,11 @@ INT8U  OS_TCBInit (INT8U    prio,
         OSTCBInitHook(ptcb);
 
         OS_ENTER_CRITICAL();
+#if OS_SCHED_RR_EN > 0u
+        OS_SchedRRInsert(ptcb);                            /* Append to the tasks at this priority     */
+#else
         OSTCBPrioTbl[prio] = ptcb;
+#endif
         OS_EXIT_CRITICAL();
 
         OSTaskCreateHook(ptcb);                            /* Call user defined hook                   */
@@ -2140,7 +3553,7 @@ INT8U  OS_TCBInit (INT8U    prio,
         }
         OSTCBList               = ptcb;
         OSRdyGrp               |= ptcb->OSTCBBitY;         /* Make task ready to run                   */
-        OSRdyTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+        OSRdyTbl[ptcb->OSTCBY] |=  ptcb->OSTCBBitX;
         OSTaskCtr++;                                       /* Increment the #tasks counter             */
         OS_TRACE_TASK_READY(ptcb);
         OS_EXIT_CRITICAL();
@@ -2150,4 +3563,225 @@ INT8U  OS_TCBInit (INT8U    prio,
     return (OS_ERR_TASK_NO_MORE_TCB);
 }
 
+
+/*
+*********************************************************************************************************
+*                                      CHANGE THE PRIORITY OF A TCB
+*
+* Description: This function moves a task to a new priority.  The task is made ready at the new priority
+*              if it was ready and, if it waits for events, it is moved in their wait lists.
+*
+* Arguments  : ptcb          is a pointer to the TCB of the task.
+*
+*              prio          is the new priority of the task.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) This function assumes that interrupts are disabled.
+*              3) Unless OS_SCHED_RR_EN is set to 1, the new priority MUST be available.
+*********************************************************************************************************
+*/
+
+#if (OS_TASK_CHANGE_PRIO_EN > 0u) || ((OS_MUTEX_EN > 0u) && (OS_MUTEX_INHERIT_EN > 0u))
+void  OS_TCBPrioSet (OS_TCB  *ptcb,
+                     INT8U    prio)
+{
+#if (OS_EVENT_EN)
+    OS_EVENT  *pevent;
+#if (OS_EVENT_MULTI_EN > 0u)
+    OS_EVENT **pevents;
+#endif
+#endif
+    INT8U      y_new;
+    INT8U      x_new;
+    INT8U      y_old;
+    OS_PRIO    bity_new;
+    OS_PRIO    bitx_new;
+    OS_PRIO    bity_old;
+    OS_PRIO    bitx_old;
+
+
+#if OS_LOWEST_PRIO <= 63u
+    y_new                 = (INT8U)(prio >> 3u);            /* Compute new TCB fields                  */
+    x_new                 = (INT8U)(prio & 0x07u);
+#else
+    y_new                 = (INT8U)((INT8U)(prio >> 4u) & 0x0Fu);
+    x_new                 = (INT8U)(prio & 0x0Fu);
+#endif
+    bity_new              = (OS_PRIO)(1uL << y_new);
+    bitx_new              = (OS_PRIO)(1uL << x_new);
+
+    y_old                 =  ptcb->OSTCBY;
+    bity_old              =  ptcb->OSTCBBitY;
+    bitx_old              =  ptcb->OSTCBBitX;
+#if OS_SCHED_RR_EN > 0u
+    OS_SchedRRRemove(ptcb);                                 /* Remove TCB from old priority            */
+    if (OS_SchedRRIsRdy(ptcb) == OS_TRUE) {                 /* If task is ready make it not            */
+#else
+    OSTCBPrioTbl[ptcb->OSTCBPrio] = (OS_TCB *)0;            /* Remove TCB from old priority            */
+    OSTCBPrioTbl[prio]            =  ptcb;                  /* Place pointer to TCB @ new priority     */
+    if ((OSRdyTbl[y_old] &   bitx_old) != 0u) {             /* If task is ready make it not            */
+#endif
+         OSRdyTbl[y_old] &= (OS_PRIO)~bitx_old;
+         if (OSRdyTbl[y_old] == 0u) {
+             OSRdyGrp &= (OS_PRIO)~bity_old;
+         }
+#if OS_SCHED_RR_EN > 0u
+         OS_SchedRRRdyRestore(ptcb);                        /* Other tasks may be ready at old prio    */
+#endif
+         OSRdyGrp        |= bity_new;                       /* Make new priority ready to run          */
+         OSRdyTbl[y_new] |= bitx_new;
+         OS_TRACE_TASK_READY(ptcb);
+    }
+
+#if (OS_EVENT_EN)
+    pevent = ptcb->OSTCBEventPtr;
+    if (pevent != (OS_EVENT *)0) {
+        pevent->OSEventTbl[y_old] &= (OS_PRIO)~bitx_old;    /* Remove old task prio from wait list     */
+        if (pevent->OSEventTbl[y_old] == 0u) {
+            pevent->OSEventGrp    &= (OS_PRIO)~bity_old;
+        }
+#if OS_SCHED_RR_EN > 0u
+        OS_SchedRREventRestore(ptcb, pevent);               /* Other tasks may wait at old prio        */
+#endif
+        pevent->OSEventGrp        |= bity_new;              /* Add    new task prio to   wait list     */
+        pevent->OSEventTbl[y_new] |= bitx_new;
+    }
+#if (OS_EVENT_MULTI_EN > 0u)
+    if (ptcb->OSTCBEventMultiPtr != (OS_EVENT **)0) {
+        pevents =  ptcb->OSTCBEventMultiPtr;
+        pevent  = *pevents;
+        while (pevent != (OS_EVENT *)0) {
+            pevent->OSEventTbl[y_old] &= (OS_PRIO)~bitx_old;   /* Remove old task prio from wait lists */
+            if (pevent->OSEventTbl[y_old] == 0u) {
+                pevent->OSEventGrp    &= (OS_PRIO)~bity_old;
+            }
+#if OS_SCHED_RR_EN > 0u
+            OS_SchedRREventRestore(ptcb, pevent);           /* Other tasks may wait at old prio        */
+#endif
+            pevent->OSEventGrp        |= bity_new;          /* Add    new task prio to   wait lists    */
+            pevent->OSEventTbl[y_new] |= bitx_new;
+            pevents++;
+            pevent                     = *pevents;
+        }
+    }
+#endif
+#endif
+
+    ptcb->OSTCBPrio = prio;                                 /* Set new task priority                   */
+    ptcb->OSTCBY    = y_new;
+    ptcb->OSTCBX    = x_new;
+    ptcb->OSTCBBitY = bity_new;
+    ptcb->OSTCBBitX = bitx_new;
+#if OS_SCHED_RR_EN > 0u
+    OS_SchedRRInsert(ptcb);                                 /* Place TCB at new priority               */
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  INSERT A TASK IN THE LIST OF DELAYED TASKS
+*
+* Description: This function is called to insert a task in the sorted list of delayed tasks.  Each entry
+*              holds the number of ticks between its expiry and the expiry of the entry before it, so
+*              OSTimeTick() only needs to decrement the first entry of the list.
+*
+* Arguments  : ptcb    is a pointer to the TCB of the task.  The number of ticks to wait must have been
+*                      loaded in ptcb->OSTCBDly.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) This function assumes that interrupts are disabled.
+*              3) Tasks expiring on the same tick are kept in FIFO order.
+*              4) Nothing is done if ptcb->OSTCBDly is 0 (i.e. wait forever).
+*              5) ptcb->OSTCBDly is no longer decremented while the task is in the list, it keeps the
+*                 requested number of ticks and only indicates that the task is delayed.
+*********************************************************************************************************
+*/
+
+#if OS_TICK_LIST_EN > 0u
+void  OS_TickListInsert (OS_TCB  *ptcb)
+{
+    OS_TCB  *ptcb_prev;
+    OS_TCB  *ptcb_next;
+    INT32U   delta;
+
+
+    delta = ptcb->OSTCBDly;
+    if (delta == 0u) {                                     /* See Note #4                              */
+        return;
+    }
+    ptcb_prev = (OS_TCB *)0;
+    ptcb_next = OSTickList;
+    while ((ptcb_next != (OS_TCB *)0) &&                   /* Find insertion point (see Note #3)       */
+           (ptcb_next->OSTCBTickDelta <= delta)) {
+        delta    -= ptcb_next->OSTCBTickDelta;
+        ptcb_prev = ptcb_next;
+        ptcb_next = ptcb_next->OSTCBTickNext;
+    }
+    ptcb->OSTCBTickDelta = delta;
+    ptcb->OSTCBTickPrev  = ptcb_prev;
+    ptcb->OSTCBTickNext  = ptcb_next;
+    if (ptcb_next != (OS_TCB *)0) {
+        ptcb_next->OSTCBTickDelta -= delta;                /* Next entry now expires relative to 'ptcb' */
+        ptcb_next->OSTCBTickPrev   = ptcb;
+    }
+    if (ptcb_prev == (OS_TCB *)0) {
+        OSTickList = ptcb;
+    } else {
+        ptcb_prev->OSTCBTickNext = ptcb;
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                 REMOVE A TASK FROM THE LIST OF DELAYED TASKS
+*
+* Description: This function is called to remove a task from the sorted list of delayed tasks, either
+*              because its delay expired or because it was readied, resumed or deleted before that.
+*
+* Arguments  : ptcb    is a pointer to the TCB of the task.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) This function assumes that interrupts are disabled.
+*              3) Nothing is done if the task is not delayed (i.e. ptcb->OSTCBDly is 0).  The caller is
+*                 responsible for clearing ptcb->OSTCBDly.
+*********************************************************************************************************
+*/
+
+#if OS_TICK_LIST_EN > 0u
+void  OS_TickListRemove (OS_TCB  *ptcb)
+{
+    OS_TCB  *ptcb_prev;
+    OS_TCB  *ptcb_next;
+
+
+    if (ptcb->OSTCBDly == 0u) {                            /* See Note #3                              */
+        return;
+    }
+    ptcb_prev = ptcb->OSTCBTickPrev;
+    ptcb_next = ptcb->OSTCBTickNext;
+    if (ptcb_next != (OS_TCB *)0) {
+        ptcb_next->OSTCBTickDelta += ptcb->OSTCBTickDelta; /* Give remaining ticks to next entry        */
+        ptcb_next->OSTCBTickPrev   = ptcb_prev;
+    }
+    if (ptcb_prev == (OS_TCB *)0) {
+        OSTickList = ptcb_next;
+    } else {
+        ptcb_prev->OSTCBTickNext = ptcb_next;
+    }
+    ptcb->OSTCBTickNext  = (OS_TCB *)0;
+    ptcb->OSTCBTickPrev  = (OS_TCB *)0;
+    ptcb->OSTCBTickDelta = 0u;
+}
+#endif
+
 #endif
@@ -67,6 +67,13 @@ INT16U  const  OSFlagWidth           = 0u;
 INT16U  const  OSFlagMax             = OS_MAX_FLAGS;
 INT16U  const  OSFlagNameEn          = OS_FLAG_NAME_EN;
 
+INT16U  const  OSIntDisMeasEn        = OS_INT_DIS_MEAS_EN;      /* Int. dis./sched lock times measured */
+#if OS_INT_DIS_MEAS_EN > 0u
+INT16U  const  OSIntDisDataSize      = sizeof(OS_INT_DIS_DATA); /* Size in bytes of OS_INT_DIS_DATA    */
+#else
+INT16U  const  OSIntDisDataSize      = 0u;
+#endif
+
 INT16U  const  OSLowestPrio          = OS_LOWEST_PRIO;
 
 INT16U  const  OSMboxEn              = OS_MBOX_EN;
@@ -83,6 +90,14 @@ INT16U  const  OSMemTblSize          = 0u;
 #endif
 INT16U  const  OSMutexEn             = OS_MUTEX_EN;
 
+INT16U  const  OSPipeEn              = OS_PIPE_EN;
+INT16U  const  OSPipeMax             = OS_MAX_PIPES;            /* Number of pipes                     */
+#if (OS_PIPE_EN > 0u) && (OS_MAX_PIPES > 0u)
+INT16U  const  OSPipeSize            = sizeof(OS_PIPE);         /* Size in bytes of OS_PIPE structure  */
+#else
+INT16U  const  OSPipeSize            = 0u;
+#endif
+
 INT16U  const  OSPtrSize             = sizeof(void *);          /* Size in Bytes of a pointer          */
 
 INT16U  const  OSQEn                 = OS_Q_EN;
@@ -93,8 +108,18 @@ INT16U  const  OSQSize               = sizeof(OS_Q);            /* Size in bytes
 INT16U  const  OSQSize               = 0u;
 #endif
 
+INT16U  const  OSRingEn              = OS_RING_EN;
+INT16U  const  OSRingMax             = OS_MAX_RINGS;            /* Number of ring buffers              */
+#if (OS_RING_EN > 0u) && (OS_MAX_RINGS > 0u)
+INT16U  const  OSRingSize            = sizeof(OS_RING);         /* Size in bytes of OS_RING structure  */
+#else
+INT16U  const  OSRingSize            = 0u;
+#endif
+
 INT16U  const  OSRdyTblSize          = OS_RDY_TBL_SIZE;         /* Number of bytes in the ready table  */
 
+INT16U  const  OSRWLockEn            = OS_RWLOCK_EN;
+
 INT16U  const  OSSemEn               = OS_SEM_EN;
 
 INT16U  const  OSStkWidth            = sizeof(OS_STK);          /* Size in Bytes of a stack entry      */
@@ -111,6 +136,13 @@ INT16U  const  OSTaskStatStkSize     = OS_TASK_STAT_STK_SIZE;
 INT16U  const  OSTaskStatStkChkEn    = OS_TASK_STAT_STK_CHK_EN;
 INT16U  const  OSTaskSwHookEn        = OS_TASK_SW_HOOK_EN;
 INT16U  const  OSTaskRegTblSize      = OS_TASK_REG_TBL_SIZE;
+INT16U  const  OSTaskSemEn           = OS_TASK_SEM_EN;
+INT16U  const  OSTaskQEn             = OS_TASK_Q_EN;
+#if OS_TASK_Q_EN > 0u
+INT16U  const  OSTaskQSize           = OS_TASK_Q_SIZE;          /* Nbr of messages in each task queue  */
+#else
+INT16U  const  OSTaskQSize           = 0u;
+#endif
 
 INT16U  const  OSTCBPrioTblMax       = OS_LOWEST_PRIO + 1u;     /* Number of entries in OSTCBPrioTbl[] */
 INT16U  const  OSTCBSize             = sizeof(OS_TCB);          /* Size in Bytes of OS_TCB             */
@@ -130,7 +162,9 @@ INT16U  const  OSTmrEn               = OS_TMR_EN;
 INT16U  const  OSTmrCfgMax           = OS_TMR_CFG_MAX;
 INT16U  const  OSTmrCfgNameEn        = OS_TMR_CFG_NAME_EN;
 INT16U  const  OSTmrCfgWheelSize     = OS_TMR_CFG_WHEEL_SIZE;
+INT16U  const  OSTmrCfgWheelLvls     = OS_TMR_CFG_WHEEL_LVLS;
 INT16U  const  OSTmrCfgTicksPerSec   = OS_TMR_CFG_TICKS_PER_SEC;
+INT16U  const  OSTmrCfgTickEn        = OS_TMR_CFG_TICK_EN;
 
 #if (OS_TMR_EN > 0u) && (OS_TMR_CFG_MAX > 0u)
 INT16U  const  OSTmrSize             = sizeof(OS_TMR);
@@ -192,6 +226,16 @@ INT16U  const  OSDataSize = sizeof(OSCtxSwCtr)
                           + sizeof(OSQTbl)
 #endif
 
+#if (OS_PIPE_EN > 0u) && (OS_MAX_PIPES > 0u)
+                          + sizeof(OSPipeFreeList)
+                          + sizeof(OSPipeTbl)
+#endif
+
+#if (OS_RING_EN > 0u) && (OS_MAX_RINGS > 0u)
+                          + sizeof(OSRingFreeList)
+                          + sizeof(OSRingTbl)
+#endif
+
 #if OS_TASK_REG_TBL_SIZE > 0u
                           + sizeof(OSTaskRegNextAvailID)
 #endif
@@ -204,12 +248,36 @@ INT16U  const  OSDataSize = sizeof(OSCtxSwCtr)
                           + sizeof(OSTmrFree)
                           + sizeof(OSTmrUsed)
                           + sizeof(OSTmrTime)
+#if OS_TMR_CFG_LATE_EN > 0u
+                          + sizeof(OSTmrBacklogMax)
+#endif
                           + sizeof(OSTmrSem)
+#if OS_TMR_CFG_TICK_EN == 0u
                           + sizeof(OSTmrSemSignal)
+                          + sizeof(OSTmrTaskStk)
+#endif
                           + sizeof(OSTmrTbl)
                           + sizeof(OSTmrFreeList)
-                          + sizeof(OSTmrTaskStk)
                           + sizeof(OSTmrWheelTbl)
+#if OS_TMR_CFG_CB_DEFER_EN > 0u
+                          + sizeof(OSTmrCbList)
+                          + sizeof(OSTmrCbListTail)
+#if OS_TMR_CFG_CB_TASKS > 0u
+                          + sizeof(OSTmrCbSem)
+                          + sizeof(OSTmrCbTaskStk)
+#endif
+#endif
+#endif
+
+#if OS_INT_DIS_MEAS_EN > 0u
+                          + sizeof(OSIntDisMeasNestingCtr)
+                          + sizeof(OSIntDisMeasTS)
+                          + sizeof(OSIntDisMeasOvrhd)
+                          + sizeof(OSIntDisTimeCur)
+                          + sizeof(OSIntDisTimeMax)
+                          + sizeof(OSSchedLockTS)
+                          + sizeof(OSSchedLockTimeCur)
+                          + sizeof(OSSchedLockTimeMax)
 #endif
                           + sizeof(OSIntNesting)
                           + sizeof(OSLockNesting)
@@ -275,6 +343,9 @@ void  OSDebugInit (void)
     ptemp = (void const *)&OSFlagMax;
     ptemp = (void const *)&OSFlagNameEn;
 
+    ptemp = (void const *)&OSIntDisMeasEn;
+    ptemp = (void const *)&OSIntDisDataSize;
+
     ptemp = (void const *)&OSLowestPrio;
 
     ptemp = (void const *)&OSMboxEn;
@@ -325,7 +396,9 @@ void  OSDebugInit (void)
     ptemp = (void const *)&OSTmrCfgMax;
     ptemp = (void const *)&OSTmrCfgNameEn;
     ptemp = (void const *)&OSTmrCfgWheelSize;
+    ptemp = (void const *)&OSTmrCfgWheelLvls;
     ptemp = (void const *)&OSTmrCfgTicksPerSec;
+    ptemp = (void const *)&OSTmrCfgTickEn;
     ptemp = (void const *)&OSTmrSize;
     ptemp = (void const *)&OSTmrTblSize;
 
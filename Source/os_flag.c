@@ -42,8 +42,13 @@
 */
 
 static  void     OS_FlagBlock(OS_FLAG_GRP *pgrp, OS_FLAG_NODE *pnode, OS_FLAGS flags, INT8U wait_type, INT32U timeout);
+static  INT8U    OS_FlagNodeChk(OS_FLAG_GRP *pgrp, OS_FLAG_NODE *pnode, BOOLEAN *psched);
 static  BOOLEAN  OS_FlagTaskRdy(OS_FLAG_NODE *pnode, OS_FLAGS flags_rdy, INT8U pend_stat);
 
+#if OS_FLAG_BIT_INDEX_EN > 0u
+static  INT8U    OS_FlagBitLowest(OS_FLAGS flags);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -863,15 +868,23 @@ OS_FLAGS  OSFlagPendGetFlagsRdy (void)
 *                            OS_ERR_FLAG_INVALID_PGRP   You passed a NULL pointer
 *                            OS_ERR_EVENT_TYPE          You are not pointing to an event flag group
 *                            OS_ERR_FLAG_INVALID_OPT    You specified an invalid option
+*                            OS_ERR_INT_Q_FULL          Called from an ISR while the ring of deferred
+*                                                       posts is full
 *
-* Returns    : the new value of the event flags bits that are still set.
+* Returns    : the new value of the event flags bits that are still set or, 0 if the post was deferred
+*              (see OS_ISR_POST_DEFERRED_EN).
 *
 * Called From: Task or ISR
 *
 * WARNING(s) : 1) The execution time of this function depends on the number of tasks waiting on the event
 *                 flag group.
 *              2) The amount of time interrupts are DISABLED depends on the number of tasks waiting on
-*                 the event flag group.
+*                 the event flag group.  When OS_ISR_POST_DEFERRED_EN is set to 1, ISRs don't access the
+*                 wait list and it is walked with the scheduler locked, only disabling interrupts for one
+*                 waiting task at a time.
+*              3) When OS_FLAG_BIT_INDEX_EN is set to 1, only the tasks waiting on a bit that the post
+*                 changed are checked, each of them once.  The time then depends on the number of these
+*                 tasks, not on the number of tasks waiting on the event flag group.
 *********************************************************************************************************
 */
 OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *pgrp,
@@ -882,8 +895,14 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *pgrp,
     OS_FLAG_NODE *pnode;
     BOOLEAN       sched;
     OS_FLAGS      flags_cur;
-    OS_FLAGS      flags_rdy;
-    BOOLEAN       rdy;
+    INT8U         err;
+#if OS_FLAG_BIT_INDEX_EN > 0u
+    OS_FLAG_NODE *pnode_next;
+    OS_FLAGS      flags_chg;
+    OS_FLAGS      flags_todo;
+    OS_FLAGS      bit;
+    INT8U         bit_ix;
+#endif
 #if OS_CRITICAL_METHOD == 3u                         /* Allocate storage for CPU status register       */
     OS_CPU_SR     cpu_sr = 0u;
 #endif
@@ -911,7 +930,20 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *pgrp,
         return ((OS_FLAGS)0);
     }
 
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNesting > 0u) {                         /* Defer the post when called from an ISR         */
+        if ((opt != OS_FLAG_CLR) && (opt != OS_FLAG_SET)) {
+            *perr = OS_ERR_FLAG_INVALID_OPT;
+        } else {
+            *perr = OSIntQ_Post(OS_INT_Q_FLAG_POST, (void *)pgrp, (void *)0, flags, opt);
+        }
+        OS_TRACE_FLAG_POST_EXIT(*perr);
+        return ((OS_FLAGS)0);
+    }
+#endif
+
     OS_ENTER_CRITICAL();
+    flags_cur = pgrp->OSFlagFlags;                   /* Remember the flags before the post             */
     switch (opt) {
         case OS_FLAG_CLR:
              pgrp->OSFlagFlags &= (OS_FLAGS)~flags;  /* Clear the flags specified in the group         */
@@ -927,59 +959,74 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *pgrp,
              OS_TRACE_FLAG_POST_EXIT(*perr);
              return ((OS_FLAGS)0);
     }
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    OSLockNesting++;                                 /* Walk the wait list with the scheduler locked   */
+#if OS_INT_DIS_MEAS_EN > 0u
+    OS_SchedLockMeasStart();
+#endif
+#endif
     sched = OS_FALSE;                                /* Indicate that we don't need rescheduling       */
+    err   = OS_ERR_NONE;
+#if OS_FLAG_BIT_INDEX_EN > 0u
+    flags_chg  = (OS_FLAGS)(flags_cur ^ pgrp->OSFlagFlags);
+    flags_todo = flags_chg;
+    while (flags_todo != (OS_FLAGS)0) {              /* Go through the bits that changed (WARNING #3)  */
+        bit_ix = OS_FlagBitLowest(flags_todo);
+        bit    = (OS_FLAGS)((OS_FLAGS)1 << bit_ix);
+        pnode  = (OS_FLAG_NODE *)pgrp->OSFlagBitList[bit_ix];
+        while (pnode != (OS_FLAG_NODE *)0) {         /* Go through tasks waiting on this bit           */
+            pnode_next = (OS_FLAG_NODE *)pnode->OSFlagNodeBitNext[bit_ix];
+                                                     /* Skip task if checked for a lower changed bit   */
+            if ((pnode->OSFlagNodeFlags & flags_chg & (OS_FLAGS)(bit - 1u)) == (OS_FLAGS)0) {
+                err = OS_FlagNodeChk(pgrp, pnode, &sched);
+                if (err != OS_ERR_NONE) {
+                    break;
+                }
+            }
+            pnode = pnode_next;
+#if OS_ISR_POST_DEFERRED_EN > 0u
+            OS_EXIT_CRITICAL();                      /* Let interrupts in between two waiting tasks    */
+            OS_ENTER_CRITICAL();
+#endif
+        }
+        if (err != OS_ERR_NONE) {
+            break;
+        }
+        flags_todo &= (OS_FLAGS)~bit;
+    }
+#else
     pnode = (OS_FLAG_NODE *)pgrp->OSFlagWaitList;
     while (pnode != (OS_FLAG_NODE *)0) {             /* Go through all tasks waiting on event flag(s)  */
-        switch (pnode->OSFlagNodeWaitType) {
-            case OS_FLAG_WAIT_SET_ALL:               /* See if all req. flags are set for current node */
-                 flags_rdy = (OS_FLAGS)(pgrp->OSFlagFlags & pnode->OSFlagNodeFlags);
-                 if (flags_rdy == pnode->OSFlagNodeFlags) {   /* Make task RTR, event(s) Rx'd          */
-                     rdy = OS_FlagTaskRdy(pnode, flags_rdy, OS_STAT_PEND_OK);
-                     if (rdy == OS_TRUE) {
-                         sched = OS_TRUE;                     /* When done we will reschedule          */
-                     }
-                 }
-                 break;
-
-            case OS_FLAG_WAIT_SET_ANY:               /* See if any flag set                            */
-                 flags_rdy = (OS_FLAGS)(pgrp->OSFlagFlags & pnode->OSFlagNodeFlags);
-                 if (flags_rdy != (OS_FLAGS)0) {              /* Make task RTR, event(s) Rx'd          */
-                     rdy = OS_FlagTaskRdy(pnode, flags_rdy, OS_STAT_PEND_OK);
-                     if (rdy == OS_TRUE) {
-                         sched = OS_TRUE;                     /* When done we will reschedule          */
-                     }
-                 }
-                 break;
-
-#if OS_FLAG_WAIT_CLR_EN > 0u
-            case OS_FLAG_WAIT_CLR_ALL:               /* See if all req. flags are set for current node */
-                 flags_rdy = (OS_FLAGS)~pgrp->OSFlagFlags & pnode->OSFlagNodeFlags;
-                 if (flags_rdy == pnode->OSFlagNodeFlags) {   /* Make task RTR, event(s) Rx'd          */
-                     rdy = OS_FlagTaskRdy(pnode, flags_rdy, OS_STAT_PEND_OK);
-                     if (rdy == OS_TRUE) {
-                         sched = OS_TRUE;                     /* When done we will reschedule          */
-                     }
-                 }
-                 break;
-
-            case OS_FLAG_WAIT_CLR_ANY:               /* See if any flag set                            */
-                 flags_rdy = (OS_FLAGS)~pgrp->OSFlagFlags & pnode->OSFlagNodeFlags;
-                 if (flags_rdy != (OS_FLAGS)0) {              /* Make task RTR, event(s) Rx'd          */
-                     rdy = OS_FlagTaskRdy(pnode, flags_rdy, OS_STAT_PEND_OK);
-                     if (rdy == OS_TRUE) {
-                         sched = OS_TRUE;                     /* When done we will reschedule          */
-                     }
-                 }
-                 break;
-#endif
-            default:
-                 OS_EXIT_CRITICAL();
-                 *perr = OS_ERR_FLAG_WAIT_TYPE;
-                 OS_TRACE_FLAG_POST_EXIT(*perr);
-                 return ((OS_FLAGS)0);
+        err = OS_FlagNodeChk(pgrp, pnode, &sched);
+        if (err != OS_ERR_NONE) {
+            break;
         }
         pnode = (OS_FLAG_NODE *)pnode->OSFlagNodeNext; /* Point to next task waiting for event flag(s) */
+#if OS_ISR_POST_DEFERRED_EN > 0u
+        OS_EXIT_CRITICAL();                          /* Let interrupts in between two waiting tasks    */
+        OS_ENTER_CRITICAL();
+#endif
     }
+#endif
+    if (err != OS_ERR_NONE) {                        /* Invalid wait type found in the wait list       */
+#if OS_ISR_POST_DEFERRED_EN > 0u
+        OSLockNesting--;
+#if OS_INT_DIS_MEAS_EN > 0u
+        OS_SchedLockMeasStop();
+#endif
+#endif
+        OS_EXIT_CRITICAL();
+        *perr = err;
+        OS_TRACE_FLAG_POST_EXIT(*perr);
+        return ((OS_FLAGS)0);
+    }
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    OSLockNesting--;
+#if OS_INT_DIS_MEAS_EN > 0u
+    OS_SchedLockMeasStop();
+#endif
+    sched = OS_TRUE;                                 /* An ISR may have readied a task meanwhile       */
+#endif
     OS_EXIT_CRITICAL();
     if (sched == OS_TRUE) {
         OS_Sched();
@@ -1050,6 +1097,51 @@ OS_FLAGS  OSFlagQuery (OS_FLAG_GRP  *pgrp,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                  FIND THE LOWEST BIT SET IN EVENT FLAGS
+*
+* Description: This function is internal to uC/OS-II and returns the position of the lowest bit set in
+*              'flags', to index the lists of tasks waiting on each bit of an event flag group.
+*
+* Arguments  : flags         is the bit pattern to look at.  It MUST NOT be 0.
+*
+* Returns    : The position of the lowest bit set (0 for bit 0).
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) OS_CPU_CNT_TRAIL_ZEROS() or OSUnMapTbl[] is applied to the lowest non-zero byte.
+*              3) With 64-bit flags, an empty low word is skipped at once to avoid 64-bit shifts on 32-bit
+*                 CPUs.
+*********************************************************************************************************
+*/
+
+#if OS_FLAG_BIT_INDEX_EN > 0u
+static  INT8U  OS_FlagBitLowest (OS_FLAGS  flags)
+{
+    INT8U  bit_ix;
+
+
+    bit_ix = 0u;
+#if OS_FLAGS_NBITS == 64u
+    if ((INT32U)flags == 0u) {                        /* Skip the low word if no bit is set in it      */
+        flags  = (OS_FLAGS)(flags >> 32u);
+        bit_ix = 32u;
+    }
+#endif
+    while ((flags & 0xFFu) == 0u) {                   /* Find the lowest byte with a bit set           */
+        flags   = (OS_FLAGS)(flags >> 8u);
+        bit_ix += 8u;
+    }
+#if defined(OS_CPU_CNT_TRAIL_ZEROS)
+    bit_ix += (INT8U)OS_CPU_CNT_TRAIL_ZEROS(flags & 0xFFu);
+#else
+    bit_ix += OSUnMapTbl[flags & 0xFFu];
+#endif
+    return (bit_ix);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                     SUSPEND TASK UNTIL EVENT FLAG(s) RECEIVED OR TIMEOUT OCCURS
@@ -1095,11 +1187,17 @@ static  void  OS_FlagBlock (OS_FLAG_GRP  *pgrp,
 {
     OS_FLAG_NODE  *pnode_next;
     INT8U          y;
+#if OS_FLAG_BIT_INDEX_EN > 0u
+    INT8U          bit_ix;
+#endif
 
 
     OSTCBCur->OSTCBStat      |= OS_STAT_FLAG;
     OSTCBCur->OSTCBStatPend   = OS_STAT_PEND_OK;
     OSTCBCur->OSTCBDly        = timeout;              /* Store timeout in task's TCB                   */
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListInsert(OSTCBCur);                      /* Add task to the list of delayed tasks         */
+#endif
 #if OS_TASK_DEL_EN > 0u
     OSTCBCur->OSTCBFlagNode   = pnode;                /* TCB to link to node                           */
 #endif
@@ -1114,6 +1212,19 @@ static  void  OS_FlagBlock (OS_FLAG_GRP  *pgrp,
         pnode_next->OSFlagNodePrev = pnode;           /* No, link in doubly linked list                */
     }
     pgrp->OSFlagWaitList = (void *)pnode;
+#if OS_FLAG_BIT_INDEX_EN > 0u
+    while (flags != (OS_FLAGS)0) {                    /* Add node to the list of each bit waited on    */
+        bit_ix                            = OS_FlagBitLowest(flags);
+        pnode->OSFlagNodeBitNext[bit_ix]  = pgrp->OSFlagBitList[bit_ix];
+        pnode->OSFlagNodeBitPrev[bit_ix]  = (void *)0;
+        pnode_next                        = (OS_FLAG_NODE *)pgrp->OSFlagBitList[bit_ix];
+        if (pnode_next != (OS_FLAG_NODE *)0) {
+            pnode_next->OSFlagNodeBitPrev[bit_ix] = pnode;
+        }
+        pgrp->OSFlagBitList[bit_ix]       = (void *)pnode;
+        flags                            &= (OS_FLAGS)(flags - 1u);   /* Next bit                      */
+    }
+#endif
 
     y            =  OSTCBCur->OSTCBY;                 /* Suspend current task until flag(s) received   */
     OSRdyTbl[y] &= (OS_PRIO)~OSTCBCur->OSTCBBitX;
@@ -1121,6 +1232,9 @@ static  void  OS_FlagBlock (OS_FLAG_GRP  *pgrp,
     if (OSRdyTbl[y] == 0x00u) {
         OSRdyGrp &= (OS_PRIO)~OSTCBCur->OSTCBBitY;
     }
+#if OS_SCHED_RR_EN > 0u
+    OS_SchedRRRdyRestore(OSTCBCur);                  /* Other tasks at this priority may be ready      */
+#endif
 }
 
 
@@ -1180,6 +1294,88 @@ void  OS_FlagInit (void)
 }
 
 
+/*
+*********************************************************************************************************
+*                              SEE IF A WAITING TASK GOT ITS EVENT FLAG(s)
+*
+* Description: This function is internal to uC/OS-II and is used by OSFlagPost() to make a waiting task
+*              ready-to-run if the event flag group now holds the combination of bits it waits for.
+*
+* Arguments  : pgrp          is a pointer to the event flag group.
+*
+*              pnode         is a pointer to a structure which contains data about the task waiting for
+*                            event flag bit(s) to be set.
+*
+*              psched        is a pointer to a flag set to OS_TRUE if the task was made ready-to-run.
+*
+* Returns    : OS_ERR_NONE            The task was checked
+*              OS_ERR_FLAG_WAIT_TYPE  The task waits with an invalid wait type
+*
+* Called by  : OSFlagPost()  OS_FLAG.C
+*
+* Note(s)    : 1) This function assumes that interrupts are disabled.
+*              2) This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+
+static  INT8U  OS_FlagNodeChk (OS_FLAG_GRP   *pgrp,
+                               OS_FLAG_NODE  *pnode,
+                               BOOLEAN       *psched)
+{
+    OS_FLAGS  flags_rdy;
+    BOOLEAN   rdy;
+
+
+    switch (pnode->OSFlagNodeWaitType) {
+        case OS_FLAG_WAIT_SET_ALL:               /* See if all req. flags are set for current node */
+             flags_rdy = (OS_FLAGS)(pgrp->OSFlagFlags & pnode->OSFlagNodeFlags);
+             if (flags_rdy == pnode->OSFlagNodeFlags) {   /* Make task RTR, event(s) Rx'd          */
+                 rdy = OS_FlagTaskRdy(pnode, flags_rdy, OS_STAT_PEND_OK);
+                 if (rdy == OS_TRUE) {
+                    *psched = OS_TRUE;                    /* When done we will reschedule          */
+                 }
+             }
+             break;
+
+        case OS_FLAG_WAIT_SET_ANY:               /* See if any flag set                            */
+             flags_rdy = (OS_FLAGS)(pgrp->OSFlagFlags & pnode->OSFlagNodeFlags);
+             if (flags_rdy != (OS_FLAGS)0) {              /* Make task RTR, event(s) Rx'd          */
+                 rdy = OS_FlagTaskRdy(pnode, flags_rdy, OS_STAT_PEND_OK);
+                 if (rdy == OS_TRUE) {
+                    *psched = OS_TRUE;                    /* When done we will reschedule          */
+                 }
+             }
+             break;
+
+#if OS_FLAG_WAIT_CLR_EN > 0u
+        case OS_FLAG_WAIT_CLR_ALL:               /* See if all req. flags are set for current node */
+             flags_rdy = (OS_FLAGS)~pgrp->OSFlagFlags & pnode->OSFlagNodeFlags;
+             if (flags_rdy == pnode->OSFlagNodeFlags) {   /* Make task RTR, event(s) Rx'd          */
+                 rdy = OS_FlagTaskRdy(pnode, flags_rdy, OS_STAT_PEND_OK);
+                 if (rdy == OS_TRUE) {
+                    *psched = OS_TRUE;                    /* When done we will reschedule          */
+                 }
+             }
+             break;
+
+        case OS_FLAG_WAIT_CLR_ANY:               /* See if any flag set                            */
+             flags_rdy = (OS_FLAGS)~pgrp->OSFlagFlags & pnode->OSFlagNodeFlags;
+             if (flags_rdy != (OS_FLAGS)0) {              /* Make task RTR, event(s) Rx'd          */
+                 rdy = OS_FlagTaskRdy(pnode, flags_rdy, OS_STAT_PEND_OK);
+                 if (rdy == OS_TRUE) {
+                    *psched = OS_TRUE;                    /* When done we will reschedule          */
+                 }
+             }
+             break;
+#endif
+        default:
+             return (OS_ERR_FLAG_WAIT_TYPE);
+    }
+
+    return (OS_ERR_NONE);
+}
+
+
 /*
 *********************************************************************************************************
 *                              MAKE TASK READY-TO-RUN, EVENT(s) OCCURRED
@@ -1215,6 +1411,9 @@ static  BOOLEAN  OS_FlagTaskRdy (OS_FLAG_NODE *pnode,
 
 
     ptcb                 = (OS_TCB *)pnode->OSFlagNodeTCB; /* Point to TCB of waiting task             */
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListRemove(ptcb);                               /* Remove task from list of delayed tasks   */
+#endif
     ptcb->OSTCBDly       = 0u;
     ptcb->OSTCBFlagsRdy  = flags_rdy;
     ptcb->OSTCBStat     &= (INT8U)~(INT8U)OS_STAT_FLAG;
@@ -1261,12 +1460,16 @@ void  OS_FlagUnlink (OS_FLAG_NODE *pnode)
     OS_FLAG_GRP  *pgrp;
     OS_FLAG_NODE *pnode_prev;
     OS_FLAG_NODE *pnode_next;
+#if OS_FLAG_BIT_INDEX_EN > 0u
+    OS_FLAGS      flags;
+    INT8U         bit_ix;
+#endif
 
 
+    pgrp       = (OS_FLAG_GRP *)pnode->OSFlagNodeFlagGrp;
     pnode_prev = (OS_FLAG_NODE *)pnode->OSFlagNodePrev;
     pnode_next = (OS_FLAG_NODE *)pnode->OSFlagNodeNext;
     if (pnode_prev == (OS_FLAG_NODE *)0) {                      /* Is it first node in wait list?      */
-        pgrp                 = (OS_FLAG_GRP *)pnode->OSFlagNodeFlagGrp;
         pgrp->OSFlagWaitList = (void *)pnode_next;              /*      Update list for new 1st node   */
         if (pnode_next != (OS_FLAG_NODE *)0) {
             pnode_next->OSFlagNodePrev = (OS_FLAG_NODE *)0;     /*      Link new 1st node PREV to NULL */
@@ -1277,6 +1480,23 @@ void  OS_FlagUnlink (OS_FLAG_NODE *pnode)
             pnode_next->OSFlagNodePrev = pnode_prev;            /*      No, Link around current node   */
         }
     }
+#if OS_FLAG_BIT_INDEX_EN > 0u
+    flags = pnode->OSFlagNodeFlags;
+    while (flags != (OS_FLAGS)0) {                              /* Unlink from the list of each bit    */
+        bit_ix     = OS_FlagBitLowest(flags);
+        pnode_prev = (OS_FLAG_NODE *)pnode->OSFlagNodeBitPrev[bit_ix];
+        pnode_next = (OS_FLAG_NODE *)pnode->OSFlagNodeBitNext[bit_ix];
+        if (pnode_prev == (OS_FLAG_NODE *)0) {
+            pgrp->OSFlagBitList[bit_ix] = (void *)pnode_next;
+        } else {
+            pnode_prev->OSFlagNodeBitNext[bit_ix] = pnode_next;
+        }
+        if (pnode_next != (OS_FLAG_NODE *)0) {
+            pnode_next->OSFlagNodeBitPrev[bit_ix] = pnode_prev;
+        }
+        flags &= (OS_FLAGS)(flags - 1u);
+    }
+#endif
 #if OS_TASK_DEL_EN > 0u
     ptcb                = (OS_TCB *)pnode->OSFlagNodeTCB;
     ptcb->OSTCBFlagNode = (OS_FLAG_NODE *)0;
@@ -0,0 +1,421 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-II
+*                                        The Real-Time Kernel
+*
+*                    Copyright 1992-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*
+*                                       DEFERRED ISR POST MANAGEMENT
+*
+* Filename : os_int_q.c
+* Version  : V2.93.01
+*********************************************************************************************************
+*/
+
+#ifndef  OS_INT_Q_C
+#define  OS_INT_Q_C
+
+#define  MICRIUM_SOURCE
+
+#ifndef  OS_MASTER_FILE
+#include <ucos_ii.h>
+#endif
+
+/*
+*********************************************************************************************************
+*                                                        NOTES
+*
+* 1) Your application MUST define the following #define constants:
+*
+*    OS_TASK_INT_Q_PRIO        The priority of the ISR post handler task.  This SHOULD be the highest
+*                              priority of your application (i.e. 0) and MUST NOT be used by another task
+*                              unless round-robin scheduling is enabled (see OS_SCHED_RR_EN).  Tasks
+*                              sharing it then take turns with the handler task, which delays the replay
+*                              of ISR posts by up to their time quanta.
+*    OS_TASK_INT_Q_STK_SIZE    The size     of the ISR post handler task's stack
+*
+* 2) When OS_ISR_POST_DEFERRED_EN is set to 1, OSSemPost(), OSMboxPost(), OSMboxPostOpt(), OSQPost(),
+*    OSQPostFront(), OSQPostOpt() and OSFlagPost() don't touch the kernel object when called from an ISR.
+*    Neither do OSRingPut() and OSRingWrite() when they have to ready the task waiting for the ring,
+*    nor OSTaskSemPost() and OSTaskQPost().
+*    The post is recorded in OSIntQTbl[] and replayed by the ISR post handler task with the scheduler
+*    locked.  The time an ISR post keeps interrupts disabled is thus constant and does not depend on the
+*    number of tasks waiting on the object.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          LOCAL PROTOTYPES
+*********************************************************************************************************
+*/
+
+#if OS_ISR_POST_DEFERRED_EN > 0u
+static  void     OSIntQ_InitTask     (void);
+static  void     OSIntQ_RePost       (OS_INT_Q *pentry);
+static  void     OSIntQ_Task         (void     *p_arg);
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                                    INITIALIZATION
+*                                       INITIALIZE THE DEFERRED ISR POST RING
+*
+* Description: This function is called by OSInit() to initialize the ring of deferred ISR posts and to
+*              create the ISR post handler task.
+*
+* Arguments  : none
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+#if OS_ISR_POST_DEFERRED_EN > 0u
+void  OSIntQ_Init (void)
+{
+    OS_MemClr((INT8U *)&OSIntQTbl[0], sizeof(OSIntQTbl));               /* Clear the ring                             */
+    OSIntQInIx          = 0u;
+    OSIntQOutIx         = 0u;
+    OSIntQNbrEntries    = 0u;
+    OSIntQNbrEntriesMax = 0u;
+    OSIntQOvfCtr        = 0u;
+
+    OSIntQ_InitTask();
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          DEFER A POST MADE FROM AN ISR
+*
+* Description: This function is called by the post services when they are invoked from an ISR.  The
+*              post is recorded in the ring of deferred posts and the ISR post handler task is made ready
+*              to run.  The post is performed by the ISR post handler task when the ISR returns.
+*
+* Arguments  : type          identifies the service called by the ISR (see OS_INT_Q_xxx).
+*
+*              pobj          is a pointer to the event or event flag group to post to.
+*
+*              pmsg          is the message posted to a mailbox, a queue or the message queue of a task.
+*
+*              flags         are the flags posted to an event flag group.
+*
+*              opt           is the option passed to the service, or the priority of the task for
+*                            OSTaskSemPost() and OSTaskQPost().
+*
+* Returns    : OS_ERR_NONE         The post was recorded
+*              OS_ERR_INT_Q_FULL   The ring is full, the post was lost (see OS_INT_Q_SIZE)
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) Interrupts are disabled for a constant time, regardless of the object being posted to.
+*              3) The handler task is found through OSIntQTCB rather than OSTCBPrioTbl[].  When round-robin
+*                 scheduling is enabled, other tasks may share OS_TASK_INT_Q_PRIO (see Note #1 at the top of
+*                 this file) and OSTCBPrioTbl[] then points to whichever of them is at the head of the
+*                 priority's list.
+*********************************************************************************************************
+*/
+
+#if OS_ISR_POST_DEFERRED_EN > 0u
+INT8U  OSIntQ_Post (INT8U            type,
+                    void            *pobj,
+                    void            *pmsg,
+                    OS_INT_Q_FLAGS   flags,
+                    INT8U            opt)
+{
+    OS_INT_Q   *pentry;
+    OS_TCB     *ptcb;
+#if OS_CRITICAL_METHOD == 3u                                     /* Allocate storage for CPU status register      */
+    OS_CPU_SR   cpu_sr = 0u;
+#endif
+
+
+
+    OS_ENTER_CRITICAL();
+    if (OSIntQNbrEntries >= OS_INT_Q_SIZE) {                     /* See if the ring is full                       */
+        OSIntQOvfCtr++;
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_INT_Q_FULL);
+    }
+    pentry               = &OSIntQTbl[OSIntQInIx];               /* Record the post                               */
+    pentry->OSIntQType   = type;
+    pentry->OSIntQOpt    = opt;
+    pentry->OSIntQObjPtr = pobj;
+    pentry->OSIntQMsgPtr = pmsg;
+    pentry->OSIntQFlags  = flags;
+    OSIntQInIx++;
+    if (OSIntQInIx == OS_INT_Q_SIZE) {                           /* Wrap around                                   */
+        OSIntQInIx = 0u;
+    }
+    OSIntQNbrEntries++;
+    if (OSIntQNbrEntriesMax < OSIntQNbrEntries) {                /* Keep track of the peak usage of the ring      */
+        OSIntQNbrEntriesMax = OSIntQNbrEntries;
+    }
+    ptcb = OSIntQTCB;                                            /* See Note #3                                   */
+    if ((ptcb->OSTCBStat & OS_STAT_SUSPEND) != OS_STAT_RDY) {    /* Wake up the ISR post handler task if waiting  */
+        ptcb->OSTCBStat        &= (INT8U)~(INT8U)OS_STAT_SUSPEND;
+        OSRdyGrp               |= ptcb->OSTCBBitY;
+        OSRdyTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+        OS_TRACE_TASK_READY(ptcb);
+    }
+    OS_EXIT_CRITICAL();
+    return (OS_ERR_NONE);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                              INITIALIZE THE ISR POST HANDLER TASK
+*
+* Description: This function is called by OSIntQ_Init() to create the ISR post handler task.
+*
+* Arguments  : none
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+#if OS_ISR_POST_DEFERRED_EN > 0u
+static  void  OSIntQ_InitTask (void)
+{
+#if OS_TASK_NAME_EN > 0u
+    INT8U  err;
+#endif
+
+
+#if OS_TASK_CREATE_EXT_EN > 0u
+    #if OS_STK_GROWTH == 1u
+    (void)OSTaskCreateExt(OSIntQ_Task,
+                          (void *)0,                                       /* No arguments passed to OSIntQ_Task()    */
+                          &OSIntQTaskStk[OS_TASK_INT_Q_STK_SIZE - 1u],     /* Set Top-Of-Stack                        */
+                          OS_TASK_INT_Q_PRIO,
+                          OS_TASK_INT_Q_ID,
+                          &OSIntQTaskStk[0],                               /* Set Bottom-Of-Stack                     */
+                          OS_TASK_INT_Q_STK_SIZE,
+                          (void *)0,                                       /* No TCB extension                        */
+                          OS_TASK_OPT_STK_CHK | OS_TASK_OPT_STK_CLR);      /* Enable stack checking + clear stack     */
+    #else
+    (void)OSTaskCreateExt(OSIntQ_Task,
+                          (void *)0,                                       /* No arguments passed to OSIntQ_Task()    */
+                          &OSIntQTaskStk[0],                               /* Set Top-Of-Stack                        */
+                          OS_TASK_INT_Q_PRIO,
+                          OS_TASK_INT_Q_ID,
+                          &OSIntQTaskStk[OS_TASK_INT_Q_STK_SIZE - 1u],     /* Set Bottom-Of-Stack                     */
+                          OS_TASK_INT_Q_STK_SIZE,
+                          (void *)0,                                       /* No TCB extension                        */
+                          OS_TASK_OPT_STK_CHK | OS_TASK_OPT_STK_CLR);      /* Enable stack checking + clear stack     */
+    #endif
+#else
+    #if OS_STK_GROWTH == 1u
+    (void)OSTaskCreate(OSIntQ_Task,
+                       (void *)0,
+                       &OSIntQTaskStk[OS_TASK_INT_Q_STK_SIZE - 1u],
+                       OS_TASK_INT_Q_PRIO);
+    #else
+    (void)OSTaskCreate(OSIntQ_Task,
+                       (void *)0,
+                       &OSIntQTaskStk[0],
+                       OS_TASK_INT_Q_PRIO);
+    #endif
+#endif
+
+    OSIntQTCB = OSTCBPrioTbl[OS_TASK_INT_Q_PRIO];                /* Only task at this priority so far             */
+
+#if OS_TASK_NAME_EN > 0u
+    OSTaskNameSet(OS_TASK_INT_Q_PRIO, (INT8U *)(void *)"uC/OS-II ISR Post", &err);
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        REPLAY A DEFERRED POST
+*
+* Description: This function is called by the ISR post handler task to perform a post recorded by an ISR.
+*
+* Arguments  : pentry        is a pointer to a copy of the recorded post.
+*
+* Returns    : none
+*
+* Note(s)    : 1) Errors returned by the post services (e.g. a full queue) are ignored, as they would have
+*                 been by an ISR that doesn't check them.
+*********************************************************************************************************
+*/
+
+#if OS_ISR_POST_DEFERRED_EN > 0u
+static  void  OSIntQ_RePost (OS_INT_Q  *pentry)
+{
+#if ((OS_FLAG_EN > 0u) && (OS_MAX_FLAGS > 0u)) || \
+    ((OS_Q_EN > 0u) && (OS_MAX_QS > 0u) && (OS_Q_MULTI_EN > 0u))
+    INT8U  err;
+#endif
+
+
+    switch (pentry->OSIntQType) {
+#if OS_SEM_EN > 0u
+        case OS_INT_Q_SEM_POST:
+             (void)OSSemPost((OS_EVENT *)pentry->OSIntQObjPtr);
+             break;
+#endif
+
+#if (OS_MBOX_EN > 0u) && (OS_MBOX_POST_EN > 0u)
+        case OS_INT_Q_MBOX_POST:
+             (void)OSMboxPost((OS_EVENT *)pentry->OSIntQObjPtr, pentry->OSIntQMsgPtr);
+             break;
+#endif
+
+#if (OS_MBOX_EN > 0u) && (OS_MBOX_POST_OPT_EN > 0u)
+        case OS_INT_Q_MBOX_POST_OPT:
+             (void)OSMboxPostOpt((OS_EVENT *)pentry->OSIntQObjPtr, pentry->OSIntQMsgPtr, pentry->OSIntQOpt);
+             break;
+#endif
+
+#if (OS_Q_EN > 0u) && (OS_MAX_QS > 0u)
+#if OS_Q_POST_EN > 0u
+        case OS_INT_Q_Q_POST:
+             (void)OSQPost((OS_EVENT *)pentry->OSIntQObjPtr, pentry->OSIntQMsgPtr);
+             break;
+#endif
+
+#if OS_Q_POST_FRONT_EN > 0u
+        case OS_INT_Q_Q_POST_FRONT:
+             (void)OSQPostFront((OS_EVENT *)pentry->OSIntQObjPtr, pentry->OSIntQMsgPtr);
+             break;
+#endif
+
+#if OS_Q_POST_OPT_EN > 0u
+        case OS_INT_Q_Q_POST_OPT:
+             (void)OSQPostOpt((OS_EVENT *)pentry->OSIntQObjPtr, pentry->OSIntQMsgPtr, pentry->OSIntQOpt);
+             break;
+#endif
+
+#if OS_Q_MULTI_EN > 0u
+        case OS_INT_Q_Q_POST_MULTI:
+             (void)OSQPostMulti((OS_EVENT *)pentry->OSIntQObjPtr,
+                                &pentry->OSIntQMsgPtr,
+                                1u,
+                                pentry->OSIntQOpt,
+                                &err);
+             break;
+#endif
+#endif
+
+#if (OS_FLAG_EN > 0u) && (OS_MAX_FLAGS > 0u)
+        case OS_INT_Q_FLAG_POST:
+             (void)OSFlagPost((OS_FLAG_GRP *)pentry->OSIntQObjPtr,
+                              (OS_FLAGS)pentry->OSIntQFlags,
+                              pentry->OSIntQOpt,
+                              &err);
+             break;
+#endif
+
+#if (OS_RING_EN > 0u) && (OS_MAX_RINGS > 0u)
+        case OS_INT_Q_RING_SIGNAL:
+             OS_RingSignal((OS_EVENT *)pentry->OSIntQObjPtr);
+             break;
+#endif
+
+#if OS_TASK_SEM_EN > 0u
+        case OS_INT_Q_TASK_SEM_POST:
+             (void)OSTaskSemPost(pentry->OSIntQOpt);
+             break;
+#endif
+
+#if OS_TASK_Q_EN > 0u
+        case OS_INT_Q_TASK_Q_POST:
+             (void)OSTaskQPost(pentry->OSIntQOpt, pentry->OSIntQMsgPtr);
+             break;
+#endif
+
+        default:
+             break;
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        ISR POST HANDLER TASK
+*
+* Description: This task is created by OSIntQ_Init().  It replays the posts deferred by ISRs, in the order
+*              they were made, with the scheduler locked.  When the ring is empty, the task suspends itself
+*              until OSIntQ_Post() makes it ready again.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) Interrupts are only disabled to take an entry out of the ring.  The posts themselves run
+*                 with the scheduler locked so the highest priority task readied by the posts only runs
+*                 once the ring is empty.
+*********************************************************************************************************
+*/
+
+#if OS_ISR_POST_DEFERRED_EN > 0u
+static  void  OSIntQ_Task (void *p_arg)
+{
+    OS_INT_Q    entry;
+#if OS_CRITICAL_METHOD == 3u                                     /* Allocate storage for CPU status register      */
+    OS_CPU_SR   cpu_sr = 0u;
+#endif
+
+
+    p_arg = p_arg;                                               /* Prevent compiler warning for not using 'p_arg'*/
+    for (;;) {
+        OS_ENTER_CRITICAL();
+        if (OSIntQNbrEntries == 0u) {                            /* Wait for an ISR to defer a post               */
+            OSTCBCur->OSTCBStat        |= OS_STAT_SUSPEND;
+            OSRdyTbl[OSTCBCur->OSTCBY] &= (OS_PRIO)~OSTCBCur->OSTCBBitX;
+            if (OSRdyTbl[OSTCBCur->OSTCBY] == 0u) {
+                OSRdyGrp &= (OS_PRIO)~OSTCBCur->OSTCBBitY;
+            }
+#if OS_SCHED_RR_EN > 0u
+            OS_SchedRRRdyRestore(OSTCBCur);                      /* Other tasks at this priority may be ready     */
+#endif
+            OS_TRACE_TASK_SUSPENDED(OSTCBCur);
+            OS_EXIT_CRITICAL();
+            OS_Sched();
+        } else {
+            OSLockNesting++;                                     /* Replay the posts with the scheduler locked    */
+#if OS_INT_DIS_MEAS_EN > 0u
+            OS_SchedLockMeasStart();
+#endif
+            while (OSIntQNbrEntries > 0u) {
+                entry = OSIntQTbl[OSIntQOutIx];                  /* Copy the post before releasing its entry      */
+                OSIntQOutIx++;
+                if (OSIntQOutIx == OS_INT_Q_SIZE) {              /* Wrap around                                   */
+                    OSIntQOutIx = 0u;
+                }
+                OSIntQNbrEntries--;
+                OS_EXIT_CRITICAL();
+                OSIntQ_RePost(&entry);
+                OS_ENTER_CRITICAL();
+            }
+            OSLockNesting--;
+#if OS_INT_DIS_MEAS_EN > 0u
+            OS_SchedLockMeasStop();
+#endif
+            OS_EXIT_CRITICAL();
+            OS_Sched();                                          /* Run the highest priority task readied         */
+        }
+    }
+}
+#endif
+#endif                                                           /* OS_INT_Q_C                                    */
@@ -367,6 +367,9 @@ void  *OSMboxPend (OS_EVENT  *pevent,
     OSTCBCur->OSTCBStat     |= OS_STAT_MBOX;          /* Message not available, task will pend         */
     OSTCBCur->OSTCBStatPend  = OS_STAT_PEND_OK;
     OSTCBCur->OSTCBDly       = timeout;               /* Load timeout in TCB                           */
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListInsert(OSTCBCur);                      /* Add task to the list of delayed tasks         */
+#endif
     OS_EventTaskWait(pevent);                         /* Suspend task until event or timeout occurs    */
     OS_EXIT_CRITICAL();
     OS_Sched();                                       /* Find next highest priority task ready to run  */
@@ -511,6 +514,7 @@ INT8U  OSMboxPendAbort (OS_EVENT  *pevent,
 *              OS_ERR_EVENT_TYPE    If you are attempting to post to a non mailbox.
 *              OS_ERR_PEVENT_NULL   If 'pevent' is a NULL pointer
 *              OS_ERR_POST_NULL_PTR If you are attempting to post a NULL pointer
+*              OS_ERR_INT_Q_FULL    If called from an ISR while the ring of deferred posts is full
 *
 * Note(s)    : 1) HPT means Highest Priority Task
 *********************************************************************************************************
@@ -520,6 +524,9 @@ INT8U  OSMboxPendAbort (OS_EVENT  *pevent,
 INT8U  OSMboxPost (OS_EVENT  *pevent,
                    void      *pmsg)
 {
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    INT8U      err;
+#endif
 #if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
     OS_CPU_SR  cpu_sr = 0u;
 #endif
@@ -541,6 +548,13 @@ INT8U  OSMboxPost (OS_EVENT  *pevent,
         OS_TRACE_MBOX_POST_EXIT(OS_ERR_EVENT_TYPE);
         return (OS_ERR_EVENT_TYPE);
     }
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNesting > 0u) {                          /* Defer the post when called from an ISR        */
+        err = OSIntQ_Post(OS_INT_Q_MBOX_POST, (void *)pevent, pmsg, 0u, OS_POST_OPT_NONE);
+        OS_TRACE_MBOX_POST_EXIT(err);
+        return (err);
+    }
+#endif
     OS_ENTER_CRITICAL();
     if (pevent->OSEventGrp != 0u) {                   /* See if any task pending on mailbox            */
                                                       /* Ready HPT waiting on event                    */
@@ -587,6 +601,7 @@ INT8U  OSMboxPost (OS_EVENT  *pevent,
 *              OS_ERR_EVENT_TYPE    If you are attempting to post to a non mailbox.
 *              OS_ERR_PEVENT_NULL   If 'pevent' is a NULL pointer
 *              OS_ERR_POST_NULL_PTR If you are attempting to post a NULL pointer
+*              OS_ERR_INT_Q_FULL    If called from an ISR while the ring of deferred posts is full
 *
 * Note(s)    : 1) HPT means Highest Priority Task
 *
@@ -600,6 +615,9 @@ INT8U  OSMboxPostOpt (OS_EVENT  *pevent,
                       void      *pmsg,
                       INT8U      opt)
 {
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    INT8U      err;
+#endif
 #if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
     OS_CPU_SR  cpu_sr = 0u;
 #endif
@@ -621,6 +639,13 @@ INT8U  OSMboxPostOpt (OS_EVENT  *pevent,
         OS_TRACE_MBOX_POST_OPT_EXIT(OS_ERR_EVENT_TYPE);
         return (OS_ERR_EVENT_TYPE);
     }
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNesting > 0u) {                          /* Defer the post when called from an ISR        */
+        err = OSIntQ_Post(OS_INT_Q_MBOX_POST_OPT, (void *)pevent, pmsg, 0u, opt);
+        OS_TRACE_MBOX_POST_OPT_EXIT(err);
+        return (err);
+    }
+#endif
     OS_ENTER_CRITICAL();
     if (pevent->OSEventGrp != 0u) {                   /* See if any task pending on mailbox            */
         if ((opt & OS_POST_OPT_BROADCAST) != 0x00u) { /* Do we need to post msg to ALL waiting tasks ? */
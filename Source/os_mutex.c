@@ -47,13 +47,29 @@
 
 #define  OS_MUTEX_AVAILABLE      ((INT16U)0x00FFu)
 
+#if OS_MUTEX_INHERIT_EN > 0u                               /* See if 'pcp' is a priority ceiling       */
+#define  OS_MUTEX_HAS_PCP(pcp)   ((pcp) < OS_PRIO_MUTEX_INHERIT)
+#else
+#define  OS_MUTEX_HAS_PCP(pcp)   ((pcp) != OS_PRIO_MUTEX_CEIL_DIS)
+#endif
+
 /*
 *********************************************************************************************************
 *                                           LOCAL CONSTANTS
 *********************************************************************************************************
 */
 
-static  void  OSMutex_RdyAtPrio(OS_TCB *ptcb, INT8U prio);
+static  void     OSMutex_RdyAtPrio(OS_TCB *ptcb, INT8U prio);
+
+#if OS_MUTEX_FAST_EN > 0u
+static  BOOLEAN  OSMutex_PostFast(OS_EVENT *pevent);
+#endif
+
+#if OS_MUTEX_INHERIT_EN > 0u
+static  void     OSMutex_InheritLink(OS_TCB *ptcb, OS_EVENT *pevent);
+static  void     OSMutex_InheritUnlink(OS_TCB *ptcb, OS_EVENT *pevent);
+static  INT8U    OSMutex_InheritPrio(OS_TCB *ptcb);
+#endif
 
 
 /*
@@ -71,6 +87,7 @@ static  void  OSMutex_RdyAtPrio(OS_TCB *ptcb, INT8U prio);
 *                            OS_ERR_EVENT_TYPE   if 'pevent' is not a pointer to a mutex
 *                            OS_ERR_PEVENT_NULL  'pevent' is a NULL pointer
 *                            OS_ERR_PEND_ISR     if you called this function from an ISR
+*                            OS_ERR_MUTEX_NEST_OVF  if the owner acquired a nestable mutex too many times
 *                            OS_ERR_PCP_LOWER    If the priority of the task that owns the Mutex is
 *                                                HIGHER (i.e. a lower number) than the PCP.  This error
 *                                                indicates that you did not set the PCP higher (lower
@@ -121,13 +138,30 @@ BOOLEAN  OSMutexAccept (OS_EVENT  *pevent,
         *perr = OS_ERR_PEND_ISR;
         return (OS_FALSE);
     }
+#if OS_MUTEX_NEST_EN > 0u
+    if ((pevent->OSEventMutexOpt == OS_MUTEX_OPT_NESTABLE) &&
+        (pevent->OSEventPtr == (void *)OSTCBCur)) {    /* See if the owner acquires the mutex again    */
+        if (pevent->OSEventNestCtr == 65535u) {
+            *perr = OS_ERR_MUTEX_NEST_OVF;
+            return (OS_FALSE);
+        }
+        pevent->OSEventNestCtr++;                      /* Only the owner changes the nesting counter   */
+        *perr = OS_ERR_NONE;
+        return (OS_TRUE);
+    }
+#endif
     OS_ENTER_CRITICAL();                               /* Get value (0 or 1) of Mutex                  */
     pcp = (INT8U)(pevent->OSEventCnt >> 8u);           /* Get PCP from mutex                           */
-    if ((pevent->OSEventCnt & OS_MUTEX_KEEP_LOWER_8) == OS_MUTEX_AVAILABLE) {
+    if (pevent->OSEventPtr == (void *)0) {             /* See if no task owns the mutex                */
         pevent->OSEventCnt &= OS_MUTEX_KEEP_UPPER_8;   /*      Mask off LSByte (Acquire Mutex)         */
         pevent->OSEventCnt |= (INT16U)OSTCBCur->OSTCBPrio;  /* Save current task priority in LSByte    */
         pevent->OSEventPtr  = (void *)OSTCBCur;        /*      Link TCB of task owning Mutex           */
-        if ((pcp != OS_PRIO_MUTEX_CEIL_DIS) &&
+#if OS_MUTEX_INHERIT_EN > 0u
+        if (pcp == OS_PRIO_MUTEX_INHERIT) {
+            OSMutex_InheritLink(OSTCBCur, pevent);     /*      Add to the mutexes owned by the task    */
+        }
+#endif
+        if (OS_MUTEX_HAS_PCP(pcp) &&
             (OSTCBCur->OSTCBPrio <= pcp)) {            /*      PCP 'must' have a SMALLER prio ...      */
              OS_EXIT_CRITICAL();                       /*      ... than current task!                  */
             *perr = OS_ERR_PCP_LOWER;
@@ -157,7 +191,10 @@ BOOLEAN  OSMutexAccept (OS_EVENT  *pevent,
 *                            a priority that is LOWER in value than ANY of the tasks competing for the
 *                            mutex. If the priority is specified as OS_PRIO_MUTEX_CEIL_DIS, then the
 *                            priority ceiling promotion is disabled. This way, the tasks accessing the
-*                            semaphore do not have their priority promoted.
+*                            semaphore do not have their priority promoted.  When OS_MUTEX_INHERIT_EN is
+*                            set to 1, the priority can be specified as OS_PRIO_MUTEX_INHERIT.  The task
+*                            owning the semaphore then inherits the priority of the highest priority task
+*                            waiting for it and no priority is reserved.
 *
 *              perr          is a pointer to an error code which will be returned to your application:
 *                               OS_ERR_NONE                     if the call was successful.
@@ -180,7 +217,7 @@ BOOLEAN  OSMutexAccept (OS_EVENT  *pevent,
 *
 *              2) The MOST  significant 8 bits of '.OSEventCnt' hold the priority number used to
 *                 reduce priority inversion or 0xFF (OS_PRIO_MUTEX_CEIL_DIS) if priority ceiling
-*                 promotion is disabled.
+*                 promotion is disabled or 0xFE (OS_PRIO_MUTEX_INHERIT) if priority inheritance is used.
 *********************************************************************************************************
 */
 
@@ -210,7 +247,7 @@ OS_EVENT  *OSMutexCreate (INT8U   prio,
 #endif
 
 #if OS_ARG_CHK_EN > 0u
-    if (prio != OS_PRIO_MUTEX_CEIL_DIS) {
+    if (OS_MUTEX_HAS_PCP(prio)) {
         if (prio >= OS_LOWEST_PRIO) {                      /* Validate PCP                             */
            *perr = OS_ERR_PRIO_INVALID;
             return ((OS_EVENT *)0);
@@ -222,7 +259,7 @@ OS_EVENT  *OSMutexCreate (INT8U   prio,
         return ((OS_EVENT *)0);
     }
     OS_ENTER_CRITICAL();
-    if (prio != OS_PRIO_MUTEX_CEIL_DIS) {
+    if (OS_MUTEX_HAS_PCP(prio)) {
         if (OSTCBPrioTbl[prio] != (OS_TCB *)0) {           /* Mutex priority must not already exist    */
             OS_EXIT_CRITICAL();                            /* Task already exist at priority ...       */
            *perr = OS_ERR_PRIO_EXIST;                      /* ... ceiling priority                     */
@@ -233,7 +270,7 @@ OS_EVENT  *OSMutexCreate (INT8U   prio,
 
     pevent = OSEventFreeList;                              /* Get next free event control block        */
     if (pevent == (OS_EVENT *)0) {                         /* See if an ECB was available              */
-        if (prio != OS_PRIO_MUTEX_CEIL_DIS) {
+        if (OS_MUTEX_HAS_PCP(prio)) {
             OSTCBPrioTbl[prio] = (OS_TCB *)0;              /* No, Release the table entry              */
         }
         OS_EXIT_CRITICAL();
@@ -245,6 +282,10 @@ OS_EVENT  *OSMutexCreate (INT8U   prio,
     pevent->OSEventType = OS_EVENT_TYPE_MUTEX;
     pevent->OSEventCnt  = (INT16U)((INT16U)prio << 8u) | OS_MUTEX_AVAILABLE; /* Resource is avail.     */
     pevent->OSEventPtr  = (void *)0;                       /* No task owning the mutex                 */
+#if OS_MUTEX_NEST_EN > 0u
+    pevent->OSEventMutexOpt = OS_MUTEX_OPT_NONE;
+    pevent->OSEventNestCtr  = 0u;
+#endif
 #if OS_EVENT_NAME_EN > 0u
     pevent->OSEventName = (INT8U *)(void *)"?";
 #endif
@@ -255,6 +296,67 @@ OS_EVENT  *OSMutexCreate (INT8U   prio,
 }
 
 
+/*
+*********************************************************************************************************
+*                           CREATE A MUTUAL EXCLUSION SEMAPHORE WITH OPTIONS
+*
+* Description: This function creates a mutual exclusion semaphore like OSMutexCreate() does and applies
+*              the specified options to it.
+*
+* Arguments  : prio          is the priority to use when accessing the mutual exclusion semaphore (see
+*                            OSMutexCreate()).
+*
+*              opt           determines the behavior of the mutex:
+*                            opt == OS_MUTEX_OPT_NONE      Same as a mutex created with OSMutexCreate()
+*                            opt == OS_MUTEX_OPT_NESTABLE  The task owning the mutex may acquire it again
+*
+*              perr          is a pointer to an error code which will be returned to your application:
+*                               OS_ERR_NONE                     if the call was successful.
+*                               OS_ERR_INVALID_OPT              if an invalid option was specified.
+*                               Any other error returned by OSMutexCreate().
+*
+* Returns    : != (void *)0  is a pointer to the event control clock (OS_EVENT) associated with the
+*                            created mutex.
+*              == (void *)0  if an error is detected.
+*
+* Note(s)    : 1) Each time the owner acquires a nestable mutex again, '.OSEventNestCtr' is incremented
+*                 and the call returns right away.  The owner MUST call OSMutexPost() once per successful
+*                 acquisition; the mutex is only released by the last call.
+*********************************************************************************************************
+*/
+
+#if OS_MUTEX_NEST_EN > 0u
+OS_EVENT  *OSMutexCreateEx (INT8U   prio,
+                            INT8U   opt,
+                            INT8U  *perr)
+{
+    OS_EVENT  *pevent;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_EVENT *)0);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if ((opt != OS_MUTEX_OPT_NONE) &&                      /* Validate 'opt'                           */
+        (opt != OS_MUTEX_OPT_NESTABLE)) {
+       *perr = OS_ERR_INVALID_OPT;
+        return ((OS_EVENT *)0);
+    }
+#endif
+    pevent = OSMutexCreate(prio, perr);
+    if (pevent != (OS_EVENT *)0) {                         /* Not yet visible to other tasks           */
+        pevent->OSEventMutexOpt = opt;
+    }
+    return (pevent);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                           DELETE A MUTEX
@@ -359,9 +461,16 @@ OS_EVENT  *OSMutexDel (OS_EVENT  *pevent,
                  pevent->OSEventName   = (INT8U *)(void *)"?";
 #endif
                  pcp                   = (INT8U)(pevent->OSEventCnt >> 8u);
-                 if (pcp != OS_PRIO_MUTEX_CEIL_DIS) {
+                 if (OS_MUTEX_HAS_PCP(pcp)) {
                      OSTCBPrioTbl[pcp] = (OS_TCB *)0;      /* Free up the PCP                          */
                  }
+#if OS_MUTEX_INHERIT_EN > 0u
+                 ptcb                  = (OS_TCB *)pevent->OSEventPtr;
+                 if ((pcp  == OS_PRIO_MUTEX_INHERIT) &&
+                     (ptcb != (OS_TCB *)0)) {              /* Remove from the mutexes owned by owner   */
+                     OSMutex_InheritUnlink(ptcb, pevent);
+                 }
+#endif
                  pevent->OSEventType   = OS_EVENT_TYPE_UNUSED;
                  pevent->OSEventPtr    = OSEventFreeList;  /* Return Event Control Block to free list  */
                  pevent->OSEventCnt    = 0u;
@@ -378,7 +487,7 @@ OS_EVENT  *OSMutexDel (OS_EVENT  *pevent,
 
         case OS_DEL_ALWAYS:                                /* ALWAYS DELETE THE MUTEX ---------------- */
              pcp  = (INT8U)(pevent->OSEventCnt >> 8u);                       /* Get PCP of mutex       */
-             if (pcp != OS_PRIO_MUTEX_CEIL_DIS) {
+             if (OS_MUTEX_HAS_PCP(pcp)) {
                  prio = (INT8U)(pevent->OSEventCnt & OS_MUTEX_KEEP_LOWER_8); /* Get owner's orig prio  */
                  ptcb = (OS_TCB *)pevent->OSEventPtr;
                  if (ptcb != (OS_TCB *)0) {                /* See if any task owns the mutex           */
@@ -388,6 +497,14 @@ OS_EVENT  *OSMutexDel (OS_EVENT  *pevent,
                      }
                  }
              }
+#if OS_MUTEX_INHERIT_EN > 0u
+             ptcb = (OS_TCB *)pevent->OSEventPtr;
+             if ((pcp  == OS_PRIO_MUTEX_INHERIT) &&
+                 (ptcb != (OS_TCB *)0)) {                  /* See if any task owns the mutex           */
+                 OSMutex_InheritUnlink(ptcb, pevent);
+                 OSMutex_InheritChain(ptcb);               /* Give back the priority it inherited      */
+             }
+#endif
              while (pevent->OSEventGrp != 0u) {            /* Ready ALL tasks waiting for mutex        */
                  (void)OS_EventTaskRdy(pevent, (void *)0, OS_STAT_MUTEX, OS_STAT_PEND_ABORT);
              }
@@ -395,7 +512,7 @@ OS_EVENT  *OSMutexDel (OS_EVENT  *pevent,
              pevent->OSEventName   = (INT8U *)(void *)"?";
 #endif
              pcp                   = (INT8U)(pevent->OSEventCnt >> 8u);
-             if (pcp != OS_PRIO_MUTEX_CEIL_DIS) {
+             if (OS_MUTEX_HAS_PCP(pcp)) {
                  OSTCBPrioTbl[pcp] = (OS_TCB *)0;          /* Free up the PCP                          */
              }
              pevent->OSEventType   = OS_EVENT_TYPE_UNUSED;
@@ -455,12 +572,30 @@ OS_EVENT  *OSMutexDel (OS_EVENT  *pevent,
 *                                                  detected when the Mutex is created because we don't know
 *                                                  what tasks will be using the Mutex.
 *                               OS_ERR_PEND_LOCKED If you called this function when the scheduler is locked
+*                               OS_ERR_MUTEX_NEST_OVF If the owner acquired a nestable mutex too often
 *
 * Returns    : none
 *
 * Note(s)    : 1) The task that owns the Mutex MUST NOT pend on any other event while it owns the mutex.
 *
 *              2) You MUST NOT change the priority of the task that owns the mutex
+*
+*              3) When OS_MUTEX_FAST_EN is set to 1, a free mutex is acquired by setting its owner with
+*                 OS_CPU_CAS_PTR() and interrupts are not disabled.  The priority of the owner is saved
+*                 right after.  A task which pends in between saves it on behalf of the owner.  Mutexes
+*                 with priority inheritance are always acquired with interrupts disabled.
+*
+*              4) The owner of a mutex created with OS_PRIO_MUTEX_INHERIT runs at the priority of the
+*                 highest priority task waiting for it, when that is higher than its own.  Unlike in
+*                 Note #1, the owner may pend on another such mutex: the priority is then passed on to
+*                 the owner of that mutex, and so on.  The priority is given back when the mutex is
+*                 released or when the waiting task times out.  A task MUST NOT own a mutex with a PCP
+*                 and a mutex with priority inheritance at the same time.
+*
+*              5) When the owner pends again on a mutex created with OS_MUTEX_OPT_NESTABLE, the nesting
+*                 counter is incremented and the call returns at once, even with the scheduler locked.
+*                 No critical section is needed: only the owner can find itself in '.OSEventPtr' and
+*                 only the owner changes the counter.
 *********************************************************************************************************
 */
 
@@ -474,6 +609,9 @@ void  OSMutexPend (OS_EVENT  *pevent,
     OS_TCB    *ptcb;
     OS_EVENT  *pevent2;
     INT8U      y;
+#if OS_MUTEX_FAST_EN > 0u
+    INT8U      prio;
+#endif
 #if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
     OS_CPU_SR  cpu_sr = 0u;
 #endif
@@ -505,20 +643,54 @@ void  OSMutexPend (OS_EVENT  *pevent,
         OS_TRACE_MUTEX_PEND_EXIT(*perr);
         return;
     }
+#if OS_MUTEX_NEST_EN > 0u
+    if ((pevent->OSEventMutexOpt == OS_MUTEX_OPT_NESTABLE) &&
+        (pevent->OSEventPtr == (void *)OSTCBCur)) {        /* See if owner acquires it again (Note #5) */
+        if (pevent->OSEventNestCtr == 65535u) {
+            *perr = OS_ERR_MUTEX_NEST_OVF;
+        } else {
+            pevent->OSEventNestCtr++;
+            *perr = OS_ERR_NONE;
+        }
+        OS_TRACE_MUTEX_PEND_EXIT(*perr);
+        return;
+    }
+#endif
     if (OSLockNesting > 0u) {                              /* See if called with scheduler locked ...  */
         *perr = OS_ERR_PEND_LOCKED;                        /* ... can't PEND when locked               */
         OS_TRACE_MUTEX_PEND_EXIT(*perr);
         return;
     }
 
+#if OS_MUTEX_FAST_EN > 0u
+    pcp  = (INT8U)(pevent->OSEventCnt >> 8u);              /* PCP doesn't change, read it once         */
+    prio = OSTCBCur->OSTCBPrio;                            /* Acquire without disabling interrupts ... */
+    if ((pcp != OS_PRIO_MUTEX_INHERIT) &&                  /* ... unless owners are linked to it       */
+        (OS_CPU_CAS_PTR(&pevent->OSEventPtr, (void *)0, (void *)OSTCBCur) == OS_TRUE)) {
+        pevent->OSEventCnt = (INT16U)((INT16U)((INT16U)pcp << 8u) | (INT16U)prio); /* ... save prio   */
+        if ((pcp != OS_PRIO_MUTEX_CEIL_DIS) &&
+            (prio <= pcp)) {                               /* PCP 'must' have a SMALLER prio ...       */
+            *perr = OS_ERR_PCP_LOWER;                      /* ... than current task!                   */
+        } else {
+            *perr = OS_ERR_NONE;
+        }
+        OS_TRACE_MUTEX_PEND_EXIT(*perr);
+        return;
+    }
+#endif
+
     OS_ENTER_CRITICAL();
     pcp = (INT8U)(pevent->OSEventCnt >> 8u);               /* Get PCP from mutex                       */
-                                                           /* Is Mutex available?                      */
-    if ((INT8U)(pevent->OSEventCnt & OS_MUTEX_KEEP_LOWER_8) == OS_MUTEX_AVAILABLE) {
+    if (pevent->OSEventPtr == (void *)0) {                 /* Is Mutex available?                      */
         pevent->OSEventCnt &= OS_MUTEX_KEEP_UPPER_8;       /* Yes, Acquire the resource                */
         pevent->OSEventCnt |= (INT16U)OSTCBCur->OSTCBPrio; /*      Save priority of owning task        */
         pevent->OSEventPtr  = (void *)OSTCBCur;            /*      Point to owning task's OS_TCB       */
-        if ((pcp != OS_PRIO_MUTEX_CEIL_DIS) &&
+#if OS_MUTEX_INHERIT_EN > 0u
+        if (pcp == OS_PRIO_MUTEX_INHERIT) {
+            OSMutex_InheritLink(OSTCBCur, pevent);         /*      Add to the mutexes owned by task    */
+        }
+#endif
+        if (OS_MUTEX_HAS_PCP(pcp) &&
             (OSTCBCur->OSTCBPrio <= pcp)) {                /*      PCP 'must' have a SMALLER prio ...  */
              OS_EXIT_CRITICAL();                           /*      ... than current task!              */
             *perr = OS_ERR_PCP_LOWER;
@@ -529,17 +701,32 @@ void  OSMutexPend (OS_EVENT  *pevent,
         OS_TRACE_MUTEX_PEND_EXIT(*perr);
         return;
     }
-    if (pcp != OS_PRIO_MUTEX_CEIL_DIS) {
+    if (OS_MUTEX_HAS_PCP(pcp)) {
         mprio = (INT8U)(pevent->OSEventCnt & OS_MUTEX_KEEP_LOWER_8); /*  Get priority of mutex owner   */
         ptcb  = (OS_TCB *)(pevent->OSEventPtr);                   /*     Point to TCB of mutex owner   */
+#if OS_MUTEX_FAST_EN > 0u
+        if (mprio == (INT8U)OS_MUTEX_AVAILABLE) {                 /*     Owner's prio not saved yet    */
+            mprio               = ptcb->OSTCBPrio;                /*     ... save it (See Note #3)     */
+            pevent->OSEventCnt &= OS_MUTEX_KEEP_UPPER_8;
+            pevent->OSEventCnt |= (INT16U)mprio;
+        }
+#endif
         if (ptcb->OSTCBPrio > pcp) {                              /*     Need to promote prio of owner?*/
             if (mprio > OSTCBCur->OSTCBPrio) {
                 y = ptcb->OSTCBY;
+#if OS_SCHED_RR_EN > 0u
+                OS_SchedRRRemove(ptcb);                           /*     Owner leaves its priority     */
+                if (OS_SchedRRIsRdy(ptcb) == OS_TRUE) {           /*     See if mutex owner is ready   */
+#else
                 if ((OSRdyTbl[y] & ptcb->OSTCBBitX) != 0u) {      /*     See if mutex owner is ready   */
+#endif
                     OSRdyTbl[y] &= (OS_PRIO)~ptcb->OSTCBBitX;     /*     Yes, Remove owner from Rdy ...*/
                     if (OSRdyTbl[y] == 0u) {                      /*          ... list at current prio */
                         OSRdyGrp &= (OS_PRIO)~ptcb->OSTCBBitY;
                     }
+#if OS_SCHED_RR_EN > 0u
+                    OS_SchedRRRdyRestore(ptcb);                   /*     Others may be ready at prio   */
+#endif
                     rdy = OS_TRUE;
                 } else {
                     pevent2 = ptcb->OSTCBEventPtr;
@@ -549,6 +736,9 @@ void  OSMutexPend (OS_EVENT  *pevent,
                         if (pevent2->OSEventTbl[y] == 0u) {
                             pevent2->OSEventGrp &= (OS_PRIO)~ptcb->OSTCBBitY;
                         }
+#if OS_SCHED_RR_EN > 0u
+                        OS_SchedRREventRestore(ptcb, pevent2);    /* Others may wait at prio           */
+#endif
                     }
                     rdy = OS_FALSE;                        /* No                                       */
                 }
@@ -576,14 +766,26 @@ void  OSMutexPend (OS_EVENT  *pevent,
                         pevent2->OSEventTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
                     }
                 }
+#if OS_SCHED_RR_EN > 0u
+                OS_SchedRRInsert(ptcb);                    /* Takes over the reserved PCP              */
+#else
                 OSTCBPrioTbl[pcp] = ptcb;
+#endif
             }
         }
     }
     OSTCBCur->OSTCBStat     |= OS_STAT_MUTEX;         /* Mutex not available, pend current task        */
     OSTCBCur->OSTCBStatPend  = OS_STAT_PEND_OK;
     OSTCBCur->OSTCBDly       = timeout;               /* Store timeout in current task's TCB           */
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListInsert(OSTCBCur);                      /* Add task to the list of delayed tasks         */
+#endif
     OS_EventTaskWait(pevent);                         /* Suspend task until event or timeout occurs    */
+#if OS_MUTEX_INHERIT_EN > 0u
+    if (pcp == OS_PRIO_MUTEX_INHERIT) {               /* Owner inherits our priority (See Note #4)     */
+        OSMutex_InheritChain((OS_TCB *)pevent->OSEventPtr);
+    }
+#endif
     OS_EXIT_CRITICAL();
     OS_Sched();                                       /* Find next highest priority task ready         */
     OS_ENTER_CRITICAL();
@@ -599,6 +801,13 @@ void  OSMutexPend (OS_EVENT  *pevent,
         case OS_STAT_PEND_TO:
         default:
              OS_EventTaskRemove(OSTCBCur, pevent);
+#if OS_MUTEX_INHERIT_EN > 0u
+             ptcb = (OS_TCB *)pevent->OSEventPtr;
+             if ((pcp  == OS_PRIO_MUTEX_INHERIT) &&
+                 (ptcb != (OS_TCB *)0)) {             /* Owner no longer inherits our priority         */
+                 OSMutex_InheritChain(ptcb);
+             }
+#endif
              *perr = OS_ERR_TIMEOUT;                  /* Indicate that we didn't get mutex within TO   */
              break;
     }
@@ -636,6 +845,15 @@ void  OSMutexPend (OS_EVENT  *pevent,
 *                                      Unfortunately, this is something that could not be
 *                                      detected when the Mutex is created because we don't know
 *                                      what tasks will be using the Mutex.
+*
+* Note(s)    : 1) When OS_MUTEX_FAST_EN is set to 1 and no task waits for the mutex, it is released with
+*                 OS_CPU_CAS_PTR() and interrupts are not disabled (see OSMutex_PostFast()).
+*
+*              2) When the mutex was created with OS_PRIO_MUTEX_INHERIT, the task goes back to its own
+*                 priority or, to the priority it still inherits through the other mutexes it owns.
+*
+*              3) A mutex created with OS_MUTEX_OPT_NESTABLE is only released when the owner posts it as
+*                 many times as it acquired it.  The other posts just decrement the nesting counter.
 *********************************************************************************************************
 */
 
@@ -663,6 +881,20 @@ INT8U  OSMutexPost (OS_EVENT *pevent)
         OS_TRACE_MUTEX_POST_EXIT(OS_ERR_EVENT_TYPE);
         return (OS_ERR_EVENT_TYPE);
     }
+#if OS_MUTEX_NEST_EN > 0u
+    if ((pevent->OSEventNestCtr > 0u) &&
+        (pevent->OSEventPtr == (void *)OSTCBCur)) {   /* Owner undoes a nested acquisition (Note #3)   */
+        pevent->OSEventNestCtr--;
+        OS_TRACE_MUTEX_POST_EXIT(OS_ERR_NONE);
+        return (OS_ERR_NONE);
+    }
+#endif
+#if OS_MUTEX_FAST_EN > 0u
+    if (OSMutex_PostFast(pevent) == OS_TRUE) {        /* Released without disabling interrupts?        */
+        OS_TRACE_MUTEX_POST_EXIT(OS_ERR_NONE);
+        return (OS_ERR_NONE);
+    }
+#endif
     OS_ENTER_CRITICAL();
     pcp  = (INT8U)(pevent->OSEventCnt >> 8u);         /* Get priority ceiling priority of mutex        */
     prio = (INT8U)(pevent->OSEventCnt & OS_MUTEX_KEEP_LOWER_8);  /* Get owner's original priority      */
@@ -671,7 +903,13 @@ INT8U  OSMutexPost (OS_EVENT *pevent)
         OS_TRACE_MUTEX_POST_EXIT(OS_ERR_NOT_MUTEX_OWNER);
         return (OS_ERR_NOT_MUTEX_OWNER);
     }
-    if (pcp != OS_PRIO_MUTEX_CEIL_DIS) {
+#if OS_MUTEX_INHERIT_EN > 0u
+    if (pcp == OS_PRIO_MUTEX_INHERIT) {               /* Give back the priority inherited through it   */
+        OSMutex_InheritUnlink(OSTCBCur, pevent);
+        OSMutex_InheritChain(OSTCBCur);
+    }
+#endif
+    if (OS_MUTEX_HAS_PCP(pcp)) {
         if (OSTCBCur->OSTCBPrio == pcp) {             /* Did we have to raise current task's priority? */
             OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(OSTCBCur, prio);
             OSMutex_RdyAtPrio(OSTCBCur, prio);        /* Restore the task's original priority          */
@@ -683,8 +921,17 @@ INT8U  OSMutexPost (OS_EVENT *pevent)
         prio                = OS_EventTaskRdy(pevent, (void *)0, OS_STAT_MUTEX, OS_STAT_PEND_OK);
         pevent->OSEventCnt &= OS_MUTEX_KEEP_UPPER_8;  /*      Save priority of mutex's new owner       */
         pevent->OSEventCnt |= (INT16U)prio;
+#if OS_SCHED_RR_EN > 0u
+        pevent->OSEventPtr  = OSTCBPrioTbl[prio]->OSTCBPrioPrev;  /* Readied task is last at 'prio'    */
+#else
         pevent->OSEventPtr  = OSTCBPrioTbl[prio];     /*      Link to new mutex owner's OS_TCB         */
-        if ((pcp  != OS_PRIO_MUTEX_CEIL_DIS) &&
+#endif
+#if OS_MUTEX_INHERIT_EN > 0u
+        if (pcp == OS_PRIO_MUTEX_INHERIT) {           /*      Add to the mutexes owned by new owner    */
+            OSMutex_InheritLink((OS_TCB *)pevent->OSEventPtr, pevent);
+        }
+#endif
+        if (OS_MUTEX_HAS_PCP(pcp) &&
             (prio <= pcp)) {                          /*      PCP 'must' have a SMALLER prio ...       */
             OS_EXIT_CRITICAL();                       /*      ... than current task!                   */
             OS_Sched();                               /*      Find highest priority task ready to run  */
@@ -752,11 +999,12 @@ INT8U  OSMutexQuery (OS_EVENT       *pevent,
     }
     OS_ENTER_CRITICAL();
     p_mutex_data->OSMutexPCP  = (INT8U)(pevent->OSEventCnt >> 8u);
-    p_mutex_data->OSOwnerPrio = (INT8U)(pevent->OSEventCnt & OS_MUTEX_KEEP_LOWER_8);
-    if (p_mutex_data->OSOwnerPrio == 0xFFu) {
-        p_mutex_data->OSValue = OS_TRUE;
+    if (pevent->OSEventPtr == (void *)0) {                 /* See if no task owns the mutex            */
+        p_mutex_data->OSOwnerPrio = 0xFFu;
+        p_mutex_data->OSValue     = OS_TRUE;
     } else {
-        p_mutex_data->OSValue = OS_FALSE;
+        p_mutex_data->OSOwnerPrio = (INT8U)(pevent->OSEventCnt & OS_MUTEX_KEEP_LOWER_8);
+        p_mutex_data->OSValue     = OS_FALSE;
     }
     p_mutex_data->OSEventGrp  = pevent->OSEventGrp;        /* Copy wait list                           */
     psrc                      = &pevent->OSEventTbl[0];
@@ -796,6 +1044,9 @@ static  void  OSMutex_RdyAtPrio (OS_TCB  *ptcb,
     if (OSRdyTbl[y] == 0u) {
         OSRdyGrp &= (OS_PRIO)~ptcb->OSTCBBitY;
     }
+#if OS_SCHED_RR_EN > 0u
+    OS_SchedRRRemove(ptcb);                                /* Leave the PCP                            */
+#endif
     ptcb->OSTCBPrio         = prio;
     OSPrioCur               = prio;                        /* The current task is now at this priority */
 #if OS_LOWEST_PRIO <= 63u
@@ -809,10 +1060,199 @@ static  void  OSMutex_RdyAtPrio (OS_TCB  *ptcb,
     ptcb->OSTCBBitX         = (OS_PRIO)(1uL << ptcb->OSTCBX);
     OSRdyGrp               |= ptcb->OSTCBBitY;             /* Make task ready at original priority     */
     OSRdyTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+#if OS_SCHED_RR_EN > 0u
+    OS_SchedRRInsert(ptcb);                                /* Back with the tasks at its priority      */
+#else
     OSTCBPrioTbl[prio]      = ptcb;
+#endif
     OS_TRACE_TASK_READY(ptcb);
 }
 
 
+/*
+*********************************************************************************************************
+*                              RELEASE A MUTEX WITHOUT DISABLING INTERRUPTS
+*
+* Description: This function is called by OSMutexPost() to release the mutex with OS_CPU_CAS_PTR() when
+*              the current task owns it, was not raised to the PCP and no task waits for it.
+*
+* Arguments  : pevent          is a pointer to the event control block of the mutex
+*
+* Returns    : OS_TRUE         if the mutex was released
+*              OS_FALSE        if the current task still owns the mutex and OSMutexPost() must release it
+*
+* Note(s)    : 1) A task may pend on the mutex, and raise the owner to the PCP, just before the owner is
+*                 cleared.  This is detected afterwards: the current task takes the mutex back unless a
+*                 higher priority task already got it, and OSMutexPost() releases it the regular way.
+*********************************************************************************************************
+*/
+
+#if OS_MUTEX_FAST_EN > 0u
+static  BOOLEAN  OSMutex_PostFast (OS_EVENT  *pevent)
+{
+    INT8U      pcp;
+    INT8U      prio;
+#if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+    pcp  = (INT8U)(pevent->OSEventCnt >> 8u);
+#if OS_MUTEX_INHERIT_EN > 0u
+    if (pcp == OS_PRIO_MUTEX_INHERIT) {                    /* Owners are linked to these mutexes       */
+        return (OS_FALSE);
+    }
+#endif
+    prio = (INT8U)(pevent->OSEventCnt & OS_MUTEX_KEEP_LOWER_8);
+    if ((pevent->OSEventPtr != (void *)OSTCBCur) ||        /* Must own the mutex, ...                  */
+        (OSTCBCur->OSTCBPrio != prio)            ||        /* ... at its original priority ...         */
+        (pevent->OSEventGrp  != 0u)) {                     /* ... with no task waiting                 */
+        return (OS_FALSE);
+    }
+    pevent->OSEventCnt = (INT16U)((INT16U)((INT16U)pcp << 8u) | OS_MUTEX_AVAILABLE);
+                                                           /* Only the owner clears it, can't fail     */
+    (void)OS_CPU_CAS_PTR(&pevent->OSEventPtr, (void *)OSTCBCur, (void *)0);
+    if ((pevent->OSEventGrp == 0u) &&                      /* Still nobody waiting?                    */
+        (OSTCBCur->OSTCBPrio == prio)) {
+        return (OS_TRUE);
+    }
+    OS_ENTER_CRITICAL();                                   /* A task pended meanwhile (See Note #1)    */
+    if (pevent->OSEventPtr == (void *)0) {                 /* Take the mutex back                      */
+        pevent->OSEventCnt &= OS_MUTEX_KEEP_UPPER_8;
+        pevent->OSEventCnt |= (INT16U)prio;
+        pevent->OSEventPtr  = (void *)OSTCBCur;
+        OS_EXIT_CRITICAL();
+        return (OS_FALSE);
+    }
+    if ((pcp != OS_PRIO_MUTEX_CEIL_DIS) &&                 /* Got by a higher priority task, ...       */
+        (OSTCBCur->OSTCBPrio == pcp)) {                    /* ... only restore our priority            */
+        OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(OSTCBCur, prio);
+        OSMutex_RdyAtPrio(OSTCBCur, prio);
+        OSTCBPrioTbl[pcp] = OS_TCB_RESERVED;
+    }
+    OS_EXIT_CRITICAL();
+    OS_Sched();
+    return (OS_TRUE);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  PRIORITY INHERITANCE: OWNED MUTEXES
+*
+* Description: The mutexes created with OS_PRIO_MUTEX_INHERIT that a task owns are linked together, from
+*              ptcb->OSTCBMutexHeld through .OSEventMutexNext, so that the priority of the task can be
+*              computed again when one of them is released or a waiting task gives up.
+*
+*              OSMutex_InheritLink()    adds 'pevent' to the mutexes owned by 'ptcb'.
+*
+*              OSMutex_InheritUnlink()  removes 'pevent' from the mutexes owned by 'ptcb'.
+*
+*              OSMutex_InheritPrio()    returns the priority 'ptcb' must run at: the highest of its own
+*                                       priority and of the priority of the tasks waiting for the mutexes
+*                                       it owns.
+*
+*              OSMutex_InheritChain()   moves 'ptcb' to the priority returned by OSMutex_InheritPrio().
+*                                       If 'ptcb' itself waits for a mutex with priority inheritance, the
+*                                       owner of that mutex is done next and so on, until a task doesn't
+*                                       change priority.
+*
+* Arguments  : ptcb      is a pointer to the TCB of the task owning the mutex(es).
+*
+*              pevent    is a pointer to the event control block of the mutex.
+*
+* Note(s)    : 1) These functions assume that interrupts are disabled.
+*              2) Mutexes are usually released in the reverse order they were acquired, so the mutex to
+*                 unlink is normally the first one.
+*              3) OSMutex_InheritChain() is also called by OSTaskChangePrio() once it changed the base
+*                 priority of a task, which keeps any priority it inherited.
+*              4) A task waiting for a RW lock is also marked OS_STAT_MUTEX (see OS_STAT_RWLOCK).  The
+*                 type of the event is thus checked before '.OSEventCnt' is taken for the PCP of a mutex.
+*********************************************************************************************************
+*/
+
+#if OS_MUTEX_INHERIT_EN > 0u
+static  void  OSMutex_InheritLink (OS_TCB    *ptcb,
+                                   OS_EVENT  *pevent)
+{
+    pevent->OSEventMutexNext = ptcb->OSTCBMutexHeld;
+    ptcb->OSTCBMutexHeld     = pevent;
+}
+
+
+static  void  OSMutex_InheritUnlink (OS_TCB    *ptcb,
+                                     OS_EVENT  *pevent)
+{
+    OS_EVENT  **ppevent;
+
+
+    ppevent = &ptcb->OSTCBMutexHeld;
+    while (*ppevent != (OS_EVENT *)0) {                    /* See Note #2                              */
+        if (*ppevent == pevent) {
+            *ppevent                 = pevent->OSEventMutexNext;
+            pevent->OSEventMutexNext = (OS_EVENT *)0;
+            return;
+        }
+        ppevent = &(*ppevent)->OSEventMutexNext;
+    }
+}
+
+
+static  INT8U  OSMutex_InheritPrio (OS_TCB  *ptcb)
+{
+    OS_EVENT  *pevent;
+    INT8U      prio;
+    INT8U      wprio;
+
+
+    prio   = ptcb->OSTCBBasePrio;
+    pevent = ptcb->OSTCBMutexHeld;
+    while (pevent != (OS_EVENT *)0) {
+        if (pevent->OSEventGrp != 0u) {                    /* Find HPT waiting for the mutex           */
+            wprio = OS_EventWaitPrioGet(pevent);
+            if (wprio < prio) {
+                prio = wprio;
+            }
+        }
+        pevent = pevent->OSEventMutexNext;
+    }
+    return (prio);
+}
+
+
+void  OSMutex_InheritChain (OS_TCB  *ptcb)
+{
+    OS_EVENT  *pevent;
+    INT8U      prio;
+
+
+    for (;;) {
+        prio = OSMutex_InheritPrio(ptcb);
+        if (prio == ptcb->OSTCBPrio) {                     /* Done when a task keeps its priority      */
+            return;
+        }
+        if (prio < ptcb->OSTCBPrio) {
+            OS_TRACE_MUTEX_TASK_PRIO_INHERIT(ptcb, prio);
+        } else {
+            OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(ptcb, prio);
+        }
+        OS_TCBPrioSet(ptcb, prio);                         /* Also moves it in the wait list it is in  */
+        pevent = ptcb->OSTCBEventPtr;
+        if ((pevent == (OS_EVENT *)0)                       ||
+            ((ptcb->OSTCBStat & OS_STAT_MUTEX) == 0u)       ||
+            (pevent->OSEventType != OS_EVENT_TYPE_MUTEX)    ||
+            ((INT8U)(pevent->OSEventCnt >> 8u) != OS_PRIO_MUTEX_INHERIT)) {
+            return;                                        /* Not waiting for a mutex with inheritance */
+        }
+        ptcb = (OS_TCB *)pevent->OSEventPtr;               /* Pass the priority on to its owner        */
+        if (ptcb == (OS_TCB *)0) {
+            return;
+        }
+    }
+}
+#endif
+
+
 #endif                                                     /* OS_MUTEX_EN                              */
 #endif                                                     /* OS_MUTEX_C                               */
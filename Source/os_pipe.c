@@ -0,0 +1,864 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-II
+*                                        The Real-Time Kernel
+*
+*                    Copyright 1992-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*
+*                                          BYTE PIPE MANAGEMENT
+*
+* Filename : os_pipe.c
+* Version  : V2.93.01
+*********************************************************************************************************
+*/
+
+#ifndef  OS_PIPE_C
+#define  OS_PIPE_C
+
+#define  MICRIUM_SOURCE
+
+#ifndef  OS_MASTER_FILE
+#include <ucos_ii.h>
+#endif
+
+#if (OS_PIPE_EN > 0u) && (OS_MAX_PIPES > 0u)
+/*
+*********************************************************************************************************
+*                                                        NOTES
+*
+* 1) A pipe carries a stream of bytes from ONE writer task to ONE reader task.  Several writers (or
+*    readers) MUST serialize their accesses, e.g. with a mutex.  Use a ring buffer (see os_ring.c) to pass
+*    bytes from an ISR.
+*
+* 2) The writer only moves 'OSPipeIn' and the reader only moves 'OSPipeOut'.  The bytes are thus copied
+*    with interrupts enabled.  Interrupts are only disabled to publish the new index and to see whether
+*    the task at the other end must be readied.
+*
+* 3) The reader waits until at least 'min_len' bytes are present.  A writer that finds the pipe full waits
+*    until all of its remaining bytes fit, or until the pipe is empty if they can't all fit at once.  A
+*    reader that must wait first readies the waiting writer, which fills the pipe up.  The reader and the
+*    writer thus never wait at the same time, so they share the wait list of the pipe.
+*
+* 4) The bytes are copied one 32-bit word at a time when the source and the destination are aligned
+*    alike.  One entry of the storage area is always left empty, to tell a full pipe from an empty one.
+*********************************************************************************************************
+*/
+
+#define  OS_PIPE_WORD_MSK         (sizeof(INT32U) - 1u)                   /* Alignment of a word       */
+#define  OS_PIPE_ADDR_LSB(p)      ((INT8U)((OS_CPU_ADDR)(p) & OS_PIPE_WORD_MSK))
+
+/*
+*********************************************************************************************************
+*                                          LOCAL PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  INT16U   OS_PipeAdvance  (OS_PIPE *ppipe, INT16U ix, INT16U n);
+static  INT16U   OS_PipeCnt      (OS_PIPE *ppipe);
+static  void     OS_PipeCopy     (INT8U *pdest, INT8U *psrc, INT16U len);
+static  INT16U   OS_PipeGet      (OS_PIPE *ppipe, INT8U *pbuf, INT16U len);
+static  INT16U   OS_PipePut      (OS_PIPE *ppipe, INT8U *pbuf, INT16U len);
+static  BOOLEAN  OS_PipeRdy      (OS_EVENT *pevent, OS_PIPE *ppipe);
+static  void     OS_PipeWait     (OS_EVENT *pevent, INT32U timeout);
+
+
+/*
+*********************************************************************************************************
+*                                           CREATE A PIPE
+*
+* Description: This function creates a pipe to pass a stream of bytes from a task to another task.
+*
+* Arguments  : pbuf          is a pointer to the storage area of the pipe.  It should be aligned on a
+*                            32-bit boundary for the bytes to be copied one word at a time.
+*
+*              size          is the size of the storage area (in bytes).  The pipe holds up to 'size' - 1
+*                            bytes.
+*
+* Returns    : != (OS_EVENT *)0  is a pointer to the event control block (OS_EVENT) associated with the
+*                                created pipe
+*              == (OS_EVENT *)0  if no event control blocks were available or an error was detected
+*********************************************************************************************************
+*/
+
+OS_EVENT  *OSPipeCreate (void    *pbuf,
+                         INT16U   size)
+{
+    OS_EVENT  *pevent;
+    OS_PIPE   *ppipe;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_EVENT *)0);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pbuf == (void *)0) {                     /* Validate 'pbuf'                                    */
+        return ((OS_EVENT *)0);
+    }
+    if (size < 2u) {                             /* Must hold at least one byte                        */
+        return ((OS_EVENT *)0);
+    }
+#endif
+
+    if (OSIntNesting > 0u) {                     /* See if called from ISR ...                         */
+        return ((OS_EVENT *)0);                  /* ... can't CREATE from an ISR                       */
+    }
+    OS_ENTER_CRITICAL();
+    pevent = OSEventFreeList;                    /* Get next free event control block                  */
+    if (OSEventFreeList != (OS_EVENT *)0) {      /* See if pool of free ECB pool was empty             */
+        OSEventFreeList = (OS_EVENT *)OSEventFreeList->OSEventPtr;
+    }
+    OS_EXIT_CRITICAL();
+    if (pevent != (OS_EVENT *)0) {               /* See if we have an event control block              */
+        OS_ENTER_CRITICAL();
+        ppipe = OSPipeFreeList;                  /* Get a free pipe control block                      */
+        if (ppipe != (OS_PIPE *)0) {
+            OSPipeFreeList         = OSPipeFreeList->OSPipePtr;
+            OS_EXIT_CRITICAL();
+            ppipe->OSPipeStart     = (INT8U *)pbuf;       /*      Initialize the pipe                  */
+            ppipe->OSPipeSize      = size;
+            ppipe->OSPipeIn        = 0u;
+            ppipe->OSPipeOut       = 0u;
+            ppipe->OSPipeRdLvl     = 0u;
+            ppipe->OSPipeWrLvl     = 0u;
+            pevent->OSEventType    = OS_EVENT_TYPE_PIPE;
+            pevent->OSEventCnt     = 0u;
+            pevent->OSEventPtr     = ppipe;
+#if OS_EVENT_NAME_EN > 0u
+            pevent->OSEventName    = (INT8U *)(void *)"?";
+#endif
+            OS_EventWaitListInit(pevent);                 /*      Initialize the wait list             */
+        } else {
+            pevent->OSEventPtr = (void *)OSEventFreeList; /* No,  Return event control block on error  */
+            OSEventFreeList    = pevent;
+            OS_EXIT_CRITICAL();
+            pevent = (OS_EVENT *)0;
+        }
+    }
+    return (pevent);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            DELETE A PIPE
+*
+* Description: This function deletes a pipe and readies the task pending on it, if any.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired pipe.
+*
+*              opt           determines delete options as follows:
+*                            opt == OS_DEL_NO_PEND   Delete the pipe ONLY if no task pending
+*                            opt == OS_DEL_ALWAYS    Deletes the pipe even if a task is waiting.
+*                                                    In this case, the task will be readied.
+*
+*              perr          is a pointer to an error code that can contain one of the following values:
+*                            OS_ERR_NONE                  The call was successful and the pipe was deleted
+*                            OS_ERR_DEL_ISR               If you tried to delete the pipe from an ISR
+*                            OS_ERR_ILLEGAL_DEL_RUN_TIME  If you tried to delete the pipe after safety
+*                                                         critical operation started.
+*                            OS_ERR_INVALID_OPT           An invalid option was specified
+*                            OS_ERR_TASK_WAITING          A task was waiting on the pipe
+*                            OS_ERR_EVENT_TYPE            If you didn't pass a pointer to a pipe
+*                            OS_ERR_PEVENT_NULL           If 'pevent' is a NULL pointer.
+*
+* Returns    : pevent        upon error
+*              (OS_EVENT *)0 if the pipe was successfully deleted.
+*
+* Note(s)    : 1) The task that was waiting for the pipe will be readied and returned an OS_ERR_PEND_ABORT
+*                 if OSPipeDel() was called with OS_DEL_ALWAYS.
+*              2) The reader and the writer MUST not be in the middle of a copy when the pipe is deleted.
+*********************************************************************************************************
+*/
+
+#if OS_PIPE_DEL_EN > 0u
+OS_EVENT  *OSPipeDel (OS_EVENT  *pevent,
+                      INT8U      opt,
+                      INT8U     *perr)
+{
+    BOOLEAN    tasks_waiting;
+    OS_PIPE   *ppipe;
+#if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_EVENT *)0);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        *perr = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return ((OS_EVENT *)0);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {                         /* Validate 'pevent'                        */
+        *perr = OS_ERR_PEVENT_NULL;
+        return (pevent);
+    }
+#endif
+    if (pevent->OSEventType != OS_EVENT_TYPE_PIPE) {       /* Validate event block type                */
+        *perr = OS_ERR_EVENT_TYPE;
+        return (pevent);
+    }
+    if (OSIntNesting > 0u) {                               /* See if called from ISR ...               */
+        *perr = OS_ERR_DEL_ISR;                            /* ... can't DELETE from an ISR             */
+        return (pevent);
+    }
+    OS_ENTER_CRITICAL();
+    if (pevent->OSEventGrp != 0u) {                        /* See if a task is waiting on the pipe     */
+        tasks_waiting = OS_TRUE;                           /* Yes                                      */
+    } else {
+        tasks_waiting = OS_FALSE;                          /* No                                       */
+    }
+    switch (opt) {
+        case OS_DEL_NO_PEND:                               /* Delete pipe only if no task waiting      */
+             if (tasks_waiting == OS_TRUE) {
+                 OS_EXIT_CRITICAL();
+                 *perr = OS_ERR_TASK_WAITING;
+                 return (pevent);
+             }
+             break;
+
+        case OS_DEL_ALWAYS:                                /* Always delete the pipe                   */
+             while (pevent->OSEventGrp != 0u) {            /* Ready the task waiting for the pipe      */
+                 (void)OS_EventTaskRdy(pevent, (void *)0, OS_STAT_STREAM, OS_STAT_PEND_ABORT);
+             }
+             break;
+
+        default:
+             OS_EXIT_CRITICAL();
+             *perr = OS_ERR_INVALID_OPT;
+             return (pevent);
+    }
+#if OS_EVENT_NAME_EN > 0u
+    pevent->OSEventName    = (INT8U *)(void *)"?";
+#endif
+    ppipe                  = (OS_PIPE *)pevent->OSEventPtr;   /* Return OS_PIPE to free list           */
+    ppipe->OSPipePtr       = OSPipeFreeList;
+    OSPipeFreeList         = ppipe;
+    pevent->OSEventType    = OS_EVENT_TYPE_UNUSED;
+    pevent->OSEventPtr     = OSEventFreeList;              /* Return Event Control Block to free list  */
+    pevent->OSEventCnt     = 0u;
+    OSEventFreeList        = pevent;
+    OS_EXIT_CRITICAL();
+    if (tasks_waiting == OS_TRUE) {                        /* Reschedule only if a task was waiting    */
+        OS_Sched();                                        /* Find highest priority task ready to run  */
+    }
+    *perr = OS_ERR_NONE;
+    return ((OS_EVENT *)0);                                /* Pipe has been deleted                    */
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          READ FROM A PIPE
+*
+* Description: This function takes up to 'len' bytes out of a pipe.  If fewer than 'min_len' bytes are
+*              present, the task waits until the writer brings the pipe up to 'min_len' bytes or until
+*              the timeout expires.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired pipe.
+*
+*              pbuf          is a pointer to where the bytes are copied.
+*
+*              len           is the maximum number of bytes to read.
+*
+*              min_len       is the number of bytes that must be present before the bytes are read (the
+*                            trigger level of the reader).  0 reads whatever is present without waiting.
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will
+*                            wait for the data up to the amount of time specified by this argument.  If
+*                            you specify 0, however, your task will wait forever.
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE             The call was successful
+*                            OS_ERR_TIMEOUT          Fewer than 'min_len' bytes were written within the
+*                                                    specified 'timeout'.  The bytes present are returned.
+*                            OS_ERR_PEND_ABORT       The pipe was deleted while the task was waiting.
+*                            OS_ERR_EVENT_TYPE       If you didn't pass a pointer to a pipe
+*                            OS_ERR_PEVENT_NULL      If 'pevent' is a NULL pointer
+*                            OS_ERR_PDATA_NULL       If 'pbuf' is a NULL pointer
+*                            OS_ERR_PIPE_LEVEL       If 'min_len' is larger than 'len' or than what the
+*                                                    pipe can hold
+*                            OS_ERR_PEND_ISR         If you called this function from an ISR
+*                            OS_ERR_PEND_LOCKED      If you called this function with the scheduler locked
+*                                                    and the result would lead to a suspension.
+*
+* Returns    : The number of bytes copied to 'pbuf'.
+*********************************************************************************************************
+*/
+
+INT16U  OSPipeRead (OS_EVENT  *pevent,
+                    void      *pbuf,
+                    INT16U     len,
+                    INT16U     min_len,
+                    INT32U     timeout,
+                    INT8U     *perr)
+{
+    OS_PIPE   *ppipe;
+    INT16U     n;
+    BOOLEAN    sched;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {                    /* Validate 'pevent'                             */
+        *perr = OS_ERR_PEVENT_NULL;
+        return (0u);
+    }
+    if (pbuf == (void *)0) {                          /* Validate 'pbuf'                               */
+        *perr = OS_ERR_PDATA_NULL;
+        return (0u);
+    }
+#endif
+    if (pevent->OSEventType != OS_EVENT_TYPE_PIPE) {  /* Validate event block type                     */
+        *perr = OS_ERR_EVENT_TYPE;
+        return (0u);
+    }
+    ppipe = (OS_PIPE *)pevent->OSEventPtr;
+    if ((min_len > len) ||                            /* Validate 'min_len'                            */
+        (min_len >= ppipe->OSPipeSize)) {
+        *perr = OS_ERR_PIPE_LEVEL;
+        return (0u);
+    }
+    if (OSIntNesting > 0u) {                          /* See if called from ISR ...                    */
+        *perr = OS_ERR_PEND_ISR;                      /* ... pipes are for tasks only (see Note #1)    */
+        return (0u);
+    }
+    *perr = OS_ERR_NONE;
+    if (OS_PipeCnt(ppipe) < min_len) {                /* Must we wait for more data?                   */
+        if (OSLockNesting > 0u) {                     /* See if called with scheduler locked ...       */
+            *perr = OS_ERR_PEND_LOCKED;               /* ... can't PEND when locked                    */
+            return (0u);
+        }
+        OS_ENTER_CRITICAL();
+        if (OS_PipeCnt(ppipe) < min_len) {
+            if (ppipe->OSPipeWrLvl != 0u) {           /* Let the waiting writer fill up the pipe       */
+                ppipe->OSPipeWrLvl = 0u;
+                if (pevent->OSEventGrp != 0u) {
+                    (void)OS_EventTaskRdy(pevent, (void *)0, OS_STAT_STREAM, OS_STAT_PEND_OK);
+                }
+            }
+            ppipe->OSPipeRdLvl = min_len;             /* Tell the writer when to ready us              */
+            OS_PipeWait(pevent, timeout);
+            OS_EXIT_CRITICAL();
+            OS_Sched();                               /* Find next highest priority task ready         */
+            OS_ENTER_CRITICAL();
+            switch (OSTCBCur->OSTCBStatPend) {        /* See if we timed-out or aborted                */
+                case OS_STAT_PEND_OK:
+                     break;
+
+                case OS_STAT_PEND_ABORT:
+                     *perr = OS_ERR_PEND_ABORT;       /* The pipe was deleted                          */
+                     break;
+
+                case OS_STAT_PEND_TO:
+                default:
+                     OS_EventTaskRemove(OSTCBCur, pevent);
+                     ppipe->OSPipeRdLvl = 0u;
+                     *perr = OS_ERR_TIMEOUT;
+                     break;
+            }
+            OSTCBCur->OSTCBStat          =  OS_STAT_RDY;      /* Set   task  status to ready           */
+            OSTCBCur->OSTCBStatPend      =  OS_STAT_PEND_OK;  /* Clear pend  status                    */
+            OSTCBCur->OSTCBEventPtr      = (OS_EVENT  *)0;    /* Clear event pointers                  */
+#if (OS_EVENT_MULTI_EN > 0u)
+            OSTCBCur->OSTCBEventMultiPtr = (OS_EVENT **)0;
+            OSTCBCur->OSTCBEventMultiRdy = (OS_EVENT  *)0;
+#endif
+        }
+        OS_EXIT_CRITICAL();
+        if (*perr == OS_ERR_PEND_ABORT) {
+            return (0u);
+        }
+    }
+    n = OS_PipeGet(ppipe, (INT8U *)pbuf, len);        /* Copy the bytes with interrupts enabled        */
+    if (n > 0u) {
+        OS_ENTER_CRITICAL();
+        ppipe->OSPipeOut = OS_PipeAdvance(ppipe, ppipe->OSPipeOut, n);   /* Free the space             */
+        sched            = OS_PipeRdy(pevent, ppipe);                    /* Ready the writer if needed */
+        OS_EXIT_CRITICAL();
+        if (sched == OS_TRUE) {
+            OS_Sched();
+        }
+    }
+    return (n);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           WRITE TO A PIPE
+*
+* Description: This function copies 'len' bytes into a pipe.  If the pipe fills up, the task waits for
+*              the reader to make room and copies the remaining bytes.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired pipe.
+*
+*              pbuf          is a pointer to the bytes to write.
+*
+*              len           is the number of bytes to write.
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will
+*                            wait for room in the pipe up to the amount of time specified by this
+*                            argument, each time the pipe is full.  If you specify 0, however, your task
+*                            will wait forever.
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE             All the bytes were written
+*                            OS_ERR_TIMEOUT          The pipe stayed full for the specified 'timeout'
+*                            OS_ERR_PEND_ABORT       The pipe was deleted while the task was waiting.
+*                            OS_ERR_EVENT_TYPE       If you didn't pass a pointer to a pipe
+*                            OS_ERR_PEVENT_NULL      If 'pevent' is a NULL pointer
+*                            OS_ERR_PDATA_NULL       If 'pbuf' is a NULL pointer
+*                            OS_ERR_PEND_ISR         If you called this function from an ISR
+*                            OS_ERR_PEND_LOCKED      If you called this function with the scheduler locked
+*                                                    and the pipe is full.
+*
+* Returns    : The number of bytes written.  It is lower than 'len' upon error.
+*********************************************************************************************************
+*/
+
+INT16U  OSPipeWrite (OS_EVENT  *pevent,
+                     void      *pbuf,
+                     INT16U     len,
+                     INT32U     timeout,
+                     INT8U     *perr)
+{
+    OS_PIPE   *ppipe;
+    INT8U     *psrc;
+    INT16U     nbr_wr;
+    INT16U     n;
+    BOOLEAN    sched;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {                    /* Validate 'pevent'                             */
+        *perr = OS_ERR_PEVENT_NULL;
+        return (0u);
+    }
+    if (pbuf == (void *)0) {                          /* Validate 'pbuf'                               */
+        *perr = OS_ERR_PDATA_NULL;
+        return (0u);
+    }
+#endif
+    if (pevent->OSEventType != OS_EVENT_TYPE_PIPE) {  /* Validate event block type                     */
+        *perr = OS_ERR_EVENT_TYPE;
+        return (0u);
+    }
+    if (OSIntNesting > 0u) {                          /* See if called from ISR ...                    */
+        *perr = OS_ERR_PEND_ISR;                      /* ... pipes are for tasks only (see Note #1)    */
+        return (0u);
+    }
+    ppipe  = (OS_PIPE *)pevent->OSEventPtr;
+    psrc   = (INT8U *)pbuf;
+    nbr_wr = 0u;
+    *perr  = OS_ERR_NONE;
+    while (nbr_wr < len) {
+        n       = OS_PipePut(ppipe, psrc, len - nbr_wr);   /* Copy with interrupts enabled             */
+        psrc   += n;
+        nbr_wr += n;
+        OS_ENTER_CRITICAL();
+        ppipe->OSPipeIn = OS_PipeAdvance(ppipe, ppipe->OSPipeIn, n);     /* Publish the bytes          */
+        sched           = OS_PipeRdy(pevent, ppipe);                     /* Ready the reader if needed */
+        if ((nbr_wr == len) ||                        /* Done, or room left for the remaining bytes    */
+            (OS_PipeCnt(ppipe) < (ppipe->OSPipeSize - 1u))) {
+            OS_EXIT_CRITICAL();
+            if (sched == OS_TRUE) {
+                OS_Sched();
+            }
+        } else if (OSLockNesting > 0u) {              /* See if called with scheduler locked ...       */
+            OS_EXIT_CRITICAL();
+            *perr = OS_ERR_PEND_LOCKED;               /* ... can't PEND when locked                    */
+            break;
+        } else {                                      /* Pipe full, wait for the reader (see Note #3)  */
+            ppipe->OSPipeWrLvl = len - nbr_wr;
+            if (ppipe->OSPipeWrLvl > (ppipe->OSPipeSize - 1u)) {
+                ppipe->OSPipeWrLvl = ppipe->OSPipeSize - 1u;
+            }
+            OS_PipeWait(pevent, timeout);
+            OS_EXIT_CRITICAL();
+            OS_Sched();                               /* Find next highest priority task ready         */
+            OS_ENTER_CRITICAL();
+            switch (OSTCBCur->OSTCBStatPend) {        /* See if we timed-out or aborted                */
+                case OS_STAT_PEND_OK:
+                     break;
+
+                case OS_STAT_PEND_ABORT:
+                     *perr = OS_ERR_PEND_ABORT;       /* The pipe was deleted                          */
+                     break;
+
+                case OS_STAT_PEND_TO:
+                default:
+                     OS_EventTaskRemove(OSTCBCur, pevent);
+                     ppipe->OSPipeWrLvl = 0u;
+                     *perr = OS_ERR_TIMEOUT;
+                     break;
+            }
+            OSTCBCur->OSTCBStat          =  OS_STAT_RDY;      /* Set   task  status to ready           */
+            OSTCBCur->OSTCBStatPend      =  OS_STAT_PEND_OK;  /* Clear pend  status                    */
+            OSTCBCur->OSTCBEventPtr      = (OS_EVENT  *)0;    /* Clear event pointers                  */
+#if (OS_EVENT_MULTI_EN > 0u)
+            OSTCBCur->OSTCBEventMultiPtr = (OS_EVENT **)0;
+            OSTCBCur->OSTCBEventMultiRdy = (OS_EVENT  *)0;
+#endif
+            OS_EXIT_CRITICAL();
+            if (*perr != OS_ERR_NONE) {
+                break;
+            }
+        }
+    }
+    return (nbr_wr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          INITIALIZATION
+*                                  INITIALIZE THE PIPE MANAGEMENT
+*
+* Description: This function is called by OSInit() to initialize the free list of pipe control blocks.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+
+void  OS_PipeInit (void)
+{
+#if OS_MAX_PIPES == 1u
+    OSPipeFreeList            = &OSPipeTbl[0];           /* Only ONE pipe!                             */
+    OSPipeFreeList->OSPipePtr = (OS_PIPE *)0;
+#endif
+
+#if OS_MAX_PIPES >= 2u
+    INT16U    ix;
+    OS_PIPE  *ppipe;
+
+
+
+    OS_MemClr((INT8U *)&OSPipeTbl[0], sizeof(OSPipeTbl));  /* Clear the pipe table                     */
+    for (ix = 0u; ix < (OS_MAX_PIPES - 1u); ix++) {        /* Init. list of free PIPE control blocks   */
+        ppipe            = &OSPipeTbl[ix];
+        ppipe->OSPipePtr = &OSPipeTbl[ix + 1u];
+    }
+    ppipe            = &OSPipeTbl[ix];
+    ppipe->OSPipePtr = (OS_PIPE *)0;
+    OSPipeFreeList   = &OSPipeTbl[0];
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                         ADVANCE A PIPE INDEX
+*
+* Description: This function returns the index 'n' bytes after 'ix', wrapping around the storage area.
+*
+* Arguments  : ppipe         is a pointer to the pipe control block
+*
+*              ix            is the index to advance
+*
+*              n             is the number of bytes to advance by (less than the size of the pipe)
+*
+* Returns    : The new index.
+*********************************************************************************************************
+*/
+
+static  INT16U  OS_PipeAdvance (OS_PIPE  *ppipe,
+                                INT16U    ix,
+                                INT16U    n)
+{
+    if (n >= (ppipe->OSPipeSize - ix)) {              /* Wrap around                                   */
+        return (n - (ppipe->OSPipeSize - ix));
+    }
+    return (ix + n);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     NUMBER OF BYTES IN A PIPE
+*
+* Description: This function returns the number of bytes present in a pipe.
+*
+* Arguments  : ppipe         is a pointer to the pipe control block
+*
+* Returns    : The number of bytes present.
+*********************************************************************************************************
+*/
+
+static  INT16U  OS_PipeCnt (OS_PIPE  *ppipe)
+{
+    INT16U  in;
+    INT16U  out;
+
+
+    in  = ppipe->OSPipeIn;                            /* Read each index once                          */
+    out = ppipe->OSPipeOut;
+    if (in >= out) {
+        return (in - out);
+    }
+    return ((ppipe->OSPipeSize - out) + in);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             COPY BYTES
+*
+* Description: This function copies 'len' bytes.  When 'pdest' and 'psrc' are aligned alike, the bulk of
+*              the bytes is copied one 32-bit word at a time.
+*
+* Arguments  : pdest         is a pointer to the destination
+*
+*              psrc          is a pointer to the source
+*
+*              len           is the number of bytes to copy
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+static  void  OS_PipeCopy (INT8U   *pdest,
+                           INT8U   *psrc,
+                           INT16U   len)
+{
+    INT32U  *pdest32;
+    INT32U  *psrc32;
+
+
+    if ((len >= (2u * sizeof(INT32U))) &&
+        (OS_PIPE_ADDR_LSB(pdest) == OS_PIPE_ADDR_LSB(psrc))) {
+        while (OS_PIPE_ADDR_LSB(pdest) != 0u) {       /* Copy the bytes up to a word boundary          */
+            *pdest++ = *psrc++;
+            len--;
+        }
+        pdest32 = (INT32U *)(void *)pdest;
+        psrc32  = (INT32U *)(void *)psrc;
+        while (len >= sizeof(INT32U)) {               /* Copy whole words                              */
+            *pdest32++ = *psrc32++;
+            len       -= sizeof(INT32U);
+        }
+        pdest = (INT8U *)pdest32;
+        psrc  = (INT8U *)psrc32;
+    }
+    while (len > 0u) {                                /* Copy the remaining bytes                      */
+        *pdest++ = *psrc++;
+        len--;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                      TAKE BYTES OUT OF A PIPE
+*
+* Description: This function copies up to 'len' bytes out of a pipe.  The space is freed by the caller.
+*
+* Arguments  : ppipe         is a pointer to the pipe control block
+*
+*              pbuf          is a pointer to where the bytes are copied
+*
+*              len           is the maximum number of bytes to copy
+*
+* Returns    : The number of bytes copied.
+*********************************************************************************************************
+*/
+
+static  INT16U  OS_PipeGet (OS_PIPE  *ppipe,
+                            INT8U    *pbuf,
+                            INT16U    len)
+{
+    INT16U  n;
+    INT16U  n_end;
+    INT16U  out;
+
+
+    n = OS_PipeCnt(ppipe);
+    if (n > len) {
+        n = len;
+    }
+    out   = ppipe->OSPipeOut;
+    n_end = ppipe->OSPipeSize - out;                  /* Bytes up to the end of the storage area       */
+    if (n <= n_end) {
+        OS_PipeCopy(pbuf, &ppipe->OSPipeStart[out], n);
+    } else {
+        OS_PipeCopy(pbuf,          &ppipe->OSPipeStart[out], n_end);
+        OS_PipeCopy(&pbuf[n_end],  &ppipe->OSPipeStart[0],   n - n_end);
+    }
+    return (n);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        PUT BYTES INTO A PIPE
+*
+* Description: This function copies up to 'len' bytes into the free space of a pipe.  The bytes are
+*              published by the caller.
+*
+* Arguments  : ppipe         is a pointer to the pipe control block
+*
+*              pbuf          is a pointer to the bytes to copy
+*
+*              len           is the maximum number of bytes to copy
+*
+* Returns    : The number of bytes copied.
+*********************************************************************************************************
+*/
+
+static  INT16U  OS_PipePut (OS_PIPE  *ppipe,
+                            INT8U    *pbuf,
+                            INT16U    len)
+{
+    INT16U  n;
+    INT16U  n_end;
+    INT16U  in;
+
+
+    n = ppipe->OSPipeSize - 1u - OS_PipeCnt(ppipe);   /* Free space                                    */
+    if (n > len) {
+        n = len;
+    }
+    in    = ppipe->OSPipeIn;
+    n_end = ppipe->OSPipeSize - in;                   /* Bytes up to the end of the storage area       */
+    if (n <= n_end) {
+        OS_PipeCopy(&ppipe->OSPipeStart[in], pbuf, n);
+    } else {
+        OS_PipeCopy(&ppipe->OSPipeStart[in], pbuf,          n_end);
+        OS_PipeCopy(&ppipe->OSPipeStart[0],  &pbuf[n_end],  n - n_end);
+    }
+    return (n);
+}
+
+
+/*
+*********************************************************************************************************
+*                                 READY THE TASK WAITING FOR A PIPE
+*
+* Description: This function readies the reader (or the writer) waiting for a pipe if its trigger level
+*              is reached.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the pipe.
+*
+*              ppipe         is a pointer to the pipe control block
+*
+* Returns    : OS_TRUE       if a task was readied
+*              OS_FALSE      otherwise
+*
+* Note(s)    : This function is called with interrupts disabled.
+*********************************************************************************************************
+*/
+
+static  BOOLEAN  OS_PipeRdy (OS_EVENT  *pevent,
+                             OS_PIPE   *ppipe)
+{
+    INT16U  cnt;
+
+
+    if ((ppipe->OSPipeRdLvl == 0u) &&                 /* See if a task is waiting                      */
+        (ppipe->OSPipeWrLvl == 0u)) {
+        return (OS_FALSE);
+    }
+    cnt = OS_PipeCnt(ppipe);
+    if ((ppipe->OSPipeRdLvl != 0u) && (cnt < ppipe->OSPipeRdLvl)) {
+        return (OS_FALSE);                            /* Not enough bytes for the reader yet           */
+    }
+    if ((ppipe->OSPipeWrLvl != 0u) && ((ppipe->OSPipeSize - 1u - cnt) < ppipe->OSPipeWrLvl)) {
+        return (OS_FALSE);                            /* Not enough room for the writer yet            */
+    }
+    ppipe->OSPipeRdLvl = 0u;
+    ppipe->OSPipeWrLvl = 0u;
+    if (pevent->OSEventGrp == 0u) {                   /* The task may have been deleted                */
+        return (OS_FALSE);
+    }
+    (void)OS_EventTaskRdy(pevent, (void *)0, OS_STAT_STREAM, OS_STAT_PEND_OK);
+    return (OS_TRUE);
+}
+
+
+/*
+*********************************************************************************************************
+*                                  MAKE THE CURRENT TASK WAIT FOR A PIPE
+*
+* Description: This function suspends the current task until the pipe readies it or the timeout expires.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the pipe.
+*
+*              timeout       is the timeout period (in clock ticks), 0 to wait forever.
+*
+* Returns    : none
+*
+* Note(s)    : This function is called with interrupts disabled.
+*********************************************************************************************************
+*/
+
+static  void  OS_PipeWait (OS_EVENT  *pevent,
+                           INT32U     timeout)
+{
+    OSTCBCur->OSTCBStat     |= OS_STAT_STREAM;
+    OSTCBCur->OSTCBStatPend  = OS_STAT_PEND_OK;
+    OSTCBCur->OSTCBDly       = timeout;               /* Store pend timeout in TCB                     */
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListInsert(OSTCBCur);                      /* Add task to the list of delayed tasks         */
+#endif
+    OS_EventTaskWait(pevent);                         /* Suspend task until ready or timeout           */
+}
+#endif                                                /* OS_PIPE_EN                                    */
+#endif                                                /* OS_PIPE_C                                     */
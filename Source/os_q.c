@@ -35,6 +35,24 @@
 #endif
 
 #if (OS_Q_EN > 0u) && (OS_MAX_QS > 0u)
+/*
+*********************************************************************************************************
+*                                          LOCAL PROTOTYPES
+*********************************************************************************************************
+*/
+
+#if OS_Q_MULTI_EN > 0u
+static  INT16U  OS_QGetMulti (OS_Q *pq, void **pmsgs, INT16U max_n);
+#endif
+
+#if OS_Q_EX_EN > 0u
+static  void  OS_QGetEx (OS_Q *pq, void *pelem);
+#if OS_Q_POST_EN > 0u
+static  void  OS_QPutEx (OS_Q *pq, void *pelem);
+#endif
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                      ACCEPT MESSAGE FROM QUEUE
@@ -114,6 +132,62 @@ void  *OSQAccept (OS_EVENT  *pevent,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                   ACCEPT AN ELEMENT FROM A BY-VALUE QUEUE
+*
+* Description: This function checks a queue created with OSQCreateEx() to see if an element is available.
+*              If so, the element is copied to the buffer pointed to by 'pelem'.  Unlike OSQPendEx(),
+*              OSQAcceptEx() does not suspend the calling task if the queue is empty.
+*
+* Arguments  : pevent        is a pointer to the event control block
+*
+*              pelem         is a pointer to a buffer of the element size of the queue that receives the
+*                            element.
+*
+* Returns    : OS_ERR_NONE         The call was successful and the element was copied to 'pelem'
+*              OS_ERR_Q_EMPTY      The queue did not contain any element
+*              OS_ERR_EVENT_TYPE   You didn't pass a pointer to a by-value queue
+*              OS_ERR_PEVENT_NULL  If 'pevent' is a NULL pointer
+*              OS_ERR_PDATA_NULL   If 'pelem'  is a NULL pointer
+*********************************************************************************************************
+*/
+
+#if (OS_Q_EX_EN > 0u) && (OS_Q_ACCEPT_EN > 0u)
+INT8U  OSQAcceptEx (OS_EVENT  *pevent,
+                    void      *pelem)
+{
+    OS_Q      *pq;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {               /* Validate 'pevent'                                  */
+        return (OS_ERR_PEVENT_NULL);
+    }
+    if (pelem == (void *)0) {                    /* Validate 'pelem'                                   */
+        return (OS_ERR_PDATA_NULL);
+    }
+#endif
+    if (pevent->OSEventType != OS_EVENT_TYPE_Q_EX) { /* Validate event block type                      */
+        return (OS_ERR_EVENT_TYPE);
+    }
+    OS_ENTER_CRITICAL();
+    pq = (OS_Q *)pevent->OSEventPtr;             /* Point at queue control block                       */
+    if (pq->OSQEntries == 0u) {                  /* See if any elements in the queue                   */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_Q_EMPTY);
+    }
+    OS_QGetEx(pq, pelem);                        /* Yes, copy oldest element out of the queue          */
+    OS_EXIT_CRITICAL();
+    return (OS_ERR_NONE);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                       CREATE A MESSAGE QUEUE
@@ -172,6 +246,9 @@ OS_EVENT  *OSQCreate (void    **start,
             pq->OSQOut             = start;
             pq->OSQSize            = size;
             pq->OSQEntries         = 0u;
+#if OS_Q_EX_EN > 0u
+            pq->OSQElemSize        = 0u;                  /*      Queue of pointers                    */
+#endif
             pevent->OSEventType    = OS_EVENT_TYPE_Q;
             pevent->OSEventCnt     = 0u;
             pevent->OSEventPtr     = pq;
@@ -192,6 +269,105 @@ OS_EVENT  *OSQCreate (void    **start,
 }
 
 
+/*
+*********************************************************************************************************
+*                                       CREATE A BY-VALUE QUEUE
+*
+* Description: This function creates a queue whose elements are copied by value into its storage area
+*              rather than passed as pointers.  Each element is 'elem_size' bytes long.  A task receives
+*              an element in its own buffer (see OSQPendEx()) so that no memory partition is needed to
+*              carry small messages.
+*
+* Arguments  : start         is a pointer to the base address of the storage area of the queue.  The
+*                            storage area MUST be at least 'elem_size' * 'size' bytes long, e.g.:
+*
+*                            SENSOR_REC  SensorQStorage[size]
+*
+*              elem_size     is the size of an element (in bytes)
+*
+*              size          is the number of elements in the storage area
+*
+* Returns    : != (OS_EVENT *)0  is a pointer to the event control clock (OS_EVENT) associated with the
+*                                created queue
+*              == (OS_EVENT *)0  if no event control blocks were available or an error was detected
+*
+* Note(s)    : 1) A by-value queue is an OS_EVENT_TYPE_Q_EX event.  It is accessed with OSQAcceptEx(),
+*                 OSQPendEx() and OSQPostEx().  OSQDel(), OSQFlush(), OSQPendAbort() and OSQQuery() apply
+*                 to both kinds of queues.
+*              2) An element is copied with interrupts disabled, once into the queue and once out of it
+*                 or, if a task is already waiting, only once directly into the buffer of that task.  The
+*                 elements should thus be small.
+*********************************************************************************************************
+*/
+
+#if OS_Q_EX_EN > 0u
+OS_EVENT  *OSQCreateEx (void    *start,
+                        INT16U   elem_size,
+                        INT16U   size)
+{
+    OS_EVENT  *pevent;
+    OS_Q      *pq;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_EVENT *)0);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if ((start == (void *)0) || (elem_size == 0u)) { /* Validate the storage area                      */
+        return ((OS_EVENT *)0);
+    }
+#endif
+    if (OSIntNesting > 0u) {                     /* See if called from ISR ...                         */
+        return ((OS_EVENT *)0);                  /* ... can't CREATE from an ISR                       */
+    }
+    OS_ENTER_CRITICAL();
+    pevent = OSEventFreeList;                    /* Get next free event control block                  */
+    if (OSEventFreeList != (OS_EVENT *)0) {      /* See if pool of free ECB pool was empty             */
+        OSEventFreeList = (OS_EVENT *)OSEventFreeList->OSEventPtr;
+    }
+    OS_EXIT_CRITICAL();
+    if (pevent != (OS_EVENT *)0) {               /* See if we have an event control block              */
+        OS_ENTER_CRITICAL();
+        pq = OSQFreeList;                        /* Get a free queue control block                     */
+        if (pq != (OS_Q *)0) {                   /* Were we able to get a queue control block ?        */
+            OSQFreeList            = OSQFreeList->OSQPtr; /* Yes, Adjust free list pointer to next free*/
+            OS_EXIT_CRITICAL();
+            pq->OSQStart           = (void **)start;      /*      Initialize the queue                 */
+            pq->OSQEnd             = (void **)(void *)((INT8U *)start + ((INT32U)elem_size * size));
+            pq->OSQIn              = (void **)start;
+            pq->OSQOut             = (void **)start;
+            pq->OSQSize            = size;
+            pq->OSQEntries         = 0u;
+            pq->OSQElemSize        = elem_size;
+            pevent->OSEventType    = OS_EVENT_TYPE_Q_EX;
+            pevent->OSEventCnt     = 0u;
+            pevent->OSEventPtr     = pq;
+#if OS_EVENT_NAME_EN > 0u
+            pevent->OSEventName    = (INT8U *)(void *)"?";
+#endif
+            OS_EventWaitListInit(pevent);                 /*      Initialize the wait list             */
+
+            OS_TRACE_Q_CREATE(pevent, pevent->OSEventName);
+        } else {
+            pevent->OSEventPtr = (void *)OSEventFreeList; /* No,  Return event control block on error  */
+            OSEventFreeList    = pevent;
+            OS_EXIT_CRITICAL();
+            pevent = (OS_EVENT *)0;
+        }
+    }
+    return (pevent);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                       DELETE A MESSAGE QUEUE
@@ -274,7 +450,8 @@ OS_EVENT  *OSQDel (OS_EVENT  *pevent,
 
     OS_TRACE_Q_DEL_ENTER(pevent, opt);
 
-    if (pevent->OSEventType != OS_EVENT_TYPE_Q) {          /* Validate event block type                */
+    if ((pevent->OSEventType != OS_EVENT_TYPE_Q) &&        /* Validate event block type                */
+        (pevent->OSEventType != OS_EVENT_TYPE_Q_EX)) {
         *perr = OS_ERR_EVENT_TYPE;
         OS_TRACE_Q_DEL_EXIT(*perr);
         return (pevent);
@@ -382,7 +559,8 @@ INT8U  OSQFlush (OS_EVENT *pevent)
     if (pevent == (OS_EVENT *)0) {                    /* Validate 'pevent'                             */
         return (OS_ERR_PEVENT_NULL);
     }
-    if (pevent->OSEventType != OS_EVENT_TYPE_Q) {     /* Validate event block type                     */
+    if ((pevent->OSEventType != OS_EVENT_TYPE_Q) &&   /* Validate event block type                     */
+        (pevent->OSEventType != OS_EVENT_TYPE_Q_EX)) {
         return (OS_ERR_EVENT_TYPE);
     }
 #endif
@@ -491,6 +669,9 @@ void  *OSQPend (OS_EVENT  *pevent,
     OSTCBCur->OSTCBStat     |= OS_STAT_Q;        /* Task will have to pend for a message to be posted  */
     OSTCBCur->OSTCBStatPend  = OS_STAT_PEND_OK;
     OSTCBCur->OSTCBDly       = timeout;          /* Load timeout into TCB                              */
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListInsert(OSTCBCur);                 /* Add task to the list of delayed tasks              */
+#endif
     OS_EventTaskWait(pevent);                    /* Suspend task until event or timeout occurs         */
     OS_EXIT_CRITICAL();
     OS_Sched();                                  /* Find next highest priority task ready to run       */
@@ -530,124 +711,409 @@ void  *OSQPend (OS_EVENT  *pevent,
 
 /*
 *********************************************************************************************************
-*                                  ABORT WAITING ON A MESSAGE QUEUE
+*                                PEND ON A BY-VALUE QUEUE FOR AN ELEMENT
 *
-* Description: This function aborts & readies any tasks currently waiting on a queue.  This function
-*              should be used to fault-abort the wait on the queue, rather than to normally signal
-*              the queue via OSQPost(), OSQPostFront() or OSQPostOpt().
+* Description: This function waits for an element to be posted to a queue created with OSQCreateEx().
+*              The element is copied to the buffer pointed to by 'pelem'.
 *
-* Arguments  : pevent        is a pointer to the event control block associated with the desired queue.
+* Arguments  : pevent        is a pointer to the event control block associated with the desired queue
 *
-*              opt           determines the type of ABORT performed:
-*                            OS_PEND_OPT_NONE         ABORT wait for a single task (HPT) waiting on the
-*                                                     queue
-*                            OS_PEND_OPT_BROADCAST    ABORT wait for ALL tasks that are  waiting on the
-*                                                     queue
+*              pelem         is a pointer to a buffer of the element size of the queue that receives the
+*                            element.
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will
+*                            wait for an element to arrive at the queue up to the amount of time
+*                            specified by this argument.  If you specify 0, however, your task will wait
+*                            forever at the specified queue or, until an element arrives.
 *
 *              perr          is a pointer to where an error message will be deposited.  Possible error
 *                            messages are:
 *
-*                            OS_ERR_NONE         No tasks were     waiting on the queue.
-*                            OS_ERR_PEND_ABORT   At least one task waiting on the queue was readied
-*                                                and informed of the aborted wait; check return value
-*                                                for the number of tasks whose wait on the queue
-*                                                was aborted.
-*                            OS_ERR_EVENT_TYPE   If you didn't pass a pointer to a queue.
-*                            OS_ERR_PEVENT_NULL  If 'pevent' is a NULL pointer.
+*                            OS_ERR_NONE         The call was successful and the element was copied to
+*                                                'pelem'.
+*                            OS_ERR_TIMEOUT      An element was not received within the specified 'timeout'.
+*                            OS_ERR_PEND_ABORT   The wait on the queue was aborted.
+*                            OS_ERR_EVENT_TYPE   You didn't pass a pointer to a by-value queue
+*                            OS_ERR_PEVENT_NULL  If 'pevent' is a NULL pointer
+*                            OS_ERR_PDATA_NULL   If 'pelem'  is a NULL pointer
+*                            OS_ERR_PEND_ISR     If you called this function from an ISR and the result
+*                                                would lead to a suspension.
+*                            OS_ERR_PEND_LOCKED  If you called this function with the scheduler is locked
 *
-* Returns    : == 0          if no tasks were waiting on the queue, or upon error.
-*              >  0          if one or more tasks waiting on the queue are now readied and informed.
+* Returns    : none
+*
+* Note(s)    : 1) While the task waits, OSTCBMsg holds 'pelem' so that OSQPostEx() can copy the element
+*                 directly to it (see OS_EventTaskRdy()).  The buffer is left untouched if no element is
+*                 received.
 *********************************************************************************************************
 */
 
-#if OS_Q_PEND_ABORT_EN > 0u
-INT8U  OSQPendAbort (OS_EVENT  *pevent,
-                     INT8U      opt,
-                     INT8U     *perr)
+#if OS_Q_EX_EN > 0u
+void  OSQPendEx (OS_EVENT  *pevent,
+                 void      *pelem,
+                 INT32U     timeout,
+                 INT8U     *perr)
 {
-    INT8U      nbr_tasks;
-#if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
+    OS_Q      *pq;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
     OS_CPU_SR  cpu_sr = 0u;
 #endif
 
 
-
 #ifdef OS_SAFETY_CRITICAL
     if (perr == (INT8U *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
-        return (0u);
+        return;
     }
 #endif
 
 #if OS_ARG_CHK_EN > 0u
-    if (pevent == (OS_EVENT *)0) {                         /* Validate 'pevent'                        */
+    if (pevent == (OS_EVENT *)0) {               /* Validate 'pevent'                                  */
         *perr = OS_ERR_PEVENT_NULL;
-        return (0u);
+        return;
+    }
+    if (pelem == (void *)0) {                    /* Validate 'pelem'                                   */
+        *perr = OS_ERR_PDATA_NULL;
+        return;
     }
 #endif
-    if (pevent->OSEventType != OS_EVENT_TYPE_Q) {          /* Validate event block type                */
+
+    OS_TRACE_Q_PEND_ENTER(pevent, timeout);
+
+    if (pevent->OSEventType != OS_EVENT_TYPE_Q_EX) { /* Validate event block type                      */
         *perr = OS_ERR_EVENT_TYPE;
-        return (0u);
+        OS_TRACE_Q_PEND_EXIT(*perr);
+        return;
+    }
+    if (OSIntNesting > 0u) {                     /* See if called from ISR ...                         */
+        *perr = OS_ERR_PEND_ISR;                 /* ... can't PEND from an ISR                         */
+        OS_TRACE_Q_PEND_EXIT(*perr);
+        return;
+    }
+    if (OSLockNesting > 0u) {                    /* See if called with scheduler locked ...            */
+        *perr = OS_ERR_PEND_LOCKED;              /* ... can't PEND when locked                         */
+        OS_TRACE_Q_PEND_EXIT(*perr);
+        return;
     }
     OS_ENTER_CRITICAL();
-    if (pevent->OSEventGrp != 0u) {                        /* See if any task waiting on queue?        */
-        nbr_tasks = 0u;
-        switch (opt) {
-            case OS_PEND_OPT_BROADCAST:                    /* Do we need to abort ALL waiting tasks?   */
-                 while (pevent->OSEventGrp != 0u) {        /* Yes, ready ALL tasks waiting on queue    */
-                     (void)OS_EventTaskRdy(pevent, (void *)0, OS_STAT_Q, OS_STAT_PEND_ABORT);
-                     nbr_tasks++;
-                 }
-                 break;
-
-            case OS_PEND_OPT_NONE:
-            default:                                       /* No,  ready HPT       waiting on queue    */
-                 (void)OS_EventTaskRdy(pevent, (void *)0, OS_STAT_Q, OS_STAT_PEND_ABORT);
-                 nbr_tasks++;
-                 break;
-        }
+    pq = (OS_Q *)pevent->OSEventPtr;             /* Point at queue control block                       */
+    if (pq->OSQEntries > 0u) {                   /* See if any elements in the queue                   */
+        OS_QGetEx(pq, pelem);                    /* Yes, copy oldest element out of the queue          */
         OS_EXIT_CRITICAL();
-        OS_Sched();                                        /* Find HPT ready to run                    */
-        *perr = OS_ERR_PEND_ABORT;
-        return (nbr_tasks);
+        *perr = OS_ERR_NONE;
+        OS_TRACE_Q_PEND_EXIT(*perr);
+        return;
     }
+    OSTCBCur->OSTCBMsg       = pelem;            /* Element is copied here by OSQPostEx() (Note #1)    */
+    OSTCBCur->OSTCBStat     |= OS_STAT_Q;        /* Task will have to pend for an element to be posted */
+    OSTCBCur->OSTCBStatPend  = OS_STAT_PEND_OK;
+    OSTCBCur->OSTCBDly       = timeout;          /* Load timeout into TCB                              */
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListInsert(OSTCBCur);                 /* Add task to the list of delayed tasks              */
+#endif
+    OS_EventTaskWait(pevent);                    /* Suspend task until event or timeout occurs         */
     OS_EXIT_CRITICAL();
-    *perr = OS_ERR_NONE;
-    return (0u);                                           /* No tasks waiting on queue                */
+    OS_Sched();                                  /* Find next highest priority task ready to run       */
+    OS_ENTER_CRITICAL();
+    switch (OSTCBCur->OSTCBStatPend) {                /* See if we timed-out or aborted                */
+        case OS_STAT_PEND_OK:                         /* Element already copied to 'pelem'             */
+            *perr =  OS_ERR_NONE;
+             break;
+
+        case OS_STAT_PEND_ABORT:
+            *perr =  OS_ERR_PEND_ABORT;               /* Indicate that we aborted                      */
+             break;
+
+        case OS_STAT_PEND_TO:
+        default:
+             OS_EventTaskRemove(OSTCBCur, pevent);
+            *perr =  OS_ERR_TIMEOUT;                  /* Indicate that we didn't get event within TO   */
+             break;
+    }
+    OSTCBCur->OSTCBStat          =  OS_STAT_RDY;      /* Set   task  status to ready                   */
+    OSTCBCur->OSTCBStatPend      =  OS_STAT_PEND_OK;  /* Clear pend  status                            */
+    OSTCBCur->OSTCBEventPtr      = (OS_EVENT  *)0;    /* Clear event pointers                          */
+#if (OS_EVENT_MULTI_EN > 0u)
+    OSTCBCur->OSTCBEventMultiPtr = (OS_EVENT **)0;
+    OSTCBCur->OSTCBEventMultiRdy = (OS_EVENT  *)0;
+#endif
+    OSTCBCur->OSTCBMsg           = (void      *)0;    /* Clear pointer to the receive buffer           */
+    OS_EXIT_CRITICAL();
+    OS_TRACE_Q_PEND_EXIT(*perr);
 }
 #endif
 
 
 /*
 *********************************************************************************************************
-*                                       POST MESSAGE TO A QUEUE
+*                                 PEND ON A QUEUE FOR SEVERAL MESSAGES
 *
-* Description: This function sends a message to a queue
+* Description: This function waits for at least one message to be sent to a queue and returns up to
+*              'max_n' messages at once.  The messages are taken out of the queue in a single critical
+*              section.
 *
 * Arguments  : pevent        is a pointer to the event control block associated with the desired queue
 *
-*              pmsg          is a pointer to the message to send.
+*              pmsgs         is a pointer to an array of at least 'max_n' pointers that receives the
+*                            messages, oldest first.
 *
-* Returns    : OS_ERR_NONE           The call was successful and the message was sent
-*              OS_ERR_Q_FULL         If the queue cannot accept any more messages because it is full.
-*              OS_ERR_EVENT_TYPE     If you didn't pass a pointer to a queue.
-*              OS_ERR_PEVENT_NULL    If 'pevent' is a NULL pointer
+*              max_n         is the maximum number of messages to receive.
 *
-* Note(s)    : As of V2.60, this function allows you to send NULL pointer messages.
-*********************************************************************************************************
-*/
-
-#if OS_Q_POST_EN > 0u
-INT8U  OSQPost (OS_EVENT  *pevent,
-                void      *pmsg)
-{
-    OS_Q      *pq;
-#if OS_CRITICAL_METHOD == 3u                           /* Allocate storage for CPU status register     */
-    OS_CPU_SR  cpu_sr = 0u;
-#endif
-
-
-#if OS_ARG_CHK_EN > 0u
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will
+*                            wait for a message to arrive at the queue up to the amount of time
+*                            specified by this argument.  If you specify 0, however, your task will wait
+*                            forever at the specified queue or, until a message arrives.
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE         The call was successful and your task received at least
+*                                                one message.
+*                            OS_ERR_TIMEOUT      A message was not received within the specified 'timeout'.
+*                            OS_ERR_PEND_ABORT   The wait on the queue was aborted.
+*                            OS_ERR_EVENT_TYPE   You didn't pass a pointer to a queue
+*                            OS_ERR_PEVENT_NULL  If 'pevent' is a NULL pointer
+*                            OS_ERR_PDATA_NULL   If 'pmsgs' is a NULL pointer or 'max_n' is 0
+*                            OS_ERR_PEND_ISR     If you called this function from an ISR and the result
+*                                                would lead to a suspension.
+*                            OS_ERR_PEND_LOCKED  If you called this function with the scheduler is locked
+*
+* Returns    : The number of messages received (0 upon error).
+*
+* Note(s)    : 1) If the queue is empty, the task waits as in OSQPend().  Once it receives a message, the
+*                 messages that were queued in the meantime are taken as well, up to 'max_n'.
+*              2) The time interrupts are disabled grows with the number of messages received.
+*********************************************************************************************************
+*/
+
+#if OS_Q_MULTI_EN > 0u
+INT16U  OSQPendMulti (OS_EVENT  *pevent,
+                      void     **pmsgs,
+                      INT16U     max_n,
+                      INT32U     timeout,
+                      INT8U     *perr)
+{
+    OS_Q      *pq;
+    INT16U     n;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {               /* Validate 'pevent'                                  */
+        *perr = OS_ERR_PEVENT_NULL;
+        return (0u);
+    }
+    if ((pmsgs == (void **)0) || (max_n == 0u)) {/* Validate 'pmsgs' and 'max_n'                       */
+        *perr = OS_ERR_PDATA_NULL;
+        return (0u);
+    }
+#endif
+
+    OS_TRACE_Q_PEND_ENTER(pevent, timeout);
+
+    if (pevent->OSEventType != OS_EVENT_TYPE_Q) {/* Validate event block type                          */
+        *perr = OS_ERR_EVENT_TYPE;
+        OS_TRACE_Q_PEND_EXIT(*perr);
+        return (0u);
+    }
+    if (OSIntNesting > 0u) {                     /* See if called from ISR ...                         */
+        *perr = OS_ERR_PEND_ISR;                 /* ... can't PEND from an ISR                         */
+        OS_TRACE_Q_PEND_EXIT(*perr);
+        return (0u);
+    }
+    if (OSLockNesting > 0u) {                    /* See if called with scheduler locked ...            */
+        *perr = OS_ERR_PEND_LOCKED;              /* ... can't PEND when locked                         */
+        OS_TRACE_Q_PEND_EXIT(*perr);
+        return (0u);
+    }
+    OS_ENTER_CRITICAL();
+    pq = (OS_Q *)pevent->OSEventPtr;             /* Point at queue control block                       */
+    if (pq->OSQEntries > 0u) {                   /* See if any messages in the queue                   */
+        n = OS_QGetMulti(pq, pmsgs, max_n);      /* Yes, extract as many as possible                   */
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_NONE;
+        OS_TRACE_Q_PEND_EXIT(*perr);
+        return (n);                              /* Return number of messages received                 */
+    }
+    OSTCBCur->OSTCBStat     |= OS_STAT_Q;        /* Task will have to pend for a message to be posted  */
+    OSTCBCur->OSTCBStatPend  = OS_STAT_PEND_OK;
+    OSTCBCur->OSTCBDly       = timeout;          /* Load timeout into TCB                              */
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListInsert(OSTCBCur);                 /* Add task to the list of delayed tasks              */
+#endif
+    OS_EventTaskWait(pevent);                    /* Suspend task until event or timeout occurs         */
+    OS_EXIT_CRITICAL();
+    OS_Sched();                                  /* Find next highest priority task ready to run       */
+    OS_ENTER_CRITICAL();
+    switch (OSTCBCur->OSTCBStatPend) {                /* See if we timed-out or aborted                */
+        case OS_STAT_PEND_OK:                         /* Extract message from TCB (Put there by QPost) */
+             pmsgs[0] =  OSTCBCur->OSTCBMsg;          /* ... and the ones queued since (see Note #1)   */
+             n        =  1u + OS_QGetMulti(pq, &pmsgs[1], max_n - 1u);
+            *perr     =  OS_ERR_NONE;
+             break;
+
+        case OS_STAT_PEND_ABORT:
+             n     = 0u;
+            *perr  = OS_ERR_PEND_ABORT;               /* Indicate that we aborted                      */
+             break;
+
+        case OS_STAT_PEND_TO:
+        default:
+             OS_EventTaskRemove(OSTCBCur, pevent);
+             n     = 0u;
+            *perr  = OS_ERR_TIMEOUT;                  /* Indicate that we didn't get event within TO   */
+             break;
+    }
+    OSTCBCur->OSTCBStat          =  OS_STAT_RDY;      /* Set   task  status to ready                   */
+    OSTCBCur->OSTCBStatPend      =  OS_STAT_PEND_OK;  /* Clear pend  status                            */
+    OSTCBCur->OSTCBEventPtr      = (OS_EVENT  *)0;    /* Clear event pointers                          */
+#if (OS_EVENT_MULTI_EN > 0u)
+    OSTCBCur->OSTCBEventMultiPtr = (OS_EVENT **)0;
+    OSTCBCur->OSTCBEventMultiRdy = (OS_EVENT  *)0;
+#endif
+    OSTCBCur->OSTCBMsg           = (void      *)0;    /* Clear  received message                       */
+    OS_EXIT_CRITICAL();
+    OS_TRACE_Q_PEND_EXIT(*perr);
+
+    return (n);                                       /* Return number of messages received            */
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  ABORT WAITING ON A MESSAGE QUEUE
+*
+* Description: This function aborts & readies any tasks currently waiting on a queue.  This function
+*              should be used to fault-abort the wait on the queue, rather than to normally signal
+*              the queue via OSQPost(), OSQPostFront() or OSQPostOpt().
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired queue.
+*
+*              opt           determines the type of ABORT performed:
+*                            OS_PEND_OPT_NONE         ABORT wait for a single task (HPT) waiting on the
+*                                                     queue
+*                            OS_PEND_OPT_BROADCAST    ABORT wait for ALL tasks that are  waiting on the
+*                                                     queue
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE         No tasks were     waiting on the queue.
+*                            OS_ERR_PEND_ABORT   At least one task waiting on the queue was readied
+*                                                and informed of the aborted wait; check return value
+*                                                for the number of tasks whose wait on the queue
+*                                                was aborted.
+*                            OS_ERR_EVENT_TYPE   If you didn't pass a pointer to a queue.
+*                            OS_ERR_PEVENT_NULL  If 'pevent' is a NULL pointer.
+*
+* Returns    : == 0          if no tasks were waiting on the queue, or upon error.
+*              >  0          if one or more tasks waiting on the queue are now readied and informed.
+*********************************************************************************************************
+*/
+
+#if OS_Q_PEND_ABORT_EN > 0u
+INT8U  OSQPendAbort (OS_EVENT  *pevent,
+                     INT8U      opt,
+                     INT8U     *perr)
+{
+    INT8U      nbr_tasks;
+#if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {                         /* Validate 'pevent'                        */
+        *perr = OS_ERR_PEVENT_NULL;
+        return (0u);
+    }
+#endif
+    if ((pevent->OSEventType != OS_EVENT_TYPE_Q) &&        /* Validate event block type                */
+        (pevent->OSEventType != OS_EVENT_TYPE_Q_EX)) {
+        *perr = OS_ERR_EVENT_TYPE;
+        return (0u);
+    }
+    OS_ENTER_CRITICAL();
+    if (pevent->OSEventGrp != 0u) {                        /* See if any task waiting on queue?        */
+        nbr_tasks = 0u;
+        switch (opt) {
+            case OS_PEND_OPT_BROADCAST:                    /* Do we need to abort ALL waiting tasks?   */
+                 while (pevent->OSEventGrp != 0u) {        /* Yes, ready ALL tasks waiting on queue    */
+                     (void)OS_EventTaskRdy(pevent, (void *)0, OS_STAT_Q, OS_STAT_PEND_ABORT);
+                     nbr_tasks++;
+                 }
+                 break;
+
+            case OS_PEND_OPT_NONE:
+            default:                                       /* No,  ready HPT       waiting on queue    */
+                 (void)OS_EventTaskRdy(pevent, (void *)0, OS_STAT_Q, OS_STAT_PEND_ABORT);
+                 nbr_tasks++;
+                 break;
+        }
+        OS_EXIT_CRITICAL();
+        OS_Sched();                                        /* Find HPT ready to run                    */
+        *perr = OS_ERR_PEND_ABORT;
+        return (nbr_tasks);
+    }
+    OS_EXIT_CRITICAL();
+    *perr = OS_ERR_NONE;
+    return (0u);                                           /* No tasks waiting on queue                */
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       POST MESSAGE TO A QUEUE
+*
+* Description: This function sends a message to a queue
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired queue
+*
+*              pmsg          is a pointer to the message to send.
+*
+* Returns    : OS_ERR_NONE           The call was successful and the message was sent
+*              OS_ERR_Q_FULL         If the queue cannot accept any more messages because it is full.
+*              OS_ERR_EVENT_TYPE     If you didn't pass a pointer to a queue.
+*              OS_ERR_PEVENT_NULL    If 'pevent' is a NULL pointer
+*              OS_ERR_INT_Q_FULL     If called from an ISR while the ring of deferred posts is full
+*
+* Note(s)    : As of V2.60, this function allows you to send NULL pointer messages.
+*********************************************************************************************************
+*/
+
+#if OS_Q_POST_EN > 0u
+INT8U  OSQPost (OS_EVENT  *pevent,
+                void      *pmsg)
+{
+    OS_Q      *pq;
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    INT8U      err;
+#endif
+#if OS_CRITICAL_METHOD == 3u                           /* Allocate storage for CPU status register     */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+#if OS_ARG_CHK_EN > 0u
     if (pevent == (OS_EVENT *)0) {                     /* Validate 'pevent'                            */
         return (OS_ERR_PEVENT_NULL);
     }
@@ -659,6 +1125,13 @@ INT8U  OSQPost (OS_EVENT  *pevent,
         OS_TRACE_Q_POST_EXIT(OS_ERR_EVENT_TYPE);
         return (OS_ERR_EVENT_TYPE);
     }
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNesting > 0u) {                           /* Defer the post when called from an ISR       */
+        err = OSIntQ_Post(OS_INT_Q_Q_POST, (void *)pevent, pmsg, 0u, OS_POST_OPT_NONE);
+        OS_TRACE_Q_POST_EXIT(err);
+        return (err);
+    }
+#endif
     OS_ENTER_CRITICAL();
     if (pevent->OSEventGrp != 0u) {                    /* See if any task pending on queue             */
                                                        /* Ready highest priority task waiting on event */
@@ -687,6 +1160,80 @@ INT8U  OSQPost (OS_EVENT  *pevent,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                   POST AN ELEMENT TO A BY-VALUE QUEUE
+*
+* Description: This function copies an element to a queue created with OSQCreateEx().  If a task is
+*              waiting on the queue, the element is copied directly to the buffer of the highest priority
+*              one instead.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired queue
+*
+*              pelem         is a pointer to the element to send.  The element can be reused as soon as
+*                            this function returns.
+*
+* Returns    : OS_ERR_NONE           The call was successful and the element was sent
+*              OS_ERR_Q_FULL         If the queue cannot accept any more elements because it is full.
+*              OS_ERR_EVENT_TYPE     If you didn't pass a pointer to a by-value queue.
+*              OS_ERR_PEVENT_NULL    If 'pevent' is a NULL pointer
+*              OS_ERR_PDATA_NULL     If 'pelem'  is a NULL pointer
+*
+* Note(s)    : 1) This function can be called from an ISR.  Since the element cannot be kept in the ring of
+*                 deferred ISR posts, the post is never deferred, even when OS_ISR_POST_DEFERRED_EN is set
+*                 to 1.
+*********************************************************************************************************
+*/
+
+#if (OS_Q_EX_EN > 0u) && (OS_Q_POST_EN > 0u)
+INT8U  OSQPostEx (OS_EVENT  *pevent,
+                  void      *pelem)
+{
+    OS_Q      *pq;
+#if OS_CRITICAL_METHOD == 3u                           /* Allocate storage for CPU status register     */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {                     /* Validate 'pevent'                            */
+        return (OS_ERR_PEVENT_NULL);
+    }
+    if (pelem == (void *)0) {                          /* Validate 'pelem'                             */
+        return (OS_ERR_PDATA_NULL);
+    }
+#endif
+
+    OS_TRACE_Q_POST_ENTER(pevent);
+
+    if (pevent->OSEventType != OS_EVENT_TYPE_Q_EX) {   /* Validate event block type                    */
+        OS_TRACE_Q_POST_EXIT(OS_ERR_EVENT_TYPE);
+        return (OS_ERR_EVENT_TYPE);
+    }
+    OS_ENTER_CRITICAL();
+    if (pevent->OSEventGrp != 0u) {                    /* See if any task pending on queue             */
+                                                       /* Copy element to HPT waiting on event         */
+        (void)OS_EventTaskRdy(pevent, pelem, OS_STAT_Q, OS_STAT_PEND_OK);
+        OS_EXIT_CRITICAL();
+        OS_Sched();                                    /* Find highest priority task ready to run      */
+        OS_TRACE_Q_POST_EXIT(OS_ERR_NONE);
+        return (OS_ERR_NONE);
+    }
+    pq = (OS_Q *)pevent->OSEventPtr;                   /* Point to queue control block                 */
+    if (pq->OSQEntries >= pq->OSQSize) {               /* Make sure queue is not full                  */
+        OS_EXIT_CRITICAL();
+        OS_TRACE_Q_POST_EXIT(OS_ERR_Q_FULL);
+        return (OS_ERR_Q_FULL);
+    }
+    OS_QPutEx(pq, pelem);                              /* Copy element into queue                      */
+    OS_EXIT_CRITICAL();
+    OS_TRACE_Q_POST_EXIT(OS_ERR_NONE);
+
+    return (OS_ERR_NONE);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                POST MESSAGE TO THE FRONT OF A QUEUE
@@ -703,6 +1250,7 @@ INT8U  OSQPost (OS_EVENT  *pevent,
 *              OS_ERR_Q_FULL         If the queue cannot accept any more messages because it is full.
 *              OS_ERR_EVENT_TYPE     If you didn't pass a pointer to a queue.
 *              OS_ERR_PEVENT_NULL    If 'pevent' is a NULL pointer
+*              OS_ERR_INT_Q_FULL     If called from an ISR while the ring of deferred posts is full
 *
 * Note(s)    : As of V2.60, this function allows you to send NULL pointer messages.
 *********************************************************************************************************
@@ -713,6 +1261,9 @@ INT8U  OSQPostFront (OS_EVENT  *pevent,
                      void      *pmsg)
 {
     OS_Q      *pq;
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    INT8U      err;
+#endif
 #if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
     OS_CPU_SR  cpu_sr = 0u;
 #endif
@@ -731,6 +1282,13 @@ INT8U  OSQPostFront (OS_EVENT  *pevent,
         OS_TRACE_Q_POST_FRONT_EXIT(OS_ERR_EVENT_TYPE);
         return (OS_ERR_EVENT_TYPE);
     }
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNesting > 0u) {                          /* Defer the post when called from an ISR        */
+        err = OSIntQ_Post(OS_INT_Q_Q_POST_FRONT, (void *)pevent, pmsg, 0u, OS_POST_OPT_FRONT);
+        OS_TRACE_Q_POST_FRONT_EXIT(err);
+        return (err);
+    }
+#endif
     OS_ENTER_CRITICAL();
     if (pevent->OSEventGrp != 0u) {                   /* See if any task pending on queue              */
                                                       /* Ready highest priority task waiting on event  */
@@ -782,6 +1340,7 @@ INT8U  OSQPostFront (OS_EVENT  *pevent,
 *              OS_ERR_Q_FULL         If the queue cannot accept any more messages because it is full.
 *              OS_ERR_EVENT_TYPE     If you didn't pass a pointer to a queue.
 *              OS_ERR_PEVENT_NULL    If 'pevent' is a NULL pointer
+*              OS_ERR_INT_Q_FULL     If called from an ISR while the ring of deferred posts is full
 *
 * Warning    : Interrupts can be disabled for a long time if you do a 'broadcast'.  In fact, the
 *              interrupt disable time is proportional to the number of tasks waiting on the queue.
@@ -794,6 +1353,9 @@ INT8U  OSQPostOpt (OS_EVENT  *pevent,
                    INT8U      opt)
 {
     OS_Q      *pq;
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    INT8U      err;
+#endif
 #if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
     OS_CPU_SR  cpu_sr = 0u;
 #endif
@@ -812,6 +1374,13 @@ INT8U  OSQPostOpt (OS_EVENT  *pevent,
         OS_TRACE_Q_POST_OPT_EXIT(OS_ERR_EVENT_TYPE);
         return (OS_ERR_EVENT_TYPE);
     }
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNesting > 0u) {                          /* Defer the post when called from an ISR        */
+        err = OSIntQ_Post(OS_INT_Q_Q_POST_OPT, (void *)pevent, pmsg, 0u, opt);
+        OS_TRACE_Q_POST_OPT_EXIT(err);
+        return (err);
+    }
+#endif
     OS_ENTER_CRITICAL();
     if (pevent->OSEventGrp != 0x00u) {                /* See if any task pending on queue              */
         if ((opt & OS_POST_OPT_BROADCAST) != 0x00u) { /* Do we need to post msg to ALL waiting tasks ? */
@@ -854,6 +1423,153 @@ INT8U  OSQPostOpt (OS_EVENT  *pevent,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                  POST SEVERAL MESSAGES TO A QUEUE
+*
+* Description: This function sends up to 'n' messages to a queue in a single critical section and with
+*              at most one call to the scheduler.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired queue
+*
+*              pmsgs         is a pointer to an array of 'n' messages to send.
+*
+*              n             is the number of messages to send.
+*
+*              opt           determines the type of POST performed:
+*                            OS_POST_OPT_NONE         POST the messages at the end of the queue (FIFO)
+*                            OS_POST_OPT_FRONT        POST each message in front of the queue (LIFO); the
+*                                                     last message of the array is then received first
+*                            OS_POST_OPT_NO_SCHED     Do not call the scheduler
+*
+*                            Below is a list of ALL the possible combination of these flags:
+*
+*                                 1) OS_POST_OPT_NONE
+*                                 2) OS_POST_OPT_FRONT
+*                                 3) OS_POST_OPT_NO_SCHED
+*                                 4) OS_POST_OPT_FRONT + OS_POST_OPT_NO_SCHED
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE           All the messages were sent
+*                            OS_ERR_Q_FULL         The queue filled up before all the messages were sent
+*                            OS_ERR_EVENT_TYPE     If you didn't pass a pointer to a queue.
+*                            OS_ERR_PEVENT_NULL    If 'pevent' is a NULL pointer
+*                            OS_ERR_PDATA_NULL     If 'pmsgs' is a NULL pointer
+*                            OS_ERR_INT_Q_FULL     If called from an ISR while the ring of deferred posts
+*                                                  is full
+*
+* Returns    : The number of messages sent, i.e. pmsgs[0] to pmsgs[n - 1] for the returned value 'n'.
+*
+* Note(s)    : 1) The first messages go to the tasks waiting on the queue, one message per task, highest
+*                 priority first.  The others are inserted in the queue.
+*              2) The time interrupts are disabled grows with 'n'.
+*              3) OS_POST_OPT_BROADCAST is not supported and is ignored.
+*              4) When called from an ISR with OS_ISR_POST_DEFERRED_EN set to 1, each message is deferred
+*                 separately and later posted by calling this function with 'n' set to 1.
+*********************************************************************************************************
+*/
+
+#if OS_Q_MULTI_EN > 0u
+INT16U  OSQPostMulti (OS_EVENT  *pevent,
+                      void     **pmsgs,
+                      INT16U     n,
+                      INT8U      opt,
+                      INT8U     *perr)
+{
+    OS_Q      *pq;
+    INT16U     i;
+    BOOLEAN    sched;
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    INT8U      err;
+#endif
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {                    /* Validate 'pevent'                             */
+        *perr = OS_ERR_PEVENT_NULL;
+        return (0u);
+    }
+    if (pmsgs == (void **)0) {                        /* Validate 'pmsgs'                              */
+        *perr = OS_ERR_PDATA_NULL;
+        return (0u);
+    }
+#endif
+
+    OS_TRACE_Q_POST_OPT_ENTER(pevent, opt);
+
+    if (pevent->OSEventType != OS_EVENT_TYPE_Q) {     /* Validate event block type                     */
+        *perr = OS_ERR_EVENT_TYPE;
+        OS_TRACE_Q_POST_OPT_EXIT(*perr);
+        return (0u);
+    }
+    opt &= (INT8U)~OS_POST_OPT_BROADCAST;             /* See Note #3                                   */
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNesting > 0u) {                          /* Defer the posts when called from an ISR       */
+        err = OS_ERR_NONE;
+        for (i = 0u; i < n; i++) {
+            err = OSIntQ_Post(OS_INT_Q_Q_POST_MULTI, (void *)pevent, pmsgs[i], 0u, opt);
+            if (err != OS_ERR_NONE) {
+                break;
+            }
+        }
+        *perr = err;
+        OS_TRACE_Q_POST_OPT_EXIT(*perr);
+        return (i);
+    }
+#endif
+    i     = 0u;
+    sched = OS_FALSE;
+    OS_ENTER_CRITICAL();
+    while ((i < n) && (pevent->OSEventGrp != 0u)) {   /* Send a message to each task waiting (Note #1) */
+        (void)OS_EventTaskRdy(pevent, pmsgs[i], OS_STAT_Q, OS_STAT_PEND_OK);
+        sched = OS_TRUE;
+        i++;
+    }
+    pq = (OS_Q *)pevent->OSEventPtr;                  /* Point to queue control block                  */
+    while ((i < n) && (pq->OSQEntries < pq->OSQSize)) {   /* Insert the others while queue not full    */
+        if ((opt & OS_POST_OPT_FRONT) != 0x00u) {     /* Do we post to the FRONT of the queue?         */
+            if (pq->OSQOut == pq->OSQStart) {         /* Yes, Post as LIFO, Wrap OUT pointer if we ... */
+                pq->OSQOut = pq->OSQEnd;              /*      ... are at the 1st queue entry           */
+            }
+            pq->OSQOut--;
+            *pq->OSQOut = pmsgs[i];                   /*      Insert message into queue                */
+        } else {                                      /* No,  Post as FIFO                             */
+            *pq->OSQIn++ = pmsgs[i];                  /*      Insert message into queue                */
+            if (pq->OSQIn == pq->OSQEnd) {            /*      Wrap IN ptr if we are at end of queue    */
+                pq->OSQIn = pq->OSQStart;
+            }
+        }
+        pq->OSQEntries++;                             /* Update the nbr of entries in the queue        */
+        i++;
+    }
+    OS_EXIT_CRITICAL();
+    if ((sched == OS_TRUE) && ((opt & OS_POST_OPT_NO_SCHED) == 0u)) {
+        OS_Sched();                                   /* Find highest priority task ready to run       */
+    }
+    if (i < n) {
+        *perr = OS_ERR_Q_FULL;
+    } else {
+        *perr = OS_ERR_NONE;
+    }
+    OS_TRACE_Q_POST_OPT_EXIT(*perr);
+    return (i);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                        QUERY A MESSAGE QUEUE
@@ -894,7 +1610,8 @@ INT8U  OSQQuery (OS_EVENT  *pevent,
         return (OS_ERR_PDATA_NULL);
     }
 #endif
-    if (pevent->OSEventType != OS_EVENT_TYPE_Q) {      /* Validate event block type                    */
+    if ((pevent->OSEventType != OS_EVENT_TYPE_Q) &&    /* Validate event block type                    */
+        (pevent->OSEventType != OS_EVENT_TYPE_Q_EX)) {
         return (OS_ERR_EVENT_TYPE);
     }
     OS_ENTER_CRITICAL();
@@ -906,18 +1623,128 @@ INT8U  OSQQuery (OS_EVENT  *pevent,
     }
     pq = (OS_Q *)pevent->OSEventPtr;
     if (pq->OSQEntries > 0u) {
+#if OS_Q_EX_EN > 0u
+        if (pq->OSQElemSize != 0u) {                   /* By-value queue: point at the oldest element  */
+            p_q_data->OSMsg = (void *)pq->OSQOut;
+        } else {
+            p_q_data->OSMsg = *pq->OSQOut;             /* Get next message to return if available      */
+        }
+#else
         p_q_data->OSMsg = *pq->OSQOut;                 /* Get next message to return if available      */
+#endif
     } else {
         p_q_data->OSMsg = (void *)0;
     }
     p_q_data->OSNMsgs = pq->OSQEntries;
     p_q_data->OSQSize = pq->OSQSize;
+#if OS_Q_EX_EN > 0u
+    p_q_data->OSElemSize = pq->OSQElemSize;
+#endif
     OS_EXIT_CRITICAL();
     return (OS_ERR_NONE);
 }
 #endif                                                 /* OS_Q_QUERY_EN                                */
 
 
+/*
+*********************************************************************************************************
+*                                 EXTRACT SEVERAL MESSAGES FROM A QUEUE
+*
+* Description: This function moves up to 'max_n' of the oldest messages of a queue to 'pmsgs'.
+*
+* Arguments  : pq            is a pointer to the queue control block
+*
+*              pmsgs         is a pointer to the array that receives the messages
+*
+*              max_n         is the maximum number of messages to extract
+*
+* Returns    : The number of messages extracted.
+*
+* Note(s)    : This function is called with interrupts disabled.
+*********************************************************************************************************
+*/
+
+#if OS_Q_MULTI_EN > 0u
+static  INT16U  OS_QGetMulti (OS_Q    *pq,
+                              void   **pmsgs,
+                              INT16U   max_n)
+{
+    INT16U  n;
+
+
+    n = 0u;
+    while ((n < max_n) && (pq->OSQEntries > 0u)) {
+        *pmsgs++ = *pq->OSQOut++;                      /* Extract oldest message from the queue        */
+        pq->OSQEntries--;
+        if (pq->OSQOut == pq->OSQEnd) {                /* Wrap OUT pointer if we are at end of queue   */
+            pq->OSQOut = pq->OSQStart;
+        }
+        n++;
+    }
+    return (n);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                              COPY AN ELEMENT OUT OF / INTO A BY-VALUE QUEUE
+*
+* Description: OS_QGetEx() copies the oldest element of a by-value queue to 'pelem' and removes it from
+*              the queue.  OS_QPutEx() copies the element pointed to by 'pelem' at the end of the queue.
+*
+* Arguments  : pq            is a pointer to the queue control block
+*
+*              pelem         is a pointer to the destination (OS_QGetEx()) or source (OS_QPutEx()) of the
+*                            element
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are called with interrupts disabled.  The caller checks that the queue
+*                 is not empty (OS_QGetEx()) or not full (OS_QPutEx()).
+*              2) OSQIn and OSQOut point to bytes of the storage area; they are only typed 'void **' because
+*                 OS_Q is shared with the queues of pointers.
+*********************************************************************************************************
+*/
+
+#if OS_Q_EX_EN > 0u
+static  void  OS_QGetEx (OS_Q  *pq,
+                         void  *pelem)
+{
+    INT8U  *pout;
+
+
+    pout = (INT8U *)(void *)pq->OSQOut;
+    OS_MemCopy((INT8U *)pelem, pout, pq->OSQElemSize);
+    pout += pq->OSQElemSize;
+    if (pout == (INT8U *)(void *)pq->OSQEnd) {         /* Wrap OUT pointer if we are at end of queue   */
+        pout  = (INT8U *)(void *)pq->OSQStart;
+    }
+    pq->OSQOut = (void **)(void *)pout;
+    pq->OSQEntries--;                                  /* Update the nbr of entries in the queue       */
+}
+#endif
+
+
+#if (OS_Q_EX_EN > 0u) && (OS_Q_POST_EN > 0u)
+static  void  OS_QPutEx (OS_Q  *pq,
+                         void  *pelem)
+{
+    INT8U  *pin;
+
+
+    pin  = (INT8U *)(void *)pq->OSQIn;
+    OS_MemCopy(pin, (INT8U *)pelem, pq->OSQElemSize);
+    pin += pq->OSQElemSize;
+    if (pin == (INT8U *)(void *)pq->OSQEnd) {          /* Wrap IN pointer if we are at end of queue    */
+        pin  = (INT8U *)(void *)pq->OSQStart;
+    }
+    pq->OSQIn = (void **)(void *)pin;
+    pq->OSQEntries++;                                  /* Update the nbr of entries in the queue       */
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                     QUEUE MODULE INITIALIZATION
@@ -0,0 +1,742 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-II
+*                                        The Real-Time Kernel
+*
+*                    Copyright 1992-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*
+*                                      ISR TO TASK RING BUFFERS
+*
+* Filename : os_ring.c
+* Version  : V2.93.01
+*********************************************************************************************************
+*/
+
+#ifndef  OS_RING_C
+#define  OS_RING_C
+
+#define  MICRIUM_SOURCE
+
+#ifndef  OS_MASTER_FILE
+#include <ucos_ii.h>
+#endif
+
+#if (OS_RING_EN > 0u) && (OS_MAX_RINGS > 0u)
+/*
+*********************************************************************************************************
+*                                                        NOTES
+*
+* 1) A ring buffer carries bytes from ONE producer (typically an ISR) to ONE consumer task.  The producer
+*    only writes 'OSRingIn' and the consumer only writes 'OSRingOut', so that neither OSRingPut() nor
+*    OSRingWrite() disable interrupts to store data.  This requires:
+*
+*    a) A single CPU, on which an ISR sees the memory accesses of a task in program order.
+*    b) 16-bit loads and stores that can't be interrupted half way.  On an 8-bit CPU, OSRingPut() and
+*       OSRingWrite() must be called from an ISR that can't be nested by another user of the ring.
+*
+* 2) The consumer waits in OSRingRead() until at least 'threshold' bytes are present.  While it waits,
+*    'OSRingThreshold' holds that number.  The producer only disables interrupts, to ready the consumer,
+*    when a write makes the ring reach the threshold.
+*
+* 3) One entry of the storage area is always left empty, to tell a full ring from an empty one.  A ring
+*    created with 'size' bytes thus holds at most 'size' - 1 bytes.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          LOCAL PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  INT16U  OS_RingCnt   (OS_RING *pring);
+static  INT16U  OS_RingGet   (OS_RING *pring, INT8U *pbuf, INT16U len);
+static  void    OS_RingWake  (OS_EVENT *pevent, OS_RING *pring, INT16U cnt_prev);
+
+
+/*
+*********************************************************************************************************
+*                                        CREATE A RING BUFFER
+*
+* Description: This function creates a ring buffer to pass bytes from an ISR (or a task) to a task.
+*
+* Arguments  : pbuf          is a pointer to the storage area of the ring buffer.
+*
+*              size          is the size of the storage area (in bytes).  The ring holds up to 'size' - 1
+*                            bytes (see Note #3 at the top of this file).
+*
+* Returns    : != (OS_EVENT *)0  is a pointer to the event control block (OS_EVENT) associated with the
+*                                created ring buffer
+*              == (OS_EVENT *)0  if no event control blocks were available or an error was detected
+*********************************************************************************************************
+*/
+
+OS_EVENT  *OSRingCreate (INT8U   *pbuf,
+                         INT16U   size)
+{
+    OS_EVENT  *pevent;
+    OS_RING   *pring;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_EVENT *)0);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pbuf == (INT8U *)0) {                    /* Validate 'pbuf'                                    */
+        return ((OS_EVENT *)0);
+    }
+    if (size < 2u) {                             /* Must hold at least one byte                        */
+        return ((OS_EVENT *)0);
+    }
+#endif
+
+    if (OSIntNesting > 0u) {                     /* See if called from ISR ...                         */
+        return ((OS_EVENT *)0);                  /* ... can't CREATE from an ISR                       */
+    }
+    OS_ENTER_CRITICAL();
+    pevent = OSEventFreeList;                    /* Get next free event control block                  */
+    if (OSEventFreeList != (OS_EVENT *)0) {      /* See if pool of free ECB pool was empty             */
+        OSEventFreeList = (OS_EVENT *)OSEventFreeList->OSEventPtr;
+    }
+    OS_EXIT_CRITICAL();
+    if (pevent != (OS_EVENT *)0) {               /* See if we have an event control block              */
+        OS_ENTER_CRITICAL();
+        pring = OSRingFreeList;                  /* Get a free ring control block                      */
+        if (pring != (OS_RING *)0) {
+            OSRingFreeList         = OSRingFreeList->OSRingPtr;
+            OS_EXIT_CRITICAL();
+            pring->OSRingStart     = pbuf;                /*      Initialize the ring                  */
+            pring->OSRingSize      = size;
+            pring->OSRingIn        = 0u;
+            pring->OSRingOut       = 0u;
+            pring->OSRingThreshold = 0u;
+#if OS_ISR_POST_DEFERRED_EN > 0u
+            pring->OSRingWakePend  = OS_FALSE;
+#endif
+            pevent->OSEventType    = OS_EVENT_TYPE_RING;
+            pevent->OSEventCnt     = 0u;
+            pevent->OSEventPtr     = pring;
+#if OS_EVENT_NAME_EN > 0u
+            pevent->OSEventName    = (INT8U *)(void *)"?";
+#endif
+            OS_EventWaitListInit(pevent);                 /*      Initialize the wait list             */
+        } else {
+            pevent->OSEventPtr = (void *)OSEventFreeList; /* No,  Return event control block on error  */
+            OSEventFreeList    = pevent;
+            OS_EXIT_CRITICAL();
+            pevent = (OS_EVENT *)0;
+        }
+    }
+    return (pevent);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DELETE A RING BUFFER
+*
+* Description: This function deletes a ring buffer and readies the task pending on it, if any.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired ring.
+*
+*              opt           determines delete options as follows:
+*                            opt == OS_DEL_NO_PEND   Delete the ring ONLY if no task pending
+*                            opt == OS_DEL_ALWAYS    Deletes the ring even if a task is waiting.
+*                                                    In this case, the task will be readied.
+*
+*              perr          is a pointer to an error code that can contain one of the following values:
+*                            OS_ERR_NONE                  The call was successful and the ring was deleted
+*                            OS_ERR_DEL_ISR               If you tried to delete the ring from an ISR
+*                            OS_ERR_ILLEGAL_DEL_RUN_TIME  If you tried to delete the ring after safety
+*                                                         critical operation started.
+*                            OS_ERR_INVALID_OPT           An invalid option was specified
+*                            OS_ERR_TASK_WAITING          A task was waiting on the ring
+*                            OS_ERR_EVENT_TYPE            If you didn't pass a pointer to a ring
+*                            OS_ERR_PEVENT_NULL           If 'pevent' is a NULL pointer.
+*
+* Returns    : pevent        upon error
+*              (OS_EVENT *)0 if the ring was successfully deleted.
+*
+* Note(s)    : 1) The producer MUST no longer use the ring once it is deleted.
+*              2) The task that was waiting for the ring will be readied and returned an OS_ERR_PEND_ABORT
+*                 if OSRingDel() was called with OS_DEL_ALWAYS.
+*********************************************************************************************************
+*/
+
+#if OS_RING_DEL_EN > 0u
+OS_EVENT  *OSRingDel (OS_EVENT  *pevent,
+                      INT8U      opt,
+                      INT8U     *perr)
+{
+    BOOLEAN    tasks_waiting;
+    OS_EVENT  *pevent_return;
+    OS_RING   *pring;
+#if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_EVENT *)0);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        *perr = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return ((OS_EVENT *)0);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {                         /* Validate 'pevent'                        */
+        *perr = OS_ERR_PEVENT_NULL;
+        return (pevent);
+    }
+#endif
+    if (pevent->OSEventType != OS_EVENT_TYPE_RING) {       /* Validate event block type                */
+        *perr = OS_ERR_EVENT_TYPE;
+        return (pevent);
+    }
+    if (OSIntNesting > 0u) {                               /* See if called from ISR ...               */
+        *perr = OS_ERR_DEL_ISR;                            /* ... can't DELETE from an ISR             */
+        return (pevent);
+    }
+    OS_ENTER_CRITICAL();
+    if (pevent->OSEventGrp != 0u) {                        /* See if a task is waiting on the ring     */
+        tasks_waiting = OS_TRUE;                           /* Yes                                      */
+    } else {
+        tasks_waiting = OS_FALSE;                          /* No                                       */
+    }
+    switch (opt) {
+        case OS_DEL_NO_PEND:                               /* Delete ring only if no task waiting      */
+             if (tasks_waiting == OS_TRUE) {
+                 OS_EXIT_CRITICAL();
+                 *perr          = OS_ERR_TASK_WAITING;
+                 return (pevent);
+             }
+             break;
+
+        case OS_DEL_ALWAYS:                                /* Always delete the ring                   */
+             while (pevent->OSEventGrp != 0u) {            /* Ready the task waiting for the ring      */
+                 (void)OS_EventTaskRdy(pevent, (void *)0, OS_STAT_STREAM, OS_STAT_PEND_ABORT);
+             }
+             break;
+
+        default:
+             OS_EXIT_CRITICAL();
+             *perr = OS_ERR_INVALID_OPT;
+             return (pevent);
+    }
+#if OS_EVENT_NAME_EN > 0u
+    pevent->OSEventName    = (INT8U *)(void *)"?";
+#endif
+    pring                  = (OS_RING *)pevent->OSEventPtr;   /* Return OS_RING to free list           */
+    pring->OSRingPtr       = OSRingFreeList;
+    OSRingFreeList         = pring;
+    pevent->OSEventType    = OS_EVENT_TYPE_UNUSED;
+    pevent->OSEventPtr     = OSEventFreeList;              /* Return Event Control Block to free list  */
+    pevent->OSEventCnt     = 0u;
+    OSEventFreeList        = pevent;
+    OS_EXIT_CRITICAL();
+    if (tasks_waiting == OS_TRUE) {                        /* Reschedule only if a task was waiting    */
+        OS_Sched();                                        /* Find highest priority task ready to run  */
+    }
+    *perr         = OS_ERR_NONE;
+    pevent_return = (OS_EVENT *)0;                         /* Ring has been deleted                    */
+    return (pevent_return);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     PUT A BYTE INTO A RING BUFFER
+*
+* Description: This function is called by the producer, usually an ISR, to add one byte to a ring buffer.
+*              Interrupts are only disabled if the byte makes the ring reach the threshold of the task
+*              waiting for data (see Note #2 at the top of this file).
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired ring.
+*
+*              data          is the byte to add.
+*
+* Returns    : OS_ERR_NONE         The byte was added
+*              OS_ERR_RING_FULL    The ring is full, the byte was dropped
+*              OS_ERR_EVENT_TYPE   If you didn't pass a pointer to a ring
+*              OS_ERR_PEVENT_NULL  If 'pevent' is a NULL pointer
+*********************************************************************************************************
+*/
+
+INT8U  OSRingPut (OS_EVENT  *pevent,
+                  INT8U      data)
+{
+    OS_RING  *pring;
+    INT16U    in;
+    INT16U    in_next;
+
+
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {                    /* Validate 'pevent'                             */
+        return (OS_ERR_PEVENT_NULL);
+    }
+#endif
+    if (pevent->OSEventType != OS_EVENT_TYPE_RING) {  /* Validate event block type                     */
+        return (OS_ERR_EVENT_TYPE);
+    }
+    pring   = (OS_RING *)pevent->OSEventPtr;
+    in      = pring->OSRingIn;
+    in_next = in + 1u;
+    if (in_next == pring->OSRingSize) {               /* Wrap around                                   */
+        in_next = 0u;
+    }
+    if (in_next == pring->OSRingOut) {                /* See if the ring is full                       */
+        return (OS_ERR_RING_FULL);
+    }
+    pring->OSRingStart[in] = data;                    /* Store the byte before publishing it           */
+    pring->OSRingIn        = in_next;
+    if (pring->OSRingThreshold != 0u) {               /* See if the consumer is waiting for data       */
+        OS_RingWake(pevent, pring, OS_RingCnt(pring) - 1u);
+    }
+    return (OS_ERR_NONE);
+}
+
+
+/*
+*********************************************************************************************************
+*                                  WRITE BYTES INTO A RING BUFFER
+*
+* Description: This function is called by the producer, usually an ISR, to add up to 'len' bytes to a
+*              ring buffer.  The bytes are published to the consumer all at once.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired ring.
+*
+*              pdata         is a pointer to the bytes to add.
+*
+*              len           is the number of bytes to add.
+*
+* Returns    : The number of bytes added.  It is lower than 'len' if the ring is full, and 0 if 'pevent'
+*              doesn't point to a ring.
+*********************************************************************************************************
+*/
+
+INT16U  OSRingWrite (OS_EVENT  *pevent,
+                     INT8U     *pdata,
+                     INT16U     len)
+{
+    OS_RING  *pring;
+    INT16U    cnt;
+    INT16U    n;
+    INT16U    in;
+
+
+#if OS_ARG_CHK_EN > 0u
+    if ((pevent == (OS_EVENT *)0) ||                  /* Validate 'pevent' and 'pdata'                 */
+        (pdata  == (INT8U    *)0)) {
+        return (0u);
+    }
+#endif
+    if (pevent->OSEventType != OS_EVENT_TYPE_RING) {  /* Validate event block type                     */
+        return (0u);
+    }
+    pring = (OS_RING *)pevent->OSEventPtr;
+    cnt   = OS_RingCnt(pring);
+    n     = pring->OSRingSize - 1u - cnt;             /* Free space                                    */
+    if (n > len) {
+        n = len;
+    }
+    in    = pring->OSRingIn;
+    for (len = n; len > 0u; len--) {
+        pring->OSRingStart[in] = *pdata++;
+        in++;
+        if (in == pring->OSRingSize) {                /* Wrap around                                   */
+            in = 0u;
+        }
+    }
+    pring->OSRingIn = in;                             /* Publish the bytes                             */
+    if ((n > 0u) && (pring->OSRingThreshold != 0u)) { /* See if the consumer is waiting for data       */
+        OS_RingWake(pevent, pring, cnt);
+    }
+    return (n);
+}
+
+
+/*
+*********************************************************************************************************
+*                                   READ BYTES FROM A RING BUFFER
+*
+* Description: This function is called by the consumer task to take up to 'len' bytes out of a ring
+*              buffer.  If fewer than 'threshold' bytes are present, the task waits until the producer
+*              brings the ring up to 'threshold' bytes or until the timeout expires.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired ring.
+*
+*              pbuf          is a pointer to where the bytes are copied.
+*
+*              len           is the maximum number of bytes to read.
+*
+*              threshold     is the number of bytes that must be present before the bytes are read.
+*                            0 reads whatever is present without waiting.
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will
+*                            wait for the data up to the amount of time specified by this argument.  If
+*                            you specify 0, however, your task will wait forever.
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE             The call was successful
+*                            OS_ERR_TIMEOUT          Fewer than 'threshold' bytes were received within the
+*                                                    specified 'timeout'.  The bytes present are returned.
+*                            OS_ERR_PEND_ABORT       The ring was deleted while the task was waiting.
+*                            OS_ERR_EVENT_TYPE       If you didn't pass a pointer to a ring
+*                            OS_ERR_PEVENT_NULL      If 'pevent' is a NULL pointer
+*                            OS_ERR_PDATA_NULL       If 'pbuf' is a NULL pointer
+*                            OS_ERR_RING_THRESHOLD   If 'threshold' is larger than 'len' or than what the
+*                                                    ring can hold
+*                            OS_ERR_PEND_ISR         If you called this function from an ISR and the result
+*                                                    would lead to a suspension.
+*                            OS_ERR_PEND_LOCKED      If you called this function with the scheduler locked
+*                                                    and the result would lead to a suspension.
+*
+* Returns    : The number of bytes copied to 'pbuf'.
+*
+* Note(s)    : 1) Only ONE task may read from a given ring.
+*********************************************************************************************************
+*/
+
+INT16U  OSRingRead (OS_EVENT  *pevent,
+                    INT8U     *pbuf,
+                    INT16U     len,
+                    INT16U     threshold,
+                    INT32U     timeout,
+                    INT8U     *perr)
+{
+    OS_RING   *pring;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {                    /* Validate 'pevent'                             */
+        *perr = OS_ERR_PEVENT_NULL;
+        return (0u);
+    }
+    if (pbuf == (INT8U *)0) {                         /* Validate 'pbuf'                               */
+        *perr = OS_ERR_PDATA_NULL;
+        return (0u);
+    }
+#endif
+    if (pevent->OSEventType != OS_EVENT_TYPE_RING) {  /* Validate event block type                     */
+        *perr = OS_ERR_EVENT_TYPE;
+        return (0u);
+    }
+    pring = (OS_RING *)pevent->OSEventPtr;
+    if ((threshold > len) ||                          /* Validate 'threshold'                          */
+        (threshold >= pring->OSRingSize)) {
+        *perr = OS_ERR_RING_THRESHOLD;
+        return (0u);
+    }
+    *perr = OS_ERR_NONE;
+    if (OS_RingCnt(pring) < threshold) {              /* Must we wait for more data?                   */
+        if (OSIntNesting > 0u) {                      /* See if called from ISR ...                    */
+            *perr = OS_ERR_PEND_ISR;                  /* ... can't PEND from an ISR                    */
+            return (0u);
+        }
+        if (OSLockNesting > 0u) {                     /* See if called with scheduler locked ...       */
+            *perr = OS_ERR_PEND_LOCKED;               /* ... can't PEND when locked                    */
+            return (0u);
+        }
+        OS_ENTER_CRITICAL();
+        if (OS_RingCnt(pring) < threshold) {          /* The producer may have caught up meanwhile     */
+            pring->OSRingThreshold   = threshold;     /* Tell the producer when to ready us            */
+            OSTCBCur->OSTCBStat     |= OS_STAT_STREAM;
+            OSTCBCur->OSTCBStatPend  = OS_STAT_PEND_OK;
+            OSTCBCur->OSTCBDly       = timeout;       /* Store pend timeout in TCB                     */
+#if OS_TICK_LIST_EN > 0u
+            OS_TickListInsert(OSTCBCur);              /* Add task to the list of delayed tasks         */
+#endif
+            OS_EventTaskWait(pevent);                 /* Suspend task until data or timeout occurs     */
+            OS_EXIT_CRITICAL();
+            OS_Sched();                               /* Find next highest priority task ready         */
+            OS_ENTER_CRITICAL();
+            switch (OSTCBCur->OSTCBStatPend) {        /* See if we timed-out or aborted                */
+                case OS_STAT_PEND_OK:
+                     break;
+
+                case OS_STAT_PEND_ABORT:
+                     *perr = OS_ERR_PEND_ABORT;       /* The ring was deleted                          */
+                     break;
+
+                case OS_STAT_PEND_TO:
+                default:
+                     OS_EventTaskRemove(OSTCBCur, pevent);
+                     pring->OSRingThreshold = 0u;     /* The producer no longer needs to ready us      */
+                     *perr = OS_ERR_TIMEOUT;
+                     break;
+            }
+            OSTCBCur->OSTCBStat          =  OS_STAT_RDY;      /* Set   task  status to ready           */
+            OSTCBCur->OSTCBStatPend      =  OS_STAT_PEND_OK;  /* Clear pend  status                    */
+            OSTCBCur->OSTCBEventPtr      = (OS_EVENT  *)0;    /* Clear event pointers                  */
+#if (OS_EVENT_MULTI_EN > 0u)
+            OSTCBCur->OSTCBEventMultiPtr = (OS_EVENT **)0;
+            OSTCBCur->OSTCBEventMultiRdy = (OS_EVENT  *)0;
+#endif
+        }
+        OS_EXIT_CRITICAL();
+        if (*perr == OS_ERR_PEND_ABORT) {
+            return (0u);
+        }
+    }
+    return (OS_RingGet(pring, pbuf, len));            /* Take the bytes out of the ring                */
+}
+
+
+/*
+*********************************************************************************************************
+*                                 READY THE TASK WAITING FOR A RING BUFFER
+*
+* Description: This function is called when a write brings a ring up to the threshold of the task waiting
+*              for it.  The task is made ready to run.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the ring.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) The threshold is checked again with interrupts disabled because the task may have timed
+*                 out since the write.
+*********************************************************************************************************
+*/
+
+void  OS_RingSignal (OS_EVENT  *pevent)
+{
+    OS_RING   *pring;
+    INT16U     threshold;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+    OS_ENTER_CRITICAL();
+    if (pevent->OSEventType != OS_EVENT_TYPE_RING) {  /* The ring may have been deleted meanwhile      */
+        OS_EXIT_CRITICAL();
+        return;
+    }
+    pring     = (OS_RING *)pevent->OSEventPtr;
+    threshold = pring->OSRingThreshold;
+    if ((threshold         != 0u) &&              /* See Note #2                                   */
+        (OS_RingCnt(pring) >= threshold)) {
+        pring->OSRingThreshold = 0u;
+        if (pevent->OSEventGrp != 0u) {               /* The task may also have been deleted           */
+            (void)OS_EventTaskRdy(pevent, (void *)0, OS_STAT_STREAM, OS_STAT_PEND_OK);
+            OS_EXIT_CRITICAL();
+            OS_Sched();                               /* Find HPT ready to run                         */
+            return;
+        }
+    }
+    OS_EXIT_CRITICAL();
+}
+
+
+/*
+*********************************************************************************************************
+*                                          INITIALIZATION
+*                               INITIALIZE THE RING BUFFER MANAGEMENT
+*
+* Description: This function is called by OSInit() to initialize the free list of ring control blocks.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+
+void  OS_RingInit (void)
+{
+#if OS_MAX_RINGS == 1u
+    OSRingFreeList            = &OSRingTbl[0];           /* Only ONE ring!                             */
+    OSRingFreeList->OSRingPtr = (OS_RING *)0;
+#endif
+
+#if OS_MAX_RINGS >= 2u
+    INT16U    ix;
+    OS_RING  *pring;
+
+
+
+    OS_MemClr((INT8U *)&OSRingTbl[0], sizeof(OSRingTbl));  /* Clear the ring table                     */
+    for (ix = 0u; ix < (OS_MAX_RINGS - 1u); ix++) {        /* Init. list of free RING control blocks   */
+        pring            = &OSRingTbl[ix];
+        pring->OSRingPtr = &OSRingTbl[ix + 1u];
+    }
+    pring            = &OSRingTbl[ix];
+    pring->OSRingPtr = (OS_RING *)0;
+    OSRingFreeList   = &OSRingTbl[0];
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                 NUMBER OF BYTES IN A RING BUFFER
+*
+* Description: This function returns the number of bytes present in a ring buffer.
+*
+* Arguments  : pring         is a pointer to the ring control block
+*
+* Returns    : The number of bytes present.
+*********************************************************************************************************
+*/
+
+static  INT16U  OS_RingCnt (OS_RING  *pring)
+{
+    INT16U  in;
+    INT16U  out;
+
+
+    in  = pring->OSRingIn;                            /* Read each index once                          */
+    out = pring->OSRingOut;
+    if (in >= out) {
+        return (in - out);
+    }
+    return ((pring->OSRingSize - out) + in);
+}
+
+
+/*
+*********************************************************************************************************
+*                                 TAKE BYTES OUT OF A RING BUFFER
+*
+* Description: This function copies up to 'len' bytes out of a ring buffer and frees their space.
+*
+* Arguments  : pring         is a pointer to the ring control block
+*
+*              pbuf          is a pointer to where the bytes are copied
+*
+*              len           is the maximum number of bytes to copy
+*
+* Returns    : The number of bytes copied.
+*
+* Note(s)    : This function is only called by the consumer and runs with interrupts enabled.  The space
+*              is handed back to the producer after the bytes were copied.
+*********************************************************************************************************
+*/
+
+static  INT16U  OS_RingGet (OS_RING  *pring,
+                            INT8U    *pbuf,
+                            INT16U    len)
+{
+    INT16U  n;
+    INT16U  out;
+
+
+    n = OS_RingCnt(pring);
+    if (n > len) {
+        n = len;
+    }
+    out = pring->OSRingOut;
+    for (len = n; len > 0u; len--) {
+        *pbuf++ = pring->OSRingStart[out];
+        out++;
+        if (out == pring->OSRingSize) {               /* Wrap around                                   */
+            out = 0u;
+        }
+    }
+    pring->OSRingOut = out;                           /* Free the space                                */
+    return (n);
+}
+
+
+/*
+*********************************************************************************************************
+*                              WAKE UP THE CONSUMER OF A RING BUFFER
+*
+* Description: This function is called by the producer after it added bytes to a ring while the consumer
+*              waits for data.  The consumer is readied if the ring reached its threshold.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the ring.
+*
+*              pring         is a pointer to the ring control block
+*
+*              cnt_prev      is the number of bytes that were present before the write.
+*
+* Returns    : none
+*
+* Note(s)    : 1) When called from an ISR with OS_ISR_POST_DEFERRED_EN set to 1, readying the consumer is
+*                 deferred to the ISR post handler task.  It is only deferred by the write that reaches
+*                 the threshold, so that the following writes don't fill the ring of deferred posts.
+*              2) If the ring of deferred posts is full, 'OSRingWakePend' is set and the post is retried
+*                 by the next write.  Until then, the consumer keeps waiting, or times out.
+*********************************************************************************************************
+*/
+
+static  void  OS_RingWake (OS_EVENT  *pevent,
+                           OS_RING   *pring,
+                           INT16U     cnt_prev)
+{
+    INT16U  threshold;
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    INT8U   err;
+#endif
+
+
+    threshold = pring->OSRingThreshold;
+    if ((threshold == 0u) ||                          /* See if the threshold is reached               */
+        (OS_RingCnt(pring) < threshold)) {
+        return;
+    }
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNesting > 0u) {
+        if ((cnt_prev < threshold) ||                 /* Defer once, when the threshold is reached ... */
+            (pring->OSRingWakePend == OS_TRUE)) {     /* ... or again if that post was lost (Note #2)  */
+            err = OSIntQ_Post(OS_INT_Q_RING_SIGNAL, (void *)pevent, (void *)0, 0u, OS_POST_OPT_NONE);
+            if (err == OS_ERR_NONE) {
+                pring->OSRingWakePend = OS_FALSE;
+            } else {
+                pring->OSRingWakePend = OS_TRUE;
+            }
+        }
+        return;
+    }
+#else
+    cnt_prev = cnt_prev;                              /* Prevent compiler warning                      */
+#endif
+    OS_RingSignal(pevent);
+}
+#endif                                                /* OS_RING_EN                                    */
+#endif                                                /* OS_RING_C                                     */
@@ -0,0 +1,703 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-II
+*                                        The Real-Time Kernel
+*
+*                    Copyright 1992-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*
+*                                     READER-WRITER LOCK MANAGEMENT
+*
+* Filename : os_rwlock.c
+* Version  : V2.93.01
+*********************************************************************************************************
+*/
+
+#ifndef  OS_RWLOCK_C
+#define  OS_RWLOCK_C
+
+#define  MICRIUM_SOURCE
+
+#ifndef  OS_MASTER_FILE
+#include <ucos_ii.h>
+#endif
+
+#if OS_RWLOCK_EN > 0u
+/*
+*********************************************************************************************************
+*                                                        NOTES
+*
+* 1) A RW lock is held either by any number of readers or by ONE writer.  '.OSEventCnt' holds the number
+*    of readers or OS_RWLOCK_WR when the lock is held by a writer.  '.OSEventPtr' then points to the
+*    OS_TCB of the writer.
+*
+* 2) Readers and writers wait in the same wait list.  '.OSTCBRWLockWr' tells a waiting writer from a
+*    waiting reader.  When the lock is released, the waiting tasks are readied by priority: readers
+*    are admitted until the highest priority task left waiting is a writer, which then gets the lock
+*    as soon as the last reader is gone.
+*
+* 3) Waiting writers take precedence over readers of the same or of a lower priority: such a reader
+*    waits even though the lock is only held by readers.  A reader of a higher priority than all the
+*    waiting tasks gets the lock right away.  As a result, no reader ever waits ahead of a writer of a
+*    higher priority and only the highest priority waiting task must be looked at to admit a reader.
+*
+* 4) A reader takes the lock with a short critical section and without calling the scheduler as long
+*    as no writer holds it or waits for it.  Releasing a read lock only calls the scheduler when the
+*    last reader leaves and tasks are waiting.
+*
+* 5) The priority of the tasks holding the lock is not raised.  Readers are not recorded, so a task
+*    holding a read lock MUST NOT ask for a write lock, it would wait for itself.
+*********************************************************************************************************
+*/
+
+#define  OS_RWLOCK_WR            0xFFFFu                 /* '.OSEventCnt' when a writer holds the lock */
+#define  OS_RWLOCK_RD_MAX        0xFFFEu                 /* Maximum number of readers                  */
+
+/*
+*********************************************************************************************************
+*                                          LOCAL PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  BOOLEAN  OS_RWLockRdy    (OS_EVENT *pevent);
+static  void     OS_RWLockWait   (OS_EVENT *pevent, INT32U timeout);
+static  OS_TCB  *OS_RWLockWaitHPT(OS_EVENT *pevent);
+
+
+/*
+*********************************************************************************************************
+*                                        CREATE A RW LOCK
+*
+* Description: This function creates a reader-writer lock.
+*
+* Arguments  : none
+*
+* Returns    : != (OS_EVENT *)0  is a pointer to the event control block (OS_EVENT) associated with the
+*                                created RW lock
+*              == (OS_EVENT *)0  if no event control blocks were available
+*********************************************************************************************************
+*/
+
+OS_EVENT  *OSRWLockCreate (void)
+{
+    OS_EVENT  *pevent;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_EVENT *)0);
+    }
+#endif
+
+    if (OSIntNesting > 0u) {                     /* See if called from ISR ...                         */
+        return ((OS_EVENT *)0);                  /* ... can't CREATE from an ISR                       */
+    }
+    OS_ENTER_CRITICAL();
+    pevent = OSEventFreeList;                    /* Get next free event control block                  */
+    if (OSEventFreeList != (OS_EVENT *)0) {      /* See if pool of free ECB pool was empty             */
+        OSEventFreeList = (OS_EVENT *)OSEventFreeList->OSEventPtr;
+    }
+    OS_EXIT_CRITICAL();
+    if (pevent != (OS_EVENT *)0) {               /* Get an event control block                         */
+        pevent->OSEventType    = OS_EVENT_TYPE_RWLOCK;
+        pevent->OSEventCnt     = 0u;             /* No reader ...                                      */
+        pevent->OSEventPtr     = (void *)0;      /* ... and no writer                                  */
+#if OS_EVENT_NAME_EN > 0u
+        pevent->OSEventName    = (INT8U *)(void *)"?";
+#endif
+        OS_EventWaitListInit(pevent);            /* Initialize to 'nobody waiting' on RW lock          */
+    }
+    return (pevent);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          DELETE A RW LOCK
+*
+* Description: This function deletes a reader-writer lock and readies all tasks pending on it.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired RW lock.
+*
+*              opt           determines delete options as follows:
+*                            opt == OS_DEL_NO_PEND   Delete the RW lock ONLY if no task pending
+*                            opt == OS_DEL_ALWAYS    Deletes the RW lock even if tasks are waiting.
+*                                                    In this case, all the tasks pending will be readied.
+*
+*              perr          is a pointer to an error code that can contain one of the following values:
+*                            OS_ERR_NONE                  The RW lock was successfully deleted
+*                            OS_ERR_DEL_ISR               If you tried to delete the RW lock from an ISR
+*                            OS_ERR_ILLEGAL_DEL_RUN_TIME  If you tried to delete the RW lock after safety
+*                                                         critical operation started.
+*                            OS_ERR_INVALID_OPT           An invalid option was specified
+*                            OS_ERR_TASK_WAITING          One or more tasks were waiting on the RW lock
+*                            OS_ERR_EVENT_TYPE            If you didn't pass a pointer to a RW lock
+*                            OS_ERR_PEVENT_NULL           If 'pevent' is a NULL pointer.
+*
+* Returns    : pevent        upon error
+*              (OS_EVENT *)0 if the RW lock was successfully deleted.
+*
+* Note(s)    : 1) The tasks that were waiting for the RW lock will be readied and returned an
+*                 OS_ERR_PEND_ABORT if OSRWLockDel() was called with OS_DEL_ALWAYS.
+*
+*              2) The tasks holding the RW lock MUST NOT release it once it is deleted.  The resource is
+*                 no longer guarded by the lock.
+*********************************************************************************************************
+*/
+
+#if OS_RWLOCK_DEL_EN > 0u
+OS_EVENT  *OSRWLockDel (OS_EVENT  *pevent,
+                        INT8U      opt,
+                        INT8U     *perr)
+{
+    BOOLEAN    tasks_waiting;
+#if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_EVENT *)0);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        *perr = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return ((OS_EVENT *)0);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {                         /* Validate 'pevent'                        */
+        *perr = OS_ERR_PEVENT_NULL;
+        return (pevent);
+    }
+#endif
+    if (pevent->OSEventType != OS_EVENT_TYPE_RWLOCK) {     /* Validate event block type                */
+        *perr = OS_ERR_EVENT_TYPE;
+        return (pevent);
+    }
+    if (OSIntNesting > 0u) {                               /* See if called from ISR ...               */
+        *perr = OS_ERR_DEL_ISR;                            /* ... can't DELETE from an ISR             */
+        return (pevent);
+    }
+    OS_ENTER_CRITICAL();
+    if (pevent->OSEventGrp != 0u) {                        /* See if any tasks waiting on RW lock      */
+        tasks_waiting = OS_TRUE;                           /* Yes                                      */
+    } else {
+        tasks_waiting = OS_FALSE;                          /* No                                       */
+    }
+    switch (opt) {
+        case OS_DEL_NO_PEND:                               /* Delete RW lock only if no task waiting   */
+             if (tasks_waiting == OS_TRUE) {
+                 OS_EXIT_CRITICAL();
+                 *perr = OS_ERR_TASK_WAITING;
+                 return (pevent);
+             }
+             break;
+
+        case OS_DEL_ALWAYS:                                /* Always delete the RW lock                */
+             while (pevent->OSEventGrp != 0u) {            /* Ready ALL tasks waiting for RW lock      */
+                 (void)OS_EventTaskRdy(pevent, (void *)0, OS_STAT_RWLOCK, OS_STAT_PEND_ABORT);
+             }
+             break;
+
+        default:
+             OS_EXIT_CRITICAL();
+             *perr = OS_ERR_INVALID_OPT;
+             return (pevent);
+    }
+#if OS_EVENT_NAME_EN > 0u
+    pevent->OSEventName    = (INT8U *)(void *)"?";
+#endif
+    pevent->OSEventType    = OS_EVENT_TYPE_UNUSED;
+    pevent->OSEventPtr     = OSEventFreeList;              /* Return Event Control Block to free list  */
+    pevent->OSEventCnt     = 0u;
+    OSEventFreeList        = pevent;                       /* Get next free event control block        */
+    OS_EXIT_CRITICAL();
+    if (tasks_waiting == OS_TRUE) {                        /* Reschedule only if task(s) were waiting  */
+        OS_Sched();                                        /* Find highest priority task ready to run  */
+    }
+    *perr = OS_ERR_NONE;
+    return ((OS_EVENT *)0);                                /* RW lock has been deleted                 */
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      ACQUIRE A RW LOCK TO READ
+*
+* Description: This function waits until the calling task may read the resource guarded by the RW lock,
+*              i.e. until no writer holds the lock or waits for it with the same or a higher priority.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired RW lock.
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will
+*                            wait for the RW lock up to the amount of time specified by this argument.
+*                            If you specify 0, however, your task will wait forever.
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE             The call was successful and your task may read
+*                            OS_ERR_TIMEOUT          The RW lock was not available within the 'timeout'.
+*                            OS_ERR_PEND_ABORT       The RW lock was deleted while the task was waiting.
+*                            OS_ERR_EVENT_TYPE       If you didn't pass a pointer to a RW lock
+*                            OS_ERR_PEVENT_NULL      If 'pevent' is a NULL pointer
+*                            OS_ERR_RWLOCK_OVF       If too many readers already hold the RW lock
+*                            OS_ERR_PEND_ISR         If you called this function from an ISR
+*                            OS_ERR_PEND_LOCKED      If you called this function with the scheduler
+*                                                    locked and the result would lead to a suspension.
+*
+* Returns    : none
+*
+* Note(s)    : 1) Each successful call MUST be matched by a call to OSRWLockReadPost().
+*********************************************************************************************************
+*/
+
+void  OSRWLockReadPend (OS_EVENT  *pevent,
+                        INT32U     timeout,
+                        INT8U     *perr)
+{
+    INT16U     cnt;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {                    /* Validate 'pevent'                             */
+        *perr = OS_ERR_PEVENT_NULL;
+        return;
+    }
+#endif
+    if (pevent->OSEventType != OS_EVENT_TYPE_RWLOCK) {/* Validate event block type                     */
+        *perr = OS_ERR_EVENT_TYPE;
+        return;
+    }
+    if (OSIntNesting > 0u) {                          /* See if called from ISR ...                    */
+        *perr = OS_ERR_PEND_ISR;                      /* ... can't PEND from an ISR                    */
+        return;
+    }
+    OS_ENTER_CRITICAL();
+    cnt = pevent->OSEventCnt;
+    if (cnt == OS_RWLOCK_RD_MAX) {                    /* See if there is room for another reader       */
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_RWLOCK_OVF;
+        return;
+    }
+    if (cnt != OS_RWLOCK_WR) {                        /* See if no writer holds the lock and ...       */
+        if ((pevent->OSEventGrp == 0u) ||             /* ... only lower prio tasks wait (file Note #3) */
+            (OSTCBCur->OSTCBPrio < OS_RWLockWaitHPT(pevent)->OSTCBPrio)) {
+            pevent->OSEventCnt = cnt + 1u;            /* Yes, add a reader                             */
+            OS_EXIT_CRITICAL();
+            *perr = OS_ERR_NONE;
+            return;
+        }
+    }
+    if (OSLockNesting > 0u) {                         /* See if called with scheduler locked ...       */
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_PEND_LOCKED;                   /* ... can't PEND when locked                    */
+        return;
+    }
+    OSTCBCur->OSTCBRWLockWr = OS_FALSE;               /* Wait as a reader                              */
+    OS_RWLockWait(pevent, timeout);
+    OS_EXIT_CRITICAL();
+    OS_Sched();                                       /* Find next highest priority task ready         */
+    OS_ENTER_CRITICAL();
+    switch (OSTCBCur->OSTCBStatPend) {                /* See if we timed-out or aborted                */
+        case OS_STAT_PEND_OK:                         /* The task readying us counted us in            */
+             *perr = OS_ERR_NONE;
+             break;
+
+        case OS_STAT_PEND_ABORT:
+             *perr = OS_ERR_PEND_ABORT;               /* The RW lock was deleted                       */
+             break;
+
+        case OS_STAT_PEND_TO:
+        default:
+             OS_EventTaskRemove(OSTCBCur, pevent);    /* A waiting reader holds nobody back            */
+             *perr = OS_ERR_TIMEOUT;
+             break;
+    }
+    OSTCBCur->OSTCBStat          =  OS_STAT_RDY;      /* Set   task  status to ready                   */
+    OSTCBCur->OSTCBStatPend      =  OS_STAT_PEND_OK;  /* Clear pend  status                            */
+    OSTCBCur->OSTCBEventPtr      = (OS_EVENT  *)0;    /* Clear event pointers                          */
+#if (OS_EVENT_MULTI_EN > 0u)
+    OSTCBCur->OSTCBEventMultiPtr = (OS_EVENT **)0;
+    OSTCBCur->OSTCBEventMultiRdy = (OS_EVENT  *)0;
+#endif
+    OS_EXIT_CRITICAL();
+}
+
+
+/*
+*********************************************************************************************************
+*                                      RELEASE A RW LOCK AFTER READING
+*
+* Description: This function releases a RW lock acquired with OSRWLockReadPend().  When the last reader
+*              leaves, the highest priority waiting writer gets the lock.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired RW lock.
+*
+* Returns    : OS_ERR_NONE              The call was successful
+*              OS_ERR_RWLOCK_NOT_OWNER  If no reader holds the RW lock
+*              OS_ERR_EVENT_TYPE        If you didn't pass a pointer to a RW lock
+*              OS_ERR_PEVENT_NULL       If 'pevent' is a NULL pointer
+*              OS_ERR_POST_ISR          If you called this function from an ISR
+*********************************************************************************************************
+*/
+
+INT8U  OSRWLockReadPost (OS_EVENT *pevent)
+{
+    INT16U     cnt;
+    BOOLEAN    sched;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+    if (OSIntNesting > 0u) {                          /* See if called from ISR ...                    */
+        return (OS_ERR_POST_ISR);                     /* ... only tasks may hold a RW lock             */
+    }
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {                    /* Validate 'pevent'                             */
+        return (OS_ERR_PEVENT_NULL);
+    }
+#endif
+    if (pevent->OSEventType != OS_EVENT_TYPE_RWLOCK) {/* Validate event block type                     */
+        return (OS_ERR_EVENT_TYPE);
+    }
+    OS_ENTER_CRITICAL();
+    cnt = pevent->OSEventCnt;
+    if ((cnt == 0u) ||                                /* See if readers hold the lock                  */
+        (cnt == OS_RWLOCK_WR)) {
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_RWLOCK_NOT_OWNER);
+    }
+    cnt--;
+    pevent->OSEventCnt = cnt;
+    sched              = OS_FALSE;
+    if ((cnt == 0u) &&                                /* Last reader: see if a writer is waiting       */
+        (pevent->OSEventGrp != 0u)) {
+        sched = OS_RWLockRdy(pevent);
+    }
+    OS_EXIT_CRITICAL();
+    if (sched == OS_TRUE) {
+        OS_Sched();                                   /* Find highest priority task ready to run       */
+    }
+    return (OS_ERR_NONE);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     ACQUIRE A RW LOCK TO WRITE
+*
+* Description: This function waits until the calling task is the only one holding the RW lock.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired RW lock.
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will
+*                            wait for the RW lock up to the amount of time specified by this argument.
+*                            If you specify 0, however, your task will wait forever.
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE             The call was successful and your task may write
+*                            OS_ERR_TIMEOUT          The RW lock was not available within the 'timeout'.
+*                            OS_ERR_PEND_ABORT       The RW lock was deleted while the task was waiting.
+*                            OS_ERR_EVENT_TYPE       If you didn't pass a pointer to a RW lock
+*                            OS_ERR_PEVENT_NULL      If 'pevent' is a NULL pointer
+*                            OS_ERR_PEND_ISR         If you called this function from an ISR
+*                            OS_ERR_PEND_LOCKED      If you called this function with the scheduler
+*                                                    locked and the result would lead to a suspension.
+*
+* Returns    : none
+*
+* Note(s)    : 1) Each successful call MUST be matched by a call to OSRWLockWritePost() from the same
+*                 task.
+*
+*              2) Readers of a lower priority that ask for the lock after the writer wait behind it.
+*                 When the writer gives up waiting, the readers it held back are readied.
+*********************************************************************************************************
+*/
+
+void  OSRWLockWritePend (OS_EVENT  *pevent,
+                         INT32U     timeout,
+                         INT8U     *perr)
+{
+    BOOLEAN    sched;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {                    /* Validate 'pevent'                             */
+        *perr = OS_ERR_PEVENT_NULL;
+        return;
+    }
+#endif
+    if (pevent->OSEventType != OS_EVENT_TYPE_RWLOCK) {/* Validate event block type                     */
+        *perr = OS_ERR_EVENT_TYPE;
+        return;
+    }
+    if (OSIntNesting > 0u) {                          /* See if called from ISR ...                    */
+        *perr = OS_ERR_PEND_ISR;                      /* ... can't PEND from an ISR                    */
+        return;
+    }
+    OS_ENTER_CRITICAL();
+    if (pevent->OSEventCnt == 0u) {                   /* See if nobody holds the lock                  */
+        pevent->OSEventCnt = OS_RWLOCK_WR;            /* Yes, take it                                  */
+        pevent->OSEventPtr = (void *)OSTCBCur;
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_NONE;
+        return;
+    }
+    if (OSLockNesting > 0u) {                         /* See if called with scheduler locked ...       */
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_PEND_LOCKED;                   /* ... can't PEND when locked                    */
+        return;
+    }
+    OSTCBCur->OSTCBRWLockWr = OS_TRUE;                /* Wait as a writer                              */
+    OS_RWLockWait(pevent, timeout);
+    OS_EXIT_CRITICAL();
+    OS_Sched();                                       /* Find next highest priority task ready         */
+    OS_ENTER_CRITICAL();
+    sched = OS_FALSE;
+    switch (OSTCBCur->OSTCBStatPend) {                /* See if we timed-out or aborted                */
+        case OS_STAT_PEND_OK:                         /* The task readying us handed us the lock       */
+             *perr = OS_ERR_NONE;
+             break;
+
+        case OS_STAT_PEND_ABORT:
+             *perr = OS_ERR_PEND_ABORT;               /* The RW lock was deleted                       */
+             break;
+
+        case OS_STAT_PEND_TO:
+        default:
+             OS_EventTaskRemove(OSTCBCur, pevent);
+             if ((pevent->OSEventCnt != OS_RWLOCK_WR) &&   /* Admit the readers we held back (Note #2) */
+                 (pevent->OSEventGrp != 0u)) {
+                 sched = OS_RWLockRdy(pevent);
+             }
+             *perr = OS_ERR_TIMEOUT;
+             break;
+    }
+    OSTCBCur->OSTCBRWLockWr      =  OS_FALSE;
+    OSTCBCur->OSTCBStat          =  OS_STAT_RDY;      /* Set   task  status to ready                   */
+    OSTCBCur->OSTCBStatPend      =  OS_STAT_PEND_OK;  /* Clear pend  status                            */
+    OSTCBCur->OSTCBEventPtr      = (OS_EVENT  *)0;    /* Clear event pointers                          */
+#if (OS_EVENT_MULTI_EN > 0u)
+    OSTCBCur->OSTCBEventMultiPtr = (OS_EVENT **)0;
+    OSTCBCur->OSTCBEventMultiRdy = (OS_EVENT  *)0;
+#endif
+    OS_EXIT_CRITICAL();
+    if (sched == OS_TRUE) {
+        OS_Sched();                                   /* Find highest priority task ready to run       */
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                     RELEASE A RW LOCK AFTER WRITING
+*
+* Description: This function releases a RW lock acquired with OSRWLockWritePend().  The waiting tasks are
+*              readied by priority as described in the notes at the top of this file.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired RW lock.
+*
+* Returns    : OS_ERR_NONE              The call was successful
+*              OS_ERR_RWLOCK_NOT_OWNER  If the calling task is not the writer holding the RW lock
+*              OS_ERR_EVENT_TYPE        If you didn't pass a pointer to a RW lock
+*              OS_ERR_PEVENT_NULL       If 'pevent' is a NULL pointer
+*              OS_ERR_POST_ISR          If you called this function from an ISR
+*********************************************************************************************************
+*/
+
+INT8U  OSRWLockWritePost (OS_EVENT *pevent)
+{
+    BOOLEAN    sched;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+    if (OSIntNesting > 0u) {                          /* See if called from ISR ...                    */
+        return (OS_ERR_POST_ISR);                     /* ... only tasks may hold a RW lock             */
+    }
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {                    /* Validate 'pevent'                             */
+        return (OS_ERR_PEVENT_NULL);
+    }
+#endif
+    if (pevent->OSEventType != OS_EVENT_TYPE_RWLOCK) {/* Validate event block type                     */
+        return (OS_ERR_EVENT_TYPE);
+    }
+    OS_ENTER_CRITICAL();
+    if ((pevent->OSEventCnt != OS_RWLOCK_WR) ||       /* See if the calling task is the writer         */
+        (pevent->OSEventPtr != (void *)OSTCBCur)) {
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_RWLOCK_NOT_OWNER);
+    }
+    pevent->OSEventCnt = 0u;                          /* Release the lock                              */
+    pevent->OSEventPtr = (void *)0;
+    sched              = OS_FALSE;
+    if (pevent->OSEventGrp != 0u) {                   /* Hand it over to the waiting tasks             */
+        sched = OS_RWLockRdy(pevent);
+    }
+    OS_EXIT_CRITICAL();
+    if (sched == OS_TRUE) {
+        OS_Sched();                                   /* Find highest priority task ready to run       */
+    }
+    return (OS_ERR_NONE);
+}
+
+
+/*
+*********************************************************************************************************
+*                                  HAND A RW LOCK OVER TO WAITING TASKS
+*
+* Description: This function readies the waiting tasks that may now hold the RW lock, highest priority
+*              first: readers until a writer is the highest priority task left waiting, then that writer
+*              if no reader holds the lock.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the RW lock.  No
+*                            writer holds the lock.
+*
+* Returns    : OS_TRUE       if a task was readied
+*              OS_FALSE      otherwise
+*
+* Note(s)    : This function is called with interrupts disabled.
+*********************************************************************************************************
+*/
+
+static  BOOLEAN  OS_RWLockRdy (OS_EVENT  *pevent)
+{
+    OS_TCB   *ptcb;
+    BOOLEAN   rdy;
+
+
+    rdy = OS_FALSE;
+    while (pevent->OSEventGrp != 0u) {
+        ptcb = OS_RWLockWaitHPT(pevent);
+        if (ptcb->OSTCBRWLockWr == OS_TRUE) {         /* A writer waits for all the readers to leave   */
+            if (pevent->OSEventCnt == 0u) {
+                pevent->OSEventCnt = OS_RWLOCK_WR;
+                pevent->OSEventPtr = (void *)ptcb;
+                (void)OS_EventTaskRdy(pevent, (void *)0, OS_STAT_RWLOCK, OS_STAT_PEND_OK);
+                rdy = OS_TRUE;
+            }
+            break;
+        }
+        if (pevent->OSEventCnt == OS_RWLOCK_RD_MAX) { /* No room for another reader                    */
+            break;
+        }
+        pevent->OSEventCnt++;                         /* Count the reader in on its behalf             */
+        (void)OS_EventTaskRdy(pevent, (void *)0, OS_STAT_RWLOCK, OS_STAT_PEND_OK);
+        rdy = OS_TRUE;
+    }
+    return (rdy);
+}
+
+
+/*
+*********************************************************************************************************
+*                                MAKE THE CURRENT TASK WAIT FOR A RW LOCK
+*
+* Description: This function suspends the current task until the RW lock readies it or the timeout
+*              expires.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the RW lock.
+*
+*              timeout       is the timeout period (in clock ticks), 0 to wait forever.
+*
+* Returns    : none
+*
+* Note(s)    : This function is called with interrupts disabled.
+*********************************************************************************************************
+*/
+
+static  void  OS_RWLockWait (OS_EVENT  *pevent,
+                             INT32U     timeout)
+{
+    OSTCBCur->OSTCBStat     |= OS_STAT_RWLOCK;
+    OSTCBCur->OSTCBStatPend  = OS_STAT_PEND_OK;
+    OSTCBCur->OSTCBDly       = timeout;               /* Store pend timeout in TCB                     */
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListInsert(OSTCBCur);                      /* Add task to the list of delayed tasks         */
+#endif
+    OS_EventTaskWait(pevent);                         /* Suspend task until ready or timeout           */
+}
+
+
+/*
+*********************************************************************************************************
+*                            FIND THE HIGHEST PRIORITY TASK WAITING FOR A RW LOCK
+*
+* Description: This function returns the task that OS_EventTaskRdy() would ready next.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the RW lock.  At
+*                            least one task is waiting on it.
+*
+* Returns    : A pointer to the OS_TCB of the task.
+*
+* Note(s)    : This function is called with interrupts disabled.
+*********************************************************************************************************
+*/
+
+static  OS_TCB  *OS_RWLockWaitHPT (OS_EVENT  *pevent)
+{
+    INT8U  prio;
+
+
+    prio = OS_EventWaitPrioGet(pevent);
+#if OS_SCHED_RR_EN > 0u
+    return (OS_SchedRREventTCB(prio, pevent));        /* First task at 'prio' waiting, as readied      */
+#else
+    return (OSTCBPrioTbl[prio]);
+#endif
+}
+#endif                                                /* OS_RWLOCK_EN                                  */
+#endif                                                /* OS_RWLOCK_C                                   */
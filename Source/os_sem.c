@@ -315,6 +315,9 @@ OS_EVENT  *OSSemDel (OS_EVENT  *pevent,
 *                            OS_ERR_PEND_LOCKED  If you called this function when the scheduler is locked
 *
 * Returns    : none
+*
+* Note(s)    : 1) When OS_SEM_FAST_EN is set to 1 and the semaphore is positive, the count is decremented
+*                 with OS_CPU_CAS16() and interrupts are not disabled.
 *********************************************************************************************************
 */
 
@@ -322,6 +325,9 @@ void  OSSemPend (OS_EVENT  *pevent,
                  INT32U     timeout,
                  INT8U     *perr)
 {
+#if OS_SEM_FAST_EN > 0u
+    INT16U     cnt;
+#endif
 #if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
     OS_CPU_SR  cpu_sr = 0u;
 #endif
@@ -358,6 +364,17 @@ void  OSSemPend (OS_EVENT  *pevent,
         OS_TRACE_SEM_PEND_EXIT(*perr);
         return;
     }
+#if OS_SEM_FAST_EN > 0u
+    cnt = pevent->OSEventCnt;
+    while (cnt > 0u) {                                /* Take a unit without disabling interrupts ...  */
+        if (OS_CPU_CAS16(&pevent->OSEventCnt, cnt, (INT16U)(cnt - 1u)) == OS_TRUE) {
+            *perr = OS_ERR_NONE;
+            OS_TRACE_SEM_PEND_EXIT(*perr);
+            return;
+        }
+        cnt = pevent->OSEventCnt;                     /* ... the count changed, try again              */
+    }
+#endif
     OS_ENTER_CRITICAL();
     if (pevent->OSEventCnt > 0u) {                    /* If sem. is positive, resource available ...   */
         pevent->OSEventCnt--;                         /* ... decrement semaphore only if positive.     */
@@ -370,6 +387,9 @@ void  OSSemPend (OS_EVENT  *pevent,
     OSTCBCur->OSTCBStat     |= OS_STAT_SEM;           /* Resource not available, pend on semaphore     */
     OSTCBCur->OSTCBStatPend  = OS_STAT_PEND_OK;
     OSTCBCur->OSTCBDly       = timeout;               /* Store pend timeout in TCB                     */
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListInsert(OSTCBCur);                      /* Add task to the list of delayed tasks         */
+#endif
     OS_EventTaskWait(pevent);                         /* Suspend task until event or timeout occurs    */
     OS_EXIT_CRITICAL();
     OS_Sched();                                       /* Find next highest priority task ready         */
@@ -507,11 +527,23 @@ INT8U  OSSemPendAbort (OS_EVENT  *pevent,
 *                                  OSSemAccept() or OSSemPend().
 *              OS_ERR_EVENT_TYPE   If you didn't pass a pointer to a semaphore
 *              OS_ERR_PEVENT_NULL  If 'pevent' is a NULL pointer.
+*              OS_ERR_INT_Q_FULL   If called from an ISR while the ring of deferred posts is full
+*
+* Note(s)    : 1) When OS_SEM_FAST_EN is set to 1 and no task waits for the semaphore, a post made by a
+*                 task increments the count with OS_CPU_CAS16() and interrupts are not disabled.  A task
+*                 may start waiting just before the count is incremented.  The poster sees it afterwards
+*                 and hands the unit over to the highest priority task waiting, like a regular post.
 *********************************************************************************************************
 */
 
 INT8U  OSSemPost (OS_EVENT *pevent)
 {
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    INT8U      err;
+#endif
+#if OS_SEM_FAST_EN > 0u
+    INT16U     cnt;
+#endif
 #if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
     OS_CPU_SR  cpu_sr = 0u;
 #endif
@@ -529,6 +561,38 @@ INT8U  OSSemPost (OS_EVENT *pevent)
         OS_TRACE_SEM_POST_EXIT(OS_ERR_EVENT_TYPE);
         return (OS_ERR_EVENT_TYPE);
     }
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNesting > 0u) {                          /* Defer the post when called from an ISR        */
+        err = OSIntQ_Post(OS_INT_Q_SEM_POST, (void *)pevent, (void *)0, 0u, OS_POST_OPT_NONE);
+        OS_TRACE_SEM_POST_EXIT(err);
+        return (err);
+    }
+#endif
+#if OS_SEM_FAST_EN > 0u
+    if (OSIntNesting == 0u) {                         /* ISRs always take the regular path             */
+        cnt = pevent->OSEventCnt;
+        while ((pevent->OSEventGrp == 0u) &&          /* No task waiting, add a unit without ...       */
+               (cnt < 65535u)) {                      /* ... disabling interrupts                      */
+            if (OS_CPU_CAS16(&pevent->OSEventCnt, cnt, (INT16U)(cnt + 1u)) == OS_TRUE) {
+                if (pevent->OSEventGrp != 0u) {       /* A task started waiting meanwhile (Note #1)    */
+                    OS_ENTER_CRITICAL();
+                    if ((pevent->OSEventCnt > 0u) &&
+                        (pevent->OSEventGrp != 0u)) { /* Give the unit to the HPT waiting instead      */
+                        pevent->OSEventCnt--;
+                        (void)OS_EventTaskRdy(pevent, (void *)0, OS_STAT_SEM, OS_STAT_PEND_OK);
+                        OS_EXIT_CRITICAL();
+                        OS_Sched();                   /* Find HPT ready to run                         */
+                    } else {
+                        OS_EXIT_CRITICAL();
+                    }
+                }
+                OS_TRACE_SEM_POST_EXIT(OS_ERR_NONE);
+                return (OS_ERR_NONE);
+            }
+            cnt = pevent->OSEventCnt;                 /* The count changed, try again                  */
+        }
+    }
+#endif
     OS_ENTER_CRITICAL();
     if (pevent->OSEventGrp != 0u) {                   /* See if any task waiting for semaphore         */
                                                       /* Ready HPT waiting on event                    */
@@ -34,6 +34,38 @@
 #include <ucos_ii.h>
 #endif
 
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*
+* Note(s) : (1) A task waiting for its own semaphore or message queue is marked OS_STAT_SEM or OS_STAT_Q,
+*               like a task waiting for a semaphore or a queue, but it isn't waiting for an event control
+*               block (nor for several of them).  OS_TASK_PEND_ON() tells the two cases apart.
+*********************************************************************************************************
+*/
+
+#if (OS_TASK_SEM_EN > 0u) || (OS_TASK_Q_EN > 0u)
+#if (OS_EVENT_EN)
+#define  OS_TASK_PEND_ON(ptcb, stat)  ((((ptcb)->OSTCBStat & ((stat) | OS_STAT_MULTI)) == (stat)) && \
+                                        ((ptcb)->OSTCBEventPtr == (OS_EVENT *)0))
+#else
+#define  OS_TASK_PEND_ON(ptcb, stat)   (((ptcb)->OSTCBStat & (stat)) != 0u)
+#endif
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          LOCAL PROTOTYPES
+*********************************************************************************************************
+*/
+
+#if (OS_TASK_SEM_EN > 0u) || (OS_TASK_Q_EN > 0u)
+static  OS_TCB  *OS_TaskPendTCB  (INT8U prio, INT8U stat);
+static  void     OS_TaskPendRdy  (OS_TCB *ptcb, INT8U stat);
+static  void     OS_TaskPendWait (INT8U stat, INT32U timeout);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -53,6 +85,10 @@
 *              OS_ERR_PRIO            there is no task with the specified OLD priority (i.e. the OLD task does
 *                                     not exist.
 *              OS_ERR_TASK_NOT_EXIST  if the task is assigned to a Mutex PIP.
+*
+* Note(s)    : 1) When OS_MUTEX_INHERIT_EN is set to 1, 'newprio' is the priority of the task without
+*                 inheritance.  A task that inherited a higher priority from the tasks waiting for the
+*                 mutexes it owns keeps running at that priority until it releases them.
 *********************************************************************************************************
 */
 
@@ -60,20 +96,7 @@
 INT8U  OSTaskChangePrio (INT8U  oldprio,
                          INT8U  newprio)
 {
-#if (OS_EVENT_EN)
-    OS_EVENT  *pevent;
-#if (OS_EVENT_MULTI_EN > 0u)
-    OS_EVENT **pevents;
-#endif
-#endif
     OS_TCB    *ptcb;
-    INT8U      y_new;
-    INT8U      x_new;
-    INT8U      y_old;
-    OS_PRIO    bity_new;
-    OS_PRIO    bitx_new;
-    OS_PRIO    bity_old;
-    OS_PRIO    bitx_old;
 #if OS_CRITICAL_METHOD == 3u
     OS_CPU_SR  cpu_sr = 0u;                                 /* Storage for CPU status register         */
 #endif
@@ -90,14 +113,26 @@ INT8U  OSTaskChangePrio (INT8U  oldprio,
     }
 #endif
     OS_ENTER_CRITICAL();
+#if OS_SCHED_RR_EN > 0u
+    if (OSTCBPrioTbl[newprio] == OS_TCB_RESERVED) {         /* New priority must not be reserved       */
+#else
     if (OSTCBPrioTbl[newprio] != (OS_TCB *)0) {             /* New priority must not already exist     */
+#endif
         OS_EXIT_CRITICAL();
         return (OS_ERR_PRIO_EXIST);
     }
+#if OS_SCHED_RR_EN > 0u
+    if (oldprio == OS_PRIO_SELF) {                          /* See if changing self                    */
+        ptcb = OSTCBCur;                                    /* Yes, other tasks may share its priority */
+    } else {
+        ptcb = OSTCBPrioTbl[oldprio];
+    }
+#else
     if (oldprio == OS_PRIO_SELF) {                          /* See if changing self                    */
         oldprio = OSTCBCur->OSTCBPrio;                      /* Yes, get priority                       */
     }
     ptcb = OSTCBPrioTbl[oldprio];
+#endif
     if (ptcb == (OS_TCB *)0) {                              /* Does task to change exist?              */
         OS_EXIT_CRITICAL();                                 /* No, can't change its priority!          */
         return (OS_ERR_PRIO);
@@ -106,64 +141,12 @@ INT8U  OSTaskChangePrio (INT8U  oldprio,
         OS_EXIT_CRITICAL();                                 /* No, can't change its priority!          */
         return (OS_ERR_TASK_NOT_EXIST);
     }
-#if OS_LOWEST_PRIO <= 63u
-    y_new                 = (INT8U)(newprio >> 3u);         /* Yes, compute new TCB fields             */
-    x_new                 = (INT8U)(newprio & 0x07u);
+#if (OS_MUTEX_EN > 0u) && (OS_MUTEX_INHERIT_EN > 0u)
+    ptcb->OSTCBBasePrio = newprio;                          /* Priority without inheritance            */
+    OSMutex_InheritChain(ptcb);                             /* See Note #1                             */
 #else
-    y_new                 = (INT8U)((INT8U)(newprio >> 4u) & 0x0Fu);
-    x_new                 = (INT8U)(newprio & 0x0Fu);
-#endif
-    bity_new              = (OS_PRIO)(1uL << y_new);
-    bitx_new              = (OS_PRIO)(1uL << x_new);
-
-    OSTCBPrioTbl[oldprio] = (OS_TCB *)0;                    /* Remove TCB from old priority            */
-    OSTCBPrioTbl[newprio] =  ptcb;                          /* Place pointer to TCB @ new priority     */
-    y_old                 =  ptcb->OSTCBY;
-    bity_old              =  ptcb->OSTCBBitY;
-    bitx_old              =  ptcb->OSTCBBitX;
-    if ((OSRdyTbl[y_old] &   bitx_old) != 0u) {             /* If task is ready make it not            */
-         OSRdyTbl[y_old] &= (OS_PRIO)~bitx_old;
-         if (OSRdyTbl[y_old] == 0u) {
-             OSRdyGrp &= (OS_PRIO)~bity_old;
-         }
-         OSRdyGrp        |= bity_new;                       /* Make new priority ready to run          */
-         OSRdyTbl[y_new] |= bitx_new;
-         OS_TRACE_TASK_READY(ptcb);
-    }
-
-#if (OS_EVENT_EN)
-    pevent = ptcb->OSTCBEventPtr;
-    if (pevent != (OS_EVENT *)0) {
-        pevent->OSEventTbl[y_old] &= (OS_PRIO)~bitx_old;    /* Remove old task prio from wait list     */
-        if (pevent->OSEventTbl[y_old] == 0u) {
-            pevent->OSEventGrp    &= (OS_PRIO)~bity_old;
-        }
-        pevent->OSEventGrp        |= bity_new;              /* Add    new task prio to   wait list     */
-        pevent->OSEventTbl[y_new] |= bitx_new;
-    }
-#if (OS_EVENT_MULTI_EN > 0u)
-    if (ptcb->OSTCBEventMultiPtr != (OS_EVENT **)0) {
-        pevents =  ptcb->OSTCBEventMultiPtr;
-        pevent  = *pevents;
-        while (pevent != (OS_EVENT *)0) {
-            pevent->OSEventTbl[y_old] &= (OS_PRIO)~bitx_old;   /* Remove old task prio from wait lists */
-            if (pevent->OSEventTbl[y_old] == 0u) {
-                pevent->OSEventGrp    &= (OS_PRIO)~bity_old;
-            }
-            pevent->OSEventGrp        |= bity_new;          /* Add    new task prio to   wait lists    */
-            pevent->OSEventTbl[y_new] |= bitx_new;
-            pevents++;
-            pevent                     = *pevents;
-        }
-    }
-#endif
+    OS_TCBPrioSet(ptcb, newprio);                           /* Move the task to its new priority       */
 #endif
-
-    ptcb->OSTCBPrio = newprio;                              /* Set new task priority                   */
-    ptcb->OSTCBY    = y_new;
-    ptcb->OSTCBX    = x_new;
-    ptcb->OSTCBBitY = bity_new;
-    ptcb->OSTCBBitX = bitx_new;
     OS_EXIT_CRITICAL();
     if (OSRunning == OS_TRUE) {
         OS_Sched();                                         /* Find new highest priority task          */
@@ -202,7 +185,9 @@ INT8U  OSTaskChangePrio (INT8U  oldprio,
 *                       memory locations.
 *
 *              prio     is the task's priority.  A unique priority MUST be assigned to each task and the
-*                       lower the number, the higher the priority.
+*                       lower the number, the higher the priority.  When OS_SCHED_RR_EN is set to 1,
+*                       several tasks can share a priority (except the priority of the idle task) and
+*                       run in turn (see OSSchedRoundRobinCfg()).
 *
 * Returns    : OS_ERR_NONE                     if the function was successful.
 *              OS_ERR_PRIO_EXIST               if the task priority already exist
@@ -265,6 +250,21 @@ INT8U  OSTaskCreate (void   (*task)(void *p_arg),
         }
         return (err);
     }
+#if OS_SCHED_RR_EN > 0u
+    if ((OSTCBPrioTbl[prio] != OS_TCB_RESERVED) &&  /* Share the priority unless it is reserved ...    */
+        (prio != OS_TASK_IDLE_PRIO)) {               /* ... or it is the one of the idle task          */
+        OS_EXIT_CRITICAL();
+        psp = OSTaskStkInit(task, p_arg, ptos, 0u);             /* Initialize the task's stack         */
+        err = OS_TCBInit(prio, psp, (OS_STK *)0, 0u, 0u, (void *)0, 0u);
+        if (err == OS_ERR_NONE) {
+            OS_TRACE_TASK_CREATE(OSTCBPrioTbl[prio]->OSTCBPrioPrev);
+            if (OSRunning == OS_TRUE) {      /* Find highest priority task if multitasking has started */
+                OS_Sched();
+            }
+        }
+        return (err);
+    }
+#endif
     OS_EXIT_CRITICAL();
     return (OS_ERR_PRIO_EXIST);
 }
@@ -301,7 +301,9 @@ INT8U  OSTaskCreate (void   (*task)(void *p_arg),
 *                        memory locations.  'ptos' MUST point to a valid 'free' data item.
 *
 *              prio      is the task's priority.  A unique priority MUST be assigned to each task and the
-*                        lower the number, the higher the priority.
+*                        lower the number, the higher the priority.  When OS_SCHED_RR_EN is set to 1,
+*                        several tasks can share a priority (except the priority of the idle task) and
+*                        run in turn (see OSSchedRoundRobinCfg()).
 *
 *              id        is the task's ID (0..65535)
 *
@@ -402,6 +404,26 @@ INT8U  OSTaskCreateExt (void   (*task)(void *p_arg),
         }
         return (err);
     }
+#if OS_SCHED_RR_EN > 0u
+    if ((OSTCBPrioTbl[prio] != OS_TCB_RESERVED) &&  /* Share the priority unless it is reserved ...    */
+        (prio != OS_TASK_IDLE_PRIO)) {               /* ... or it is the one of the idle task          */
+        OS_EXIT_CRITICAL();
+
+#if (OS_TASK_STAT_STK_CHK_EN > 0u)
+        OS_TaskStkClr(pbos, stk_size, opt);                    /* Clear the task stack (if needed)     */
+#endif
+
+        psp = OSTaskStkInit(task, p_arg, ptos, opt);           /* Initialize the task's stack          */
+        err = OS_TCBInit(prio, psp, pbos, id, stk_size, pext, opt);
+        if (err == OS_ERR_NONE) {
+            OS_TRACE_TASK_CREATE(OSTCBPrioTbl[prio]->OSTCBPrioPrev);
+            if (OSRunning == OS_TRUE) {                        /* Find HPT if multitasking has started */
+                OS_Sched();
+            }
+        }
+        return (err);
+    }
+#endif
     OS_EXIT_CRITICAL();
     return (OS_ERR_PRIO_EXIST);
 }
@@ -432,7 +454,9 @@ INT8U  OSTaskCreateExt (void   (*task)(void *p_arg),
 *
 * Notes      : 1) To reduce interrupt latency, OSTaskDel() 'disables' the task:
 *                    a) by making it not ready
-*                    b) by removing it from any wait lists
+*                    b) by removing it from any wait lists.  The owner of a mutex created with
+*                       OS_PRIO_MUTEX_INHERIT that the task waits for drops the priority it inherited
+*                       from the task.
 *                    c) by preventing OSTimeTick() from making the task ready to run.
 *                 The task can then be 'unlinked' from the miscellaneous structures in uC/OS-II.
 *              2) The function OS_Dummy() is called after OS_EXIT_CRITICAL() because, on most processors,
@@ -453,6 +477,10 @@ INT8U  OSTaskDel (INT8U prio)
     OS_FLAG_NODE *pnode;
 #endif
     OS_TCB       *ptcb;
+#if (OS_MUTEX_EN > 0u) && (OS_MUTEX_INHERIT_EN > 0u)
+    OS_EVENT     *pevent;
+    OS_TCB       *powner;
+#endif
 #if OS_CRITICAL_METHOD == 3u                            /* Allocate storage for CPU status register    */
     OS_CPU_SR     cpu_sr = 0u;
 #endif
@@ -481,10 +509,18 @@ INT8U  OSTaskDel (INT8U prio)
 #endif
 
     OS_ENTER_CRITICAL();
+#if OS_SCHED_RR_EN > 0u
+    if (prio == OS_PRIO_SELF) {                         /* See if requesting to delete self            */
+        ptcb = OSTCBCur;                                /* Other tasks may share its priority          */
+    } else {
+        ptcb = OSTCBPrioTbl[prio];
+    }
+#else
     if (prio == OS_PRIO_SELF) {                         /* See if requesting to delete self            */
         prio = OSTCBCur->OSTCBPrio;                     /* Set priority to delete to current           */
     }
     ptcb = OSTCBPrioTbl[prio];
+#endif
     if (ptcb == (OS_TCB *)0) {                          /* Task to delete must exist                   */
         OS_EXIT_CRITICAL();
         return (OS_ERR_TASK_NOT_EXIST);
@@ -494,15 +530,34 @@ INT8U  OSTaskDel (INT8U prio)
         return (OS_ERR_TASK_DEL);
     }
 
+#if OS_SCHED_RR_EN > 0u
+    OS_SchedRRRemove(ptcb);                             /* Remove from the tasks at its priority       */
+#endif
     OSRdyTbl[ptcb->OSTCBY] &= (OS_PRIO)~ptcb->OSTCBBitX;
     OS_TRACE_TASK_SUSPENDED(ptcb);
     if (OSRdyTbl[ptcb->OSTCBY] == 0u) {                 /* Make task not ready                         */
         OSRdyGrp           &= (OS_PRIO)~ptcb->OSTCBBitY;
     }
+#if OS_SCHED_RR_EN > 0u
+    OS_SchedRRRdyRestore(ptcb);                         /* Other tasks at its priority may be ready    */
+#endif
 
 #if (OS_EVENT_EN)
     if (ptcb->OSTCBEventPtr != (OS_EVENT *)0) {
+#if (OS_MUTEX_EN > 0u) && (OS_MUTEX_INHERIT_EN > 0u)
+        pevent = ptcb->OSTCBEventPtr;
+        powner = (OS_TCB *)0;
+        if ((pevent->OSEventType == OS_EVENT_TYPE_MUTEX) &&   /* See if owner inherits our priority    */
+            ((INT8U)(pevent->OSEventCnt >> 8u) == OS_PRIO_MUTEX_INHERIT)) {
+            powner = (OS_TCB *)pevent->OSEventPtr;
+        }
+        OS_EventTaskRemove(ptcb, pevent);               /* Remove this task from any event   wait list */
+        if (powner != (OS_TCB *)0) {                    /* Owner no longer inherits our priority       */
+            OSMutex_InheritChain(powner);
+        }
+#else
         OS_EventTaskRemove(ptcb, ptcb->OSTCBEventPtr);  /* Remove this task from any event   wait list */
+#endif
     }
 #if (OS_EVENT_MULTI_EN > 0u)
     if (ptcb->OSTCBEventMultiPtr != (OS_EVENT **)0) {   /* Remove this task from any events' wait lists*/
@@ -518,17 +573,26 @@ INT8U  OSTaskDel (INT8U prio)
     }
 #endif
 
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListRemove(ptcb);                            /* Remove task from list of delayed tasks      */
+#endif
     ptcb->OSTCBDly      = 0u;                           /* Prevent OSTimeTick() from updating          */
     ptcb->OSTCBStat     = OS_STAT_RDY;                  /* Prevent task from being resumed             */
     ptcb->OSTCBStatPend = OS_STAT_PEND_OK;
     if (OSLockNesting < 255u) {                         /* Make sure we don't context switch           */
         OSLockNesting++;
+#if OS_INT_DIS_MEAS_EN > 0u
+        OS_SchedLockMeasStart();
+#endif
     }
     OS_EXIT_CRITICAL();                                 /* Enabling INT. ignores next instruc.         */
     OS_Dummy();                                         /* ... Dummy ensures that INTs will be         */
     OS_ENTER_CRITICAL();                                /* ... disabled HERE!                          */
     if (OSLockNesting > 0u) {                           /* Remove context switch lock                  */
         OSLockNesting--;
+#if OS_INT_DIS_MEAS_EN > 0u
+        OS_SchedLockMeasStop();
+#endif
     }
     OSTaskDelHook(ptcb);                                /* Call user defined hook                      */
 
@@ -539,7 +603,9 @@ INT8U  OSTaskDel (INT8U prio)
 #endif
 
     OSTaskCtr--;                                        /* One less task being managed                 */
+#if OS_SCHED_RR_EN == 0u
     OSTCBPrioTbl[prio] = (OS_TCB *)0;                   /* Clear old priority entry                    */
+#endif
     if (ptcb->OSTCBPrev == (OS_TCB *)0) {               /* Remove from TCB chain                       */
         ptcb->OSTCBNext->OSTCBPrev = (OS_TCB *)0;
         OSTCBList                  = ptcb->OSTCBNext;
@@ -721,10 +787,18 @@ INT8U  OSTaskNameGet (INT8U    prio,
         return (0u);
     }
     OS_ENTER_CRITICAL();
+#if OS_SCHED_RR_EN > 0u
+    if (prio == OS_PRIO_SELF) {                          /* See if caller desires it's own name        */
+        ptcb = OSTCBCur;                                 /* Other tasks may share its priority         */
+    } else {
+        ptcb = OSTCBPrioTbl[prio];
+    }
+#else
     if (prio == OS_PRIO_SELF) {                          /* See if caller desires it's own name        */
         prio = OSTCBCur->OSTCBPrio;
     }
     ptcb = OSTCBPrioTbl[prio];
+#endif
     if (ptcb == (OS_TCB *)0) {                           /* Does task exist?                           */
         OS_EXIT_CRITICAL();                              /* No                                         */
         *perr = OS_ERR_TASK_NOT_EXIST;
@@ -802,10 +876,18 @@ void  OSTaskNameSet (INT8U   prio,
         return;
     }
     OS_ENTER_CRITICAL();
+#if OS_SCHED_RR_EN > 0u
+    if (prio == OS_PRIO_SELF) {                      /* See if caller desires to set it's own name     */
+        ptcb = OSTCBCur;                             /* Other tasks may share its priority             */
+    } else {
+        ptcb = OSTCBPrioTbl[prio];
+    }
+#else
     if (prio == OS_PRIO_SELF) {                      /* See if caller desires to set it's own name     */
         prio = OSTCBCur->OSTCBPrio;
     }
     ptcb = OSTCBPrioTbl[prio];
+#endif
     if (ptcb == (OS_TCB *)0) {                       /* Does task exist?                               */
         OS_EXIT_CRITICAL();                          /* No                                             */
         *perr = OS_ERR_TASK_NOT_EXIST;
@@ -867,6 +949,12 @@ INT8U  OSTaskResume (INT8U prio)
         OS_EXIT_CRITICAL();
         return (OS_ERR_TASK_NOT_EXIST);
     }
+#if OS_SCHED_RR_EN > 0u
+    while ((ptcb->OSTCBPrioNext != (OS_TCB *)0) &&            /* Resume the first suspended task at ...*/
+           ((ptcb->OSTCBStat & OS_STAT_SUSPEND) == OS_STAT_RDY)) { /* ... this priority                */
+        ptcb = ptcb->OSTCBPrioNext;
+    }
+#endif
     if ((ptcb->OSTCBStat & OS_STAT_SUSPEND) != OS_STAT_RDY) { /* Task must be suspended                */
         ptcb->OSTCBStat &= (INT8U)~(INT8U)OS_STAT_SUSPEND;    /* Remove suspension                     */
         if ((ptcb->OSTCBStat & OS_STAT_PEND_ANY) == OS_STAT_RDY) { /* See if task is now ready         */
@@ -939,10 +1027,18 @@ INT8U  OSTaskStkChk (INT8U         prio,
     p_stk_data->OSFree = 0u;                           /* Assume failure, set to 0 size                */
     p_stk_data->OSUsed = 0u;
     OS_ENTER_CRITICAL();
+#if OS_SCHED_RR_EN > 0u
+    if (prio == OS_PRIO_SELF) {                        /* See if check for SELF                        */
+        ptcb = OSTCBCur;                               /* Other tasks may share its priority           */
+    } else {
+        ptcb = OSTCBPrioTbl[prio];
+    }
+#else
     if (prio == OS_PRIO_SELF) {                        /* See if check for SELF                        */
         prio = OSTCBCur->OSTCBPrio;
     }
     ptcb = OSTCBPrioTbl[prio];
+#endif
     if (ptcb == (OS_TCB *)0) {                         /* Make sure task exist                         */
         OS_EXIT_CRITICAL();
         return (OS_ERR_TASK_NOT_EXIST);
@@ -1021,6 +1117,13 @@ INT8U  OSTaskSuspend (INT8U prio)
     }
 #endif
     OS_ENTER_CRITICAL();
+#if OS_SCHED_RR_EN > 0u
+    if (prio == OS_PRIO_SELF) {                                 /* See if suspend SELF                 */
+        ptcb = OSTCBCur;                                        /* Other tasks may share its priority  */
+    } else {
+        ptcb = OSTCBPrioTbl[prio];
+    }
+#else
     if (prio == OS_PRIO_SELF) {                                 /* See if suspend SELF                 */
         prio = OSTCBCur->OSTCBPrio;
         self = OS_TRUE;
@@ -1030,6 +1133,7 @@ INT8U  OSTaskSuspend (INT8U prio)
         self = OS_FALSE;                                        /* No suspending another task          */
     }
     ptcb = OSTCBPrioTbl[prio];
+#endif
     if (ptcb == (OS_TCB *)0) {                                  /* Task to suspend must exist          */
         OS_EXIT_CRITICAL();
         return (OS_ERR_TASK_SUSPEND_PRIO);
@@ -1038,11 +1142,27 @@ INT8U  OSTaskSuspend (INT8U prio)
         OS_EXIT_CRITICAL();
         return (OS_ERR_TASK_NOT_EXIST);
     }
+#if OS_SCHED_RR_EN > 0u
+    if (prio != OS_PRIO_SELF) {                                 /* Suspend the first task at this ...  */
+        while ((ptcb->OSTCBPrioNext != (OS_TCB *)0) &&          /* ... priority not yet suspended      */
+               ((ptcb->OSTCBStat & OS_STAT_SUSPEND) != OS_STAT_RDY)) {
+            ptcb = ptcb->OSTCBPrioNext;
+        }
+    }
+    if (ptcb == OSTCBCur) {                                     /* See if suspending self              */
+        self = OS_TRUE;
+    } else {
+        self = OS_FALSE;                                        /* No suspending another task          */
+    }
+#endif
     y            = ptcb->OSTCBY;
     OSRdyTbl[y] &= (OS_PRIO)~ptcb->OSTCBBitX;                   /* Make task not ready                 */
     if (OSRdyTbl[y] == 0u) {
         OSRdyGrp &= (OS_PRIO)~ptcb->OSTCBBitY;
     }
+#if OS_SCHED_RR_EN > 0u
+    OS_SchedRRRdyRestore(ptcb);                                 /* Other tasks at its prio may be ready*/
+#endif
     ptcb->OSTCBStat |= OS_STAT_SUSPEND;                         /* Status of task is 'SUSPENDED'       */
     OS_EXIT_CRITICAL();
     OS_TRACE_TASK_SUSPEND(ptcb);
@@ -1096,10 +1216,18 @@ INT8U  OSTaskQuery (INT8U    prio,
     }
 #endif
     OS_ENTER_CRITICAL();
+#if OS_SCHED_RR_EN > 0u
+    if (prio == OS_PRIO_SELF) {                  /* See if suspend SELF                                */
+        ptcb = OSTCBCur;                         /* Other tasks may share its priority                 */
+    } else {
+        ptcb = OSTCBPrioTbl[prio];
+    }
+#else
     if (prio == OS_PRIO_SELF) {                  /* See if suspend SELF                                */
         prio = OSTCBCur->OSTCBPrio;
     }
     ptcb = OSTCBPrioTbl[prio];
+#endif
     if (ptcb == (OS_TCB *)0) {                   /* Task to query must exist                           */
         OS_EXIT_CRITICAL();
         return (OS_ERR_PRIO);
@@ -1116,6 +1244,166 @@ INT8U  OSTaskQuery (INT8U    prio,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                  PEND ON THE MESSAGE QUEUE OF THE TASK
+*
+* Description: This function waits for a message to be sent to the calling task with OSTaskQPost().
+*
+* Arguments  : timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will
+*                            wait for a message to arrive up to the amount of time specified by this
+*                            argument.  If you specify 0, however, your task will wait forever or, until
+*                            a message arrives.
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE         The call was successful and a message was received.
+*                            OS_ERR_TIMEOUT      No message was received within the specified 'timeout'.
+*                            OS_ERR_PEND_ISR     If you called this function from an ISR
+*                            OS_ERR_PEND_LOCKED  If you called this function with the scheduler is locked
+*
+* Returns    : != (void *)0  is a pointer to the message received
+*              == (void *)0  if you received a NULL pointer message or,
+*                            if no message was received or,
+*                            if you didn't pass a proper pointer to the error code.
+*
+* Note(s)    : 1) Each task has its own queue of OS_TASK_Q_SIZE messages in its OS_TCB.  Only the task
+*                 itself can pend on it, so no event control block is needed.
+*********************************************************************************************************
+*/
+
+#if OS_TASK_Q_EN > 0u
+void  *OSTaskQPend (INT32U   timeout,
+                    INT8U   *perr)
+{
+    OS_TCB    *ptcb;
+    void      *pmsg;
+    INT8U      pend_stat;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+    if (OSIntNesting > 0u) {                     /* See if called from ISR ...                         */
+        *perr = OS_ERR_PEND_ISR;                 /* ... can't PEND from an ISR                         */
+        return ((void *)0);
+    }
+    if (OSLockNesting > 0u) {                    /* See if called with scheduler locked ...            */
+        *perr = OS_ERR_PEND_LOCKED;              /* ... can't PEND when locked                         */
+        return ((void *)0);
+    }
+    OS_ENTER_CRITICAL();
+    ptcb = OSTCBCur;
+    if (ptcb->OSTCBQEntries == 0u) {             /* Wait for a message if the queue is empty           */
+        OS_TaskPendWait(OS_STAT_Q, timeout);
+        OS_EXIT_CRITICAL();
+        OS_Sched();                              /* Find next highest priority task ready to run       */
+        OS_ENTER_CRITICAL();
+        pend_stat           = ptcb->OSTCBStatPend;
+        ptcb->OSTCBStat     = OS_STAT_RDY;       /* Set   task  status to ready                        */
+        ptcb->OSTCBStatPend = OS_STAT_PEND_OK;   /* Clear pend  status                                 */
+        if (pend_stat != OS_STAT_PEND_OK) {      /* See if we timed-out                                */
+            OS_EXIT_CRITICAL();
+            *perr = OS_ERR_TIMEOUT;
+            return ((void *)0);
+        }
+    }
+    pmsg = ptcb->OSTCBQTbl[ptcb->OSTCBQOut];     /* Extract oldest message from the queue              */
+    ptcb->OSTCBQOut++;
+    if (ptcb->OSTCBQOut == OS_TASK_Q_SIZE) {     /* Wrap OUT index if we are past the end of the queue */
+        ptcb->OSTCBQOut = 0u;
+    }
+    ptcb->OSTCBQEntries--;
+    OS_EXIT_CRITICAL();
+    *perr = OS_ERR_NONE;
+    return (pmsg);                               /* Return message received                            */
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  POST TO THE MESSAGE QUEUE OF A TASK
+*
+* Description: This function sends a message to the queue of a task.  If the task is waiting for a
+*              message, it is made ready to run directly: there is no wait list to search.
+*
+* Arguments  : prio          is the priority of the task to send the message to.  When OS_SCHED_RR_EN
+*                            is set to 1, the message goes to the first task at 'prio' waiting for one,
+*                            or to the first task at 'prio' if none is waiting.
+*
+*              pmsg          is a pointer to the message to send.
+*
+* Returns    : OS_ERR_NONE            The call was successful and the message was sent
+*              OS_ERR_PRIO_INVALID    If the priority you specify is higher that the maximum allowed
+*                                     (i.e. >= OS_LOWEST_PRIO)
+*              OS_ERR_TASK_NOT_EXIST  If the task doesn't exist or, is assigned to a Mutex PIP
+*              OS_ERR_Q_FULL          If the queue of the task can't accept any more messages
+*              OS_ERR_INT_Q_FULL      If called from an ISR and the ring of deferred ISR posts is full
+*
+* Note(s)    : 1) This function can be called from an ISR.  When OS_ISR_POST_DEFERRED_EN is set to 1, the
+*                 post is deferred like OSQPost() and a full queue isn't reported to the ISR.
+*********************************************************************************************************
+*/
+
+#if OS_TASK_Q_EN > 0u
+INT8U  OSTaskQPost (INT8U   prio,
+                    void   *pmsg)
+{
+    OS_TCB    *ptcb;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#if OS_ARG_CHK_EN > 0u
+    if (prio >= OS_LOWEST_PRIO) {                /* Make sure task priority is valid                   */
+        return (OS_ERR_PRIO_INVALID);
+    }
+#endif
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNesting > 0u) {                     /* Defer the post when called from an ISR             */
+        return (OSIntQ_Post(OS_INT_Q_TASK_Q_POST, (void *)0, pmsg, 0u, prio));
+    }
+#endif
+    OS_ENTER_CRITICAL();
+    ptcb = OS_TaskPendTCB(prio, OS_STAT_Q);
+    if (ptcb == (OS_TCB *)0) {                   /* Task must exist and not be assigned to a Mutex     */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_TASK_NOT_EXIST);
+    }
+    if (ptcb->OSTCBQEntries >= OS_TASK_Q_SIZE) { /* Make sure queue is not full                        */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_Q_FULL);
+    }
+    ptcb->OSTCBQTbl[ptcb->OSTCBQIn] = pmsg;      /* Insert message into queue                          */
+    ptcb->OSTCBQIn++;
+    if (ptcb->OSTCBQIn == OS_TASK_Q_SIZE) {      /* Wrap IN index if we are past the end of the queue  */
+        ptcb->OSTCBQIn = 0u;
+    }
+    ptcb->OSTCBQEntries++;
+    if (OS_TASK_PEND_ON(ptcb, OS_STAT_Q)) {      /* See if the task is waiting for a message           */
+        OS_TaskPendRdy(ptcb, OS_STAT_Q);         /* Yes, make it ready to run                          */
+        OS_EXIT_CRITICAL();
+        OS_Sched();                              /* Find highest priority task ready to run            */
+        return (OS_ERR_NONE);
+    }
+    OS_EXIT_CRITICAL();
+    return (OS_ERR_NONE);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                              GET THE CURRENT VALUE OF A TASK REGISTER
@@ -1309,6 +1597,229 @@ void  OSTaskRegSet (INT8U    prio,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                   PEND ON THE SEMAPHORE OF THE TASK
+*
+* Description: This function waits for the calling task to be signaled with OSTaskSemPost().
+*
+* Arguments  : timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will
+*                            wait for the semaphore up to the amount of time specified by this argument.
+*                            If you specify 0, however, your task will wait forever or, until it is
+*                            signaled.
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE         The call was successful and your task was signaled.
+*                            OS_ERR_TIMEOUT      Not signaled within the specified 'timeout'.
+*                            OS_ERR_PEND_ISR     If you called this function from an ISR
+*                            OS_ERR_PEND_LOCKED  If you called this function with the scheduler is locked
+*
+* Returns    : The number of signals still counted by the semaphore of the task.
+*
+* Note(s)    : 1) The semaphore count of each task is kept in its OS_TCB.  Only the task itself can pend
+*                 on it, so no event control block is needed.
+*********************************************************************************************************
+*/
+
+#if OS_TASK_SEM_EN > 0u
+INT16U  OSTaskSemPend (INT32U   timeout,
+                       INT8U   *perr)
+{
+    OS_TCB    *ptcb;
+    INT16U     ctr;
+    INT8U      pend_stat;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+    if (OSIntNesting > 0u) {                     /* See if called from ISR ...                         */
+        *perr = OS_ERR_PEND_ISR;                 /* ... can't PEND from an ISR                         */
+        return (0u);
+    }
+    if (OSLockNesting > 0u) {                    /* See if called with scheduler locked ...            */
+        *perr = OS_ERR_PEND_LOCKED;              /* ... can't PEND when locked                         */
+        return (0u);
+    }
+    OS_ENTER_CRITICAL();
+    ptcb = OSTCBCur;
+    if (ptcb->OSTCBSemCtr > 0u) {                /* If sem. is positive, resource available ...        */
+        ptcb->OSTCBSemCtr--;                     /* ... decrement semaphore only if positive.          */
+        ctr = ptcb->OSTCBSemCtr;
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_NONE;
+        return (ctr);
+    }
+    OS_TaskPendWait(OS_STAT_SEM, timeout);       /* Otherwise, must wait until signaled                */
+    OS_EXIT_CRITICAL();
+    OS_Sched();                                  /* Find next highest priority task ready to run       */
+    OS_ENTER_CRITICAL();
+    pend_stat           = ptcb->OSTCBStatPend;
+    ptcb->OSTCBStat     = OS_STAT_RDY;           /* Set   task  status to ready                        */
+    ptcb->OSTCBStatPend = OS_STAT_PEND_OK;       /* Clear pend  status                                 */
+    ctr                 = ptcb->OSTCBSemCtr;
+    OS_EXIT_CRITICAL();
+    if (pend_stat != OS_STAT_PEND_OK) {          /* See if we timed-out                                */
+        *perr = OS_ERR_TIMEOUT;
+    } else {
+        *perr = OS_ERR_NONE;
+    }
+    return (ctr);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    POST TO THE SEMAPHORE OF A TASK
+*
+* Description: This function signals a task.  If the task is waiting for its semaphore, it is made ready
+*              to run directly: there is no wait list to search.  Otherwise, the signal is counted.
+*
+* Arguments  : prio          is the priority of the task to signal.  When OS_SCHED_RR_EN is set to 1,
+*                            the first task at 'prio' waiting for its semaphore is signaled, or the
+*                            first task at 'prio' if none is waiting.
+*
+* Returns    : OS_ERR_NONE            The call was successful and the task was signaled
+*              OS_ERR_PRIO_INVALID    If the priority you specify is higher that the maximum allowed
+*                                     (i.e. >= OS_LOWEST_PRIO)
+*              OS_ERR_TASK_NOT_EXIST  If the task doesn't exist or, is assigned to a Mutex PIP
+*              OS_ERR_SEM_OVF         If the semaphore count exceeded its limit
+*              OS_ERR_INT_Q_FULL      If called from an ISR and the ring of deferred ISR posts is full
+*
+* Note(s)    : 1) This function can be called from an ISR.  When OS_ISR_POST_DEFERRED_EN is set to 1, the
+*                 post is deferred like OSSemPost().
+*********************************************************************************************************
+*/
+
+#if OS_TASK_SEM_EN > 0u
+INT8U  OSTaskSemPost (INT8U  prio)
+{
+    OS_TCB    *ptcb;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#if OS_ARG_CHK_EN > 0u
+    if (prio >= OS_LOWEST_PRIO) {                /* Make sure task priority is valid                   */
+        return (OS_ERR_PRIO_INVALID);
+    }
+#endif
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNesting > 0u) {                     /* Defer the post when called from an ISR             */
+        return (OSIntQ_Post(OS_INT_Q_TASK_SEM_POST, (void *)0, (void *)0, 0u, prio));
+    }
+#endif
+    OS_ENTER_CRITICAL();
+    ptcb = OS_TaskPendTCB(prio, OS_STAT_SEM);
+    if (ptcb == (OS_TCB *)0) {                   /* Task must exist and not be assigned to a Mutex     */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_TASK_NOT_EXIST);
+    }
+    if (OS_TASK_PEND_ON(ptcb, OS_STAT_SEM)) {    /* See if the task is waiting for its semaphore       */
+        OS_TaskPendRdy(ptcb, OS_STAT_SEM);       /* Yes, make it ready to run                          */
+        OS_EXIT_CRITICAL();
+        OS_Sched();                              /* Find highest priority task ready to run            */
+        return (OS_ERR_NONE);
+    }
+    if (ptcb->OSTCBSemCtr < 65535u) {            /* Make sure semaphore will not overflow              */
+        ptcb->OSTCBSemCtr++;                     /* Increment semaphore count to register event        */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_NONE);
+    }
+    OS_EXIT_CRITICAL();                          /* Semaphore value has reached its maximum            */
+    return (OS_ERR_SEM_OVF);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  SET THE TIME QUANTA OF A TASK
+*
+* Description: This function is called to change the number of ticks a task runs before the next ready
+*              task at the same priority is given the CPU (see OSSchedRoundRobinCfg()).
+*
+* Arguments  : prio         is the priority of the task.  If you specify OS_PRIO_SELF then the time
+*                           quanta of the current task is changed.  Otherwise, the first task created
+*                           at 'prio' is changed.
+*
+*              time_quanta  is the desired time quanta, in ticks.  0 selects the default time quanta.
+*
+*              perr         is a pointer to a variable that will hold an error code related to this call.
+*
+*                           OS_ERR_NONE            if the call was successful
+*                           OS_ERR_PRIO_INVALID    if you specified an invalid priority
+*                           OS_ERR_TASK_NOT_EXIST  if the task doesn't exist or, is assigned to a Mutex PIP
+*
+* Returns    : none
+*
+* Note(s)    : 1) The current time quanta of the task is restarted with the new value.
+*********************************************************************************************************
+*/
+
+#if OS_SCHED_RR_EN > 0u
+void  OSTaskTimeQuantaSet (INT8U    prio,
+                           INT32U   time_quanta,
+                           INT8U   *perr)
+{
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+    OS_TCB    *ptcb;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (prio >= OS_LOWEST_PRIO) {
+        if (prio != OS_PRIO_SELF) {
+            *perr = OS_ERR_PRIO_INVALID;
+            return;
+        }
+    }
+#endif
+    OS_ENTER_CRITICAL();
+    if (prio == OS_PRIO_SELF) {                  /* See if changing the current task                   */
+        ptcb = OSTCBCur;
+    } else {
+        ptcb = OSTCBPrioTbl[prio];
+    }
+    if ((ptcb == (OS_TCB *)0) ||                 /* Task must exist and not be assigned to a Mutex     */
+        (ptcb == OS_TCB_RESERVED)) {
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_TASK_NOT_EXIST;
+        return;
+    }
+    ptcb->OSTCBTimeQuanta = time_quanta;
+    if (time_quanta == 0u) {                     /* Restart the current time quanta                    */
+        ptcb->OSTCBTimeQuantaCtr = OSSchedRRDfltTimeQuanta;
+    } else {
+        ptcb->OSTCBTimeQuantaCtr = time_quanta;
+    }
+    OS_EXIT_CRITICAL();
+    *perr = OS_ERR_NONE;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                    CATCH ACCIDENTAL TASK RETURN
@@ -1382,5 +1893,109 @@ void  OS_TaskStkClr (OS_STK  *pbos,
     }
 }
 
+#endif
+
+/*
+*********************************************************************************************************
+*                               TASK SEMAPHORE AND MESSAGE QUEUE SUPPORT
+*
+* Description: These functions are called by OSTaskSemPend(), OSTaskSemPost(), OSTaskQPend() and
+*              OSTaskQPost().
+*
+*              OS_TaskPendTCB()   returns the TCB of the task at 'prio' to post to, or a NULL pointer if
+*                                 there is no such task.  When OS_SCHED_RR_EN is set to 1, the first task
+*                                 at 'prio' waiting with status 'stat' is preferred.
+*
+*              OS_TaskPendRdy()   makes 'ptcb' ready to run (unless it is suspended) after it got what it
+*                                 was waiting for.
+*
+*              OS_TaskPendWait()  makes the current task wait, with status 'stat', until it is readied by
+*                                 OS_TaskPendRdy() or 'timeout' expires.
+*
+* Arguments  : prio      is the priority of the task to post to.
+*
+*              ptcb      is a pointer to the TCB of the task to ready.
+*
+*              stat      is OS_STAT_SEM for the task semaphore or OS_STAT_Q for the task message queue.
+*
+*              timeout   is the number of ticks to wait (0 waits forever).
+*
+* Note(s)    : 1) These functions assume that interrupts are disabled.
+*              2) Unlike OS_EventTaskRdy(), OS_TaskPendRdy() has no wait list to search: the post names
+*                 the task to ready.
+*********************************************************************************************************
+*/
+
+#if (OS_TASK_SEM_EN > 0u) || (OS_TASK_Q_EN > 0u)
+static  OS_TCB  *OS_TaskPendTCB (INT8U  prio,
+                                 INT8U  stat)
+{
+    OS_TCB  *ptcb;
+#if OS_SCHED_RR_EN > 0u
+    OS_TCB  *pwait;
+#endif
+
+
+    ptcb = OSTCBPrioTbl[prio];
+    if ((ptcb == (OS_TCB *)0) ||                 /* Task must exist and not be assigned to a Mutex     */
+        (ptcb == OS_TCB_RESERVED)) {
+        return ((OS_TCB *)0);
+    }
+#if OS_SCHED_RR_EN > 0u
+    pwait = ptcb;                                /* Look for the first waiting task at this priority   */
+    while ((pwait != (OS_TCB *)0) &&
+           (!OS_TASK_PEND_ON(pwait, stat))) {
+        pwait = pwait->OSTCBPrioNext;
+    }
+    if (pwait != (OS_TCB *)0) {
+        ptcb = pwait;
+    }
+#else
+    stat = stat;                                 /* Prevent compiler warning if not used               */
+#endif
+    return (ptcb);
+}
+
+
+static  void  OS_TaskPendRdy (OS_TCB  *ptcb,
+                              INT8U    stat)
+{
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListRemove(ptcb);                     /* Remove task from list of delayed tasks             */
+#endif
+    ptcb->OSTCBDly       =  0u;                  /* Prevent OSTimeTick() from readying task            */
+    ptcb->OSTCBStat     &= (INT8U)~stat;         /* Clear bit associated with the wait                 */
+    ptcb->OSTCBStatPend  =  OS_STAT_PEND_OK;
+                                                 /* See if task is ready (could be susp'd)             */
+    if ((ptcb->OSTCBStat & OS_STAT_SUSPEND) == OS_STAT_RDY) {
+        OSRdyGrp               |= ptcb->OSTCBBitY;   /* Put task in the ready to run list              */
+        OSRdyTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+        OS_TRACE_TASK_READY(ptcb);
+    }
+}
+
+
+static  void  OS_TaskPendWait (INT8U   stat,
+                               INT32U  timeout)
+{
+    INT8U  y;
+
+
+    OSTCBCur->OSTCBStat     |= stat;             /* Task will have to pend                             */
+    OSTCBCur->OSTCBStatPend  = OS_STAT_PEND_OK;
+    OSTCBCur->OSTCBDly       = timeout;          /* Load timeout in TCB                                */
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListInsert(OSTCBCur);                 /* Add task to the list of delayed tasks              */
+#endif
+    y             =  OSTCBCur->OSTCBY;           /* Task no longer ready                               */
+    OSRdyTbl[y]  &= (OS_PRIO)~OSTCBCur->OSTCBBitX;
+    OS_TRACE_TASK_SUSPENDED(OSTCBCur);
+    if (OSRdyTbl[y] == 0u) {
+        OSRdyGrp &= (OS_PRIO)~OSTCBCur->OSTCBBitY;
+    }
+#if OS_SCHED_RR_EN > 0u
+    OS_SchedRRRdyRestore(OSTCBCur);              /* Other tasks at this priority may still be ready    */
+#endif
+}
 #endif
 #endif                                                 /* OS_TASK_C                                    */
@@ -73,7 +73,13 @@ void  OSTimeDly (INT32U ticks)
         if (OSRdyTbl[y] == 0u) {
             OSRdyGrp &= (OS_PRIO)~OSTCBCur->OSTCBBitY;
         }
+#if OS_SCHED_RR_EN > 0u
+        OS_SchedRRRdyRestore(OSTCBCur);          /* Other tasks at this priority may still be ready    */
+#endif
         OSTCBCur->OSTCBDly = ticks;              /* Load ticks in TCB                                  */
+#if OS_TICK_LIST_EN > 0u
+        OS_TickListInsert(OSTCBCur);             /* Add task to the list of delayed tasks              */
+#endif
         OS_TRACE_TASK_DLY(ticks);
         OS_EXIT_CRITICAL();
         OS_Sched();                              /* Find next task to run!                             */
@@ -194,11 +200,20 @@ INT8U  OSTimeDlyResume (INT8U prio)
         OS_EXIT_CRITICAL();
         return (OS_ERR_TASK_NOT_EXIST);                        /* The task does not exist              */
     }
+#if OS_SCHED_RR_EN > 0u
+    while ((ptcb->OSTCBPrioNext != (OS_TCB *)0) &&             /* Resume the first delayed task at ... */
+           (ptcb->OSTCBDly      == 0u)) {                      /* ... this priority                    */
+        ptcb = ptcb->OSTCBPrioNext;
+    }
+#endif
     if (ptcb->OSTCBDly == 0u) {                                /* See if task is delayed               */
         OS_EXIT_CRITICAL();
         return (OS_ERR_TIME_NOT_DLY);                          /* Indicate that task was not delayed   */
     }
 
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListRemove(ptcb);                                   /* Remove task from list of delayed tasks */
+#endif
     ptcb->OSTCBDly = 0u;                                       /* Clear the time delay                 */
     if ((ptcb->OSTCBStat & OS_STAT_PEND_ANY) != OS_STAT_RDY) {
         ptcb->OSTCBStat     &= ~OS_STAT_PEND_ANY;              /* Yes, Clear status flag               */
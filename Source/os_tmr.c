@@ -43,7 +43,48 @@
 *    OS_TASK_TMR_PRIO          The priority of the Timer management task
 *    OS_TASK_TMR_STK_SIZE      The size     of the Timer management task's stack
 *
+*    and, when OS_TMR_CFG_CB_TASKS is greater than 0:
+*
+*    OS_TASK_TMR_CB_PRIO       The priority of the first timer callback task.  Callback task 'n' runs at
+*                              priority OS_TASK_TMR_CB_PRIO + n.
+*    OS_TASK_TMR_CB_STK_SIZE   The size     of each timer callback task's stack
+*
 * 2) You must call OSTmrSignal() to notify the Timer management task that it's time to update the timers.
+*
+* 3) The timer wheel has OS_TMR_CFG_WHEEL_LVLS levels of OS_TMR_CFG_WHEEL_SIZE spokes each.  A timer that
+*    expires within the next OS_TMR_CFG_WHEEL_SIZE timer ticks is linked in the first level, on the spoke
+*    that is visited when it expires.  Timers further out are linked in a coarser level where each spoke
+*    covers OS_TMR_CFG_WHEEL_SIZE times more ticks than in the level below.  When the time reaches the
+*    start of a coarser spoke, its timers are moved down (cascaded) closer to their expiry.  Each tick
+*    of OSTmr_Update() thus only visits the timers that expire on that tick plus, amortized, a bounded
+*    number of cascades per timer.  Timers beyond the range of the last level stay in it and are
+*    revisited once per rotation of that level.  Setting OS_TMR_CFG_WHEEL_LVLS to 1 gives the original
+*    single wheel, where a spoke holds every timer whose match is a multiple of the wheel size apart.
+*
+* 4) The timer wheel is updated with the scheduler locked.  When OS_TMR_CFG_CB_DEFER_EN is set to 1, the
+*    timers that expire are only appended to a list of callbacks ready to run (OSTmrCbList) and the
+*    callbacks are called after the scheduler lock is released, either by the timer task or, when
+*    OS_TMR_CFG_CB_TASKS is greater than 0, by that many callback tasks.  A slow callback then only
+*    delays the tasks of lower priority than the task calling it.
+*
+*    a) OSTmrCbOverrun counts the periodic callbacks that returned after the next expiry was due.  An
+*       expiry that occurs while the callback of the previous one is still pending or running does not
+*       queue the callback again; it is also counted in OSTmrCbOverrun.
+*    b) A pending callback is discarded if its timer is stopped or deleted.
+*    c) OSTmrCbCtr counts the calls to the callback and, when the port provides OS_CPU_TS_GET(),
+*       OSTmrCbTime and OSTmrCbTimeMax hold the last and longest execution time of the callback.
+*
+* 5) When OS_TMR_CFG_TICK_EN is set to 1, there is no timer management task.  OSTimeTick() calls
+*    OSTmr_Tick() on every tick, the timers run at the tick rate (delays and periods are in OS ticks)
+*    and OSTmrSignal() does nothing.  The timer wheel is then updated with interrupts disabled rather
+*    than with the scheduler locked, which is why the functions that link or unlink a timer use
+*    OS_TMR_LOCK() and OS_TMR_UNLOCK().  Interrupts are only disabled for one timer at a time, between
+*    OS_TMR_TICK_ENTER() and OS_TMR_TICK_EXIT(), so that the interrupt latency does not grow with the
+*    number of timers on a spoke.  Expired timers only queue their callback (see Note #4).  The
+*    callbacks run in the callback tasks or, when OS_TMR_CFG_CB_TASKS is 0, at most
+*    OS_TMR_CFG_TICK_CB_MAX of them are called per tick at the end of OSTimeTick(), with interrupts
+*    enabled but still from the tick ISR: they must be short and must not wait.  The lateness of the
+*    timers (OS_TMR_CFG_LATE_EN) is always 0 in this mode.
 *********************************************************************************************************
 */
 
@@ -55,6 +96,23 @@
 
 #define  OS_TMR_LINK_DLY       0u
 #define  OS_TMR_LINK_PERIODIC  1u
+#define  OS_TMR_LINK_CASCADE   2u
+
+#if OS_TMR_CFG_TICK_EN > 0u                                      /* Protects the timer wheel (see Note #5)            */
+#define  OS_TMR_LOCK()         OS_ENTER_CRITICAL()
+#define  OS_TMR_UNLOCK()       OS_EXIT_CRITICAL()
+#else
+#define  OS_TMR_LOCK()         OSSchedLock()
+#define  OS_TMR_UNLOCK()       OSSchedUnlock()
+#endif
+
+#if OS_TMR_CFG_TICK_EN > 0u                                      /* Bounds a pass of OSTmr_Tick() (see Note #5)       */
+#define  OS_TMR_TICK_ENTER()   OS_ENTER_CRITICAL()
+#define  OS_TMR_TICK_EXIT()    OS_EXIT_CRITICAL()
+#else
+#define  OS_TMR_TICK_ENTER()
+#define  OS_TMR_TICK_EXIT()
+#endif
 
 /*
 *********************************************************************************************************
@@ -65,11 +123,28 @@
 #if OS_TMR_EN > 0u
 static  OS_TMR  *OSTmr_Alloc         (void);
 static  void     OSTmr_Free          (OS_TMR *ptmr);
+#if OS_TMR_CFG_TICK_EN == 0u
 static  void     OSTmr_InitTask      (void);
+#endif
 static  void     OSTmr_Link          (OS_TMR *ptmr, INT8U type);
 static  void     OSTmr_Unlink        (OS_TMR *ptmr);
+#if OS_TMR_CFG_WHEEL_LVLS > 1u
+static  void     OSTmr_Cascade       (void);
+#endif
+#if OS_TMR_CFG_CB_DEFER_EN > 0u
+static  void     OSTmr_CbQueue       (OS_TMR *ptmr);
+static  void     OSTmr_CbCancel      (OS_TMR *ptmr);
+static  BOOLEAN  OSTmr_CbRun         (void);
+#endif
+#if OS_TMR_CFG_CB_TASKS > 0u
+static  void     OSTmr_InitCbTasks   (void);
+static  void     OSTmr_CbTask        (void   *p_arg);
+#endif
+static  void     OSTmr_Update        (INT16U  late);
+#if OS_TMR_CFG_TICK_EN == 0u
 static  void     OSTmr_Task          (void   *p_arg);
 #endif
+#endif
 
 
 /*
@@ -182,6 +257,18 @@ OS_TMR  *OSTmrCreate (INT32U           dly,
     ptmr->OSTmrOpt         = opt;
     ptmr->OSTmrCallback    = callback;
     ptmr->OSTmrCallbackArg = callback_arg;
+#if OS_TMR_CFG_CB_DEFER_EN > 0u
+    ptmr->OSTmrCbCtr       = 0u;                            /* Clear callback statistics                              */
+    ptmr->OSTmrCbOverrun   = 0u;
+#if OS_TMR_CB_TS_EN > 0u
+    ptmr->OSTmrCbTime      = 0u;
+    ptmr->OSTmrCbTimeMax   = 0u;
+#endif
+#endif
+#if OS_TMR_CFG_LATE_EN > 0u
+    ptmr->OSTmrLate        = 0u;                            /* Clear lateness statistics                              */
+    ptmr->OSTmrLateMax     = 0u;
+#endif
 #if OS_TMR_CFG_NAME_EN > 0u
     if (pname == (INT8U *)0) {                              /* Is 'pname' a NULL pointer?                             */
         ptmr->OSTmrName    = (INT8U *)(void *)"?";
@@ -225,6 +312,11 @@ OS_TMR  *OSTmrCreate (INT32U           dly,
 BOOLEAN  OSTmrDel (OS_TMR  *ptmr,
                    INT8U   *perr)
 {
+#if (OS_TMR_CFG_TICK_EN > 0u) && (OS_CRITICAL_METHOD == 3u)     /* Allocate storage for CPU status register (Note #5)*/
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
 #ifdef OS_SAFETY_CRITICAL
     if (perr == (INT8U *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
@@ -259,12 +351,12 @@ BOOLEAN  OSTmrDel (OS_TMR  *ptmr,
         OS_TRACE_TMR_DEL_EXIT(*perr);
         return (OS_FALSE);
     }
-    OSSchedLock();
+    OS_TMR_LOCK();
     switch (ptmr->OSTmrState) {
         case OS_TMR_STATE_RUNNING:
              OSTmr_Unlink(ptmr);                            /* Remove from current wheel spoke                        */
              OSTmr_Free(ptmr);                              /* Return timer to free list of timers                    */
-             OSSchedUnlock();
+             OS_TMR_UNLOCK();
              *perr = OS_ERR_NONE;
              OS_TRACE_TMR_DEL_EXIT(*perr);
              return (OS_TRUE);
@@ -272,19 +364,19 @@ BOOLEAN  OSTmrDel (OS_TMR  *ptmr,
         case OS_TMR_STATE_STOPPED:                          /* Timer has not started or ...                           */
         case OS_TMR_STATE_COMPLETED:                        /* ... timer has completed the ONE-SHOT time              */
              OSTmr_Free(ptmr);                              /* Return timer to free list of timers                    */
-             OSSchedUnlock();
+             OS_TMR_UNLOCK();
              *perr = OS_ERR_NONE;
              OS_TRACE_TMR_DEL_EXIT(*perr);
              return (OS_TRUE);
 
         case OS_TMR_STATE_UNUSED:                           /* Already deleted                                        */
-             OSSchedUnlock();
+             OS_TMR_UNLOCK();
              *perr = OS_ERR_TMR_INACTIVE;
              OS_TRACE_TMR_DEL_EXIT(*perr);
              return (OS_FALSE);
 
         default:
-             OSSchedUnlock();
+             OS_TMR_UNLOCK();
              *perr = OS_ERR_TMR_INVALID_STATE;
              OS_TRACE_TMR_DEL_EXIT(*perr);
              return (OS_FALSE);
@@ -400,7 +492,10 @@ INT8U  OSTmrNameGet (OS_TMR   *ptmr,
 INT32U  OSTmrRemainGet (OS_TMR  *ptmr,
                         INT8U   *perr)
 {
-    INT32U  remain;
+    INT32U     remain;
+#if (OS_TMR_CFG_TICK_EN > 0u) && (OS_CRITICAL_METHOD == 3u)     /* Allocate storage for CPU status register (Note #5)*/
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
 
 
 #ifdef OS_SAFETY_CRITICAL
@@ -424,11 +519,11 @@ INT32U  OSTmrRemainGet (OS_TMR  *ptmr,
         *perr = OS_ERR_TMR_ISR;
         return (0u);
     }
-    OSSchedLock();
+    OS_TMR_LOCK();
     switch (ptmr->OSTmrState) {
         case OS_TMR_STATE_RUNNING:
              remain = ptmr->OSTmrMatch - OSTmrTime;    /* Determine how much time is left to timeout                  */
-             OSSchedUnlock();
+             OS_TMR_UNLOCK();
              *perr  = OS_ERR_NONE;
              return (remain);
 
@@ -440,31 +535,31 @@ INT32U  OSTmrRemainGet (OS_TMR  *ptmr,
                       } else {
                           remain = ptmr->OSTmrDly;
                       }
-                      OSSchedUnlock();
+                      OS_TMR_UNLOCK();
                       *perr  = OS_ERR_NONE;
                       break;
 
                  case OS_TMR_OPT_ONE_SHOT:
                  default:
                       remain = ptmr->OSTmrDly;
-                      OSSchedUnlock();
+                      OS_TMR_UNLOCK();
                       *perr  = OS_ERR_NONE;
                       break;
              }
              return (remain);
 
         case OS_TMR_STATE_COMPLETED:                   /* Only ONE-SHOT that timed out can be in this state           */
-             OSSchedUnlock();
+             OS_TMR_UNLOCK();
              *perr = OS_ERR_NONE;
              return (0u);
 
         case OS_TMR_STATE_UNUSED:
-             OSSchedUnlock();
+             OS_TMR_UNLOCK();
              *perr = OS_ERR_TMR_INACTIVE;
              return (0u);
 
         default:
-             OSSchedUnlock();
+             OS_TMR_UNLOCK();
              *perr = OS_ERR_TMR_INVALID_STATE;
              return (0u);
     }
@@ -570,6 +665,11 @@ INT8U  OSTmrStateGet (OS_TMR  *ptmr,
 BOOLEAN  OSTmrStart (OS_TMR   *ptmr,
                      INT8U    *perr)
 {
+#if (OS_TMR_CFG_TICK_EN > 0u) && (OS_CRITICAL_METHOD == 3u)     /* Allocate storage for CPU status register (Note #5)*/
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
 #ifdef OS_SAFETY_CRITICAL
     if (perr == (INT8U *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
@@ -596,12 +696,12 @@ BOOLEAN  OSTmrStart (OS_TMR   *ptmr,
         OS_TRACE_TMR_START_EXIT(*perr);
         return (OS_FALSE);
     }
-    OSSchedLock();
+    OS_TMR_LOCK();
     switch (ptmr->OSTmrState) {
         case OS_TMR_STATE_RUNNING:                          /* Restart the timer                                      */
              OSTmr_Unlink(ptmr);                            /* ... Stop the timer                                     */
              OSTmr_Link(ptmr, OS_TMR_LINK_DLY);             /* ... Link timer to timer wheel                          */
-             OSSchedUnlock();
+             OS_TMR_UNLOCK();
              *perr = OS_ERR_NONE;
              OS_TRACE_TMR_START_EXIT(*perr);
              return (OS_TRUE);
@@ -609,19 +709,19 @@ BOOLEAN  OSTmrStart (OS_TMR   *ptmr,
         case OS_TMR_STATE_STOPPED:                          /* Start the timer                                        */
         case OS_TMR_STATE_COMPLETED:
              OSTmr_Link(ptmr, OS_TMR_LINK_DLY);             /* ... Link timer to timer wheel                          */
-             OSSchedUnlock();
+             OS_TMR_UNLOCK();
              *perr = OS_ERR_NONE;
              OS_TRACE_TMR_START_EXIT(*perr);
              return (OS_TRUE);
 
         case OS_TMR_STATE_UNUSED:                           /* Timer not created                                      */
-             OSSchedUnlock();
+             OS_TMR_UNLOCK();
              *perr = OS_ERR_TMR_INACTIVE;
              OS_TRACE_TMR_START_EXIT(*perr);
              return (OS_FALSE);
 
         default:
-             OSSchedUnlock();
+             OS_TMR_UNLOCK();
              *perr = OS_ERR_TMR_INVALID_STATE;
              OS_TRACE_TMR_START_EXIT(*perr);
              return (OS_FALSE);
@@ -674,6 +774,10 @@ BOOLEAN  OSTmrStop (OS_TMR  *ptmr,
                     INT8U   *perr)
 {
     OS_TMR_CALLBACK  pfnct;
+    void            *parg;
+#if (OS_TMR_CFG_TICK_EN > 0u) && (OS_CRITICAL_METHOD == 3u)     /* Allocate storage for CPU status register (Note #5)*/
+    OS_CPU_SR        cpu_sr = 0u;
+#endif
 
 
 #ifdef OS_SAFETY_CRITICAL
@@ -702,26 +806,31 @@ BOOLEAN  OSTmrStop (OS_TMR  *ptmr,
         OS_TRACE_TMR_STOP_EXIT(*perr);
         return (OS_FALSE);
     }
-    OSSchedLock();
+    OS_TMR_LOCK();
+#if OS_TMR_CFG_CB_DEFER_EN > 0u
+    if (ptmr->OSTmrState != OS_TMR_STATE_UNUSED) {
+        OSTmr_CbCancel(ptmr);                                     /* Discard a pending callback (see Note #4b)        */
+    }
+#endif
     switch (ptmr->OSTmrState) {
         case OS_TMR_STATE_RUNNING:
              OSTmr_Unlink(ptmr);                                  /* Remove from current wheel spoke                  */
              *perr = OS_ERR_NONE;
+             pfnct = (OS_TMR_CALLBACK)0;
+             parg  = (void *)0;
              switch (opt) {
                  case OS_TMR_OPT_CALLBACK:
                       pfnct = ptmr->OSTmrCallback;                /* Execute callback function if available ...       */
-                      if (pfnct != (OS_TMR_CALLBACK)0) {
-                          (*pfnct)((void *)ptmr, ptmr->OSTmrCallbackArg);  /* Use callback arg when timer was created */
-                      } else {
+                      parg  = ptmr->OSTmrCallbackArg;             /* ... use callback arg when timer was created      */
+                      if (pfnct == (OS_TMR_CALLBACK)0) {
                           *perr = OS_ERR_TMR_NO_CALLBACK;
                       }
                       break;
 
                  case OS_TMR_OPT_CALLBACK_ARG:
                       pfnct = ptmr->OSTmrCallback;                /* Execute callback function if available ...       */
-                      if (pfnct != (OS_TMR_CALLBACK)0) {
-                          (*pfnct)((void *)ptmr, callback_arg);   /* ... using the 'callback_arg' provided in call    */
-                      } else {
+                      parg  = callback_arg;                       /* ... using the 'callback_arg' provided in call    */
+                      if (pfnct == (OS_TMR_CALLBACK)0) {
                           *perr = OS_ERR_TMR_NO_CALLBACK;
                       }
                       break;
@@ -733,25 +842,28 @@ BOOLEAN  OSTmrStop (OS_TMR  *ptmr,
                      *perr = OS_ERR_TMR_INVALID_OPT;
                      break;
              }
-             OSSchedUnlock();
+             OS_TMR_UNLOCK();
+             if (pfnct != (OS_TMR_CALLBACK)0) {                   /* Callback is called after the timer is unlocked   */
+                 (*pfnct)((void *)ptmr, parg);
+             }
              OS_TRACE_TMR_STOP_EXIT(*perr);
              return (OS_TRUE);
 
         case OS_TMR_STATE_COMPLETED:                              /* Timer has already completed the ONE-SHOT or ...  */
         case OS_TMR_STATE_STOPPED:                                /* ... timer has not started yet.                   */
-             OSSchedUnlock();
+             OS_TMR_UNLOCK();
              *perr = OS_ERR_TMR_STOPPED;
              OS_TRACE_TMR_STOP_EXIT(*perr);
              return (OS_TRUE);
 
         case OS_TMR_STATE_UNUSED:                                 /* Timer was not created                            */
-             OSSchedUnlock();
+             OS_TMR_UNLOCK();
              *perr = OS_ERR_TMR_INACTIVE;
              OS_TRACE_TMR_STOP_EXIT(*perr);
              return (OS_FALSE);
 
         default:
-             OSSchedUnlock();
+             OS_TMR_UNLOCK();
              *perr = OS_ERR_TMR_INVALID_STATE;
              OS_TRACE_TMR_STOP_EXIT(*perr);
              return (OS_FALSE);
@@ -769,7 +881,8 @@ BOOLEAN  OSTmrStop (OS_TMR  *ptmr,
 *
 * Arguments  : none
 *
-* Returns    : OS_ERR_NONE         The call was successful and the timer task was signaled.
+* Returns    : OS_ERR_NONE         The call was successful and the timer task was signaled or, when
+*                                  OS_TMR_CFG_TICK_EN is set to 1, there is no timer task to signal.
 *              OS_ERR_SEM_OVF      If OSTmrSignal() was called more often than OSTmr_Task() can handle
 *                                  the timers. This would indicate that your system is heavily loaded.
 *              OS_ERR_EVENT_TYPE   Unlikely you would get this error because the semaphore used for
@@ -782,11 +895,18 @@ BOOLEAN  OSTmrStop (OS_TMR  *ptmr,
 #if OS_TMR_EN > 0u
 INT8U  OSTmrSignal (void)
 {
+#if OS_TMR_CFG_TICK_EN > 0u
+    return (OS_ERR_NONE);                                /* Timers are updated by OSTimeTick() (Note #5)     */
+#else
     INT8U  err;
 
 
+#if OS_TICKLESS_EN > 0u
+    OSTmrTickCtr = 0u;                                   /* Phase of the signal relative to the tick         */
+#endif
     err = OSSemPost(OSTmrSemSignal);
     return (err);
+#endif
 }
 #endif
 
@@ -838,6 +958,10 @@ static  OS_TMR  *OSTmr_Alloc (void)
 #if OS_TMR_EN > 0u
 static  void  OSTmr_Free (OS_TMR *ptmr)
 {
+#if OS_TMR_CFG_CB_DEFER_EN > 0u
+    OSTmr_CbCancel(ptmr);                              /* Discard a pending callback (see Note #4b)                   */
+    ptmr->OSTmrCbState     = OS_TMR_CB_IDLE;           /* A running callback no longer updates the statistics         */
+#endif
     ptmr->OSTmrState       = OS_TMR_STATE_UNUSED;      /* Clear timer object fields                                   */
     ptmr->OSTmrOpt         = OS_TMR_OPT_NONE;
     ptmr->OSTmrPeriod      = 0u;
@@ -883,13 +1007,13 @@ void  OSTmr_Init (void)
     OS_TMR  *ptmr2;
 
 
-    OS_MemClr((INT8U *)&OSTmrTbl[0],      sizeof(OSTmrTbl));            /* Clear all the TMRs                         */
     OS_MemClr((INT8U *)&OSTmrWheelTbl[0], sizeof(OSTmrWheelTbl));       /* Clear the timer wheel                      */
 
     for (ix = 0u; ix < (OS_TMR_CFG_MAX - 1u); ix++) {                   /* Init. list of free TMRs                    */
         ix_next = ix + 1u;
         ptmr1 = &OSTmrTbl[ix];
         ptmr2 = &OSTmrTbl[ix_next];
+        OS_MemClr((INT8U *)ptmr1, sizeof(OS_TMR));                      /* One TMR at a time, see OS_MemClr() Note #2 */
         ptmr1->OSTmrType    = OS_TMR_TYPE;
         ptmr1->OSTmrState   = OS_TMR_STATE_UNUSED;                      /* Indicate that timer is inactive            */
         ptmr1->OSTmrNext    = (void *)ptmr2;                            /* Link to next timer                         */
@@ -898,6 +1022,7 @@ void  OSTmr_Init (void)
 #endif
     }
     ptmr1               = &OSTmrTbl[ix];
+    OS_MemClr((INT8U *)ptmr1, sizeof(OS_TMR));
     ptmr1->OSTmrType    = OS_TMR_TYPE;
     ptmr1->OSTmrState   = OS_TMR_STATE_UNUSED;                          /* Indicate that timer is inactive            */
     ptmr1->OSTmrNext    = (void *)0;                                    /* Last OS_TMR                                */
@@ -905,18 +1030,114 @@ void  OSTmr_Init (void)
     ptmr1->OSTmrName    = (INT8U *)(void *)"?";
 #endif
     OSTmrTime           = 0u;
+#if OS_TMR_CFG_LATE_EN > 0u
+    OSTmrBacklogMax     = 0u;
+#endif
+#if (OS_TICKLESS_EN > 0u) && (OS_TMR_CFG_TICK_EN == 0u)
+    OSTmrTickCtr        = 0u;
+#endif
+#if OS_TMR_CFG_TICK_EN > 0u
+    OSTmrTickPend       = 0u;
+#endif
     OSTmrUsed           = 0u;
     OSTmrFree           = OS_TMR_CFG_MAX;
     OSTmrFreeList       = &OSTmrTbl[0];
     OSTmrSem            = OSSemCreate(1u);
+#if OS_TMR_CFG_TICK_EN == 0u
     OSTmrSemSignal      = OSSemCreate(0u);
+#endif
+#if OS_TMR_CFG_CB_DEFER_EN > 0u
+    OSTmrCbList         = (OS_TMR *)0;
+    OSTmrCbListTail     = (OS_TMR *)0;
+#if OS_TMR_CFG_CB_TASKS > 0u
+    OSTmrCbSem          = OSSemCreate(0u);
+#endif
+#endif
 
 #if OS_EVENT_NAME_EN > 0u                                               /* Assign names to semaphores                 */
     OSEventNameSet(OSTmrSem,       (INT8U *)(void *)"uC/OS-II TmrLock",   &err);
+#if OS_TMR_CFG_TICK_EN == 0u
     OSEventNameSet(OSTmrSemSignal, (INT8U *)(void *)"uC/OS-II TmrSignal", &err);
 #endif
+#if OS_TMR_CFG_CB_TASKS > 0u
+    OSEventNameSet(OSTmrCbSem,     (INT8U *)(void *)"uC/OS-II TmrCb",     &err);
+#endif
+#endif
 
+#if OS_TMR_CFG_TICK_EN == 0u
     OSTmr_InitTask();
+#endif
+#if OS_TMR_CFG_CB_TASKS > 0u
+    OSTmr_InitCbTasks();
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  FIND THE TIME TO THE NEXT TIMER EXPIRY
+*
+* Description: This function is called by the idle task to determine for how long the tick can be
+*              suppressed without delaying a timer.
+*
+* Arguments  : int_ctr   is the value of OSIntExitCtr when the idle task started its scan.
+*
+* Returns    : The number of timer ticks (see OS_TMR_CFG_TICKS_PER_SEC) until the earliest running timer
+*              expires or, 0 if no timer is running.  1 is returned when the scan was abandoned.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) This function is called with interrupts enabled.  They are only disabled to read one
+*                 timer at a time, so that the interrupt latency does not grow with the number of timers.
+*                 Since the idle task only runs when the timer task is waiting for its signal, the timer
+*                 wheel can only be updated by an ISR (OSTmr_Tick()) or after one made a task ready.  The
+*                 scan is thus abandoned as soon as OSIntExitCtr no longer matches 'int_ctr'.
+*              3) When OS_TMR_CFG_TICK_EN is set to 1 and OS_TMR_CFG_CB_TASKS is 0, callbacks left over by
+*                 OSTmr_Tick() are run on the next tick, which must thus not be suppressed.
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u) && (OS_TICKLESS_EN > 0u)
+INT32U  OSTmr_NextGet (INT32U  int_ctr)
+{
+    OS_TMR    *ptmr;
+    INT32U     remain;
+    INT32U     next;
+    INT16U     spoke;
+#if OS_CRITICAL_METHOD == 3u                                     /* Allocate storage for CPU status register          */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+#if (OS_TMR_CFG_TICK_EN > 0u) && (OS_TMR_CFG_CB_TASKS == 0u)
+    if (OSTmrCbList != (OS_TMR *)0) {                            /* See Note #3                                       */
+        return (1u);
+    }
+#endif
+    next = 0u;
+    for (spoke = 0u; spoke < (OS_TMR_CFG_WHEEL_LVLS * OS_TMR_CFG_WHEEL_SIZE); spoke++) {
+        OS_ENTER_CRITICAL();                                     /* See Note #2                                       */
+        if (int_ctr != OSIntExitCtr) {
+            OS_EXIT_CRITICAL();
+            return (1u);
+        }
+        ptmr = OSTmrWheelTbl[spoke].OSTmrFirst;
+        while (ptmr != (OS_TMR *)0) {
+            remain = ptmr->OSTmrMatch - OSTmrTime;               /* Determine how much time is left to timeout        */
+            if ((next == 0u) || (remain < next)) {
+                next = remain;
+            }
+            ptmr = (OS_TMR *)ptmr->OSTmrNext;
+            OS_EXIT_CRITICAL();
+            OS_ENTER_CRITICAL();
+            if (int_ctr != OSIntExitCtr) {
+                OS_EXIT_CRITICAL();
+                return (1u);
+            }
+        }
+        OS_EXIT_CRITICAL();
+    }
+    return (next);
 }
 #endif
 
@@ -932,7 +1153,7 @@ void  OSTmr_Init (void)
 *********************************************************************************************************
 */
 
-#if OS_TMR_EN > 0u
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_TICK_EN == 0u)
 static  void  OSTmr_InitTask (void)
 {
 #if OS_TASK_NAME_EN > 0u
@@ -983,6 +1204,70 @@ static  void  OSTmr_InitTask (void)
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                 INITIALIZE THE TIMER CALLBACK TASKS
+*
+* Description: This function is called by OSTmr_Init() to create the OS_TMR_CFG_CB_TASKS tasks that run
+*              the callbacks of expired timers.  Callback task 'n' runs at priority OS_TASK_TMR_CB_PRIO + n.
+*
+* Arguments  : none
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_CB_TASKS > 0u)
+static  void  OSTmr_InitCbTasks (void)
+{
+    INT8U    ix;
+    OS_STK  *ptos;
+#if OS_TASK_CREATE_EXT_EN > 0u
+    OS_STK  *pbos;
+#endif
+#if OS_TASK_NAME_EN > 0u
+    INT8U    err;
+#endif
+
+
+    for (ix = 0u; ix < OS_TMR_CFG_CB_TASKS; ix++) {
+#if OS_STK_GROWTH == 1u
+        ptos = &OSTmrCbTaskStk[ix][OS_TASK_TMR_CB_STK_SIZE - 1u];
+#if OS_TASK_CREATE_EXT_EN > 0u
+        pbos = &OSTmrCbTaskStk[ix][0];
+#endif
+#else
+        ptos = &OSTmrCbTaskStk[ix][0];
+#if OS_TASK_CREATE_EXT_EN > 0u
+        pbos = &OSTmrCbTaskStk[ix][OS_TASK_TMR_CB_STK_SIZE - 1u];
+#endif
+#endif
+
+#if OS_TASK_CREATE_EXT_EN > 0u
+        (void)OSTaskCreateExt(OSTmr_CbTask,
+                              (void *)0,                                   /* No arguments passed to OSTmr_CbTask()   */
+                              ptos,                                        /* Set Top-Of-Stack                        */
+                              OS_TASK_TMR_CB_PRIO + ix,
+                              OS_TASK_TMR_CB_ID,
+                              pbos,                                        /* Set Bottom-Of-Stack                     */
+                              OS_TASK_TMR_CB_STK_SIZE,
+                              (void *)0,                                   /* No TCB extension                        */
+                              OS_TASK_OPT_STK_CHK | OS_TASK_OPT_STK_CLR);  /* Enable stack checking + clear stack     */
+#else
+        (void)OSTaskCreate(OSTmr_CbTask,
+                           (void *)0,
+                           ptos,
+                           OS_TASK_TMR_CB_PRIO + ix);
+#endif
+
+#if OS_TASK_NAME_EN > 0u
+        OSTaskNameSet(OS_TASK_TMR_CB_PRIO + ix, (INT8U *)(void *)"uC/OS-II Tmr Cb", &err);
+#endif
+    }
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                 INSERT A TIMER INTO THE TIMER WHEEL
@@ -995,8 +1280,15 @@ static  void  OSTmr_InitTask (void)
 *              type          Is either:
 *                               OS_TMR_LINK_PERIODIC    Means to re-insert the timer after a period expired
 *                               OS_TMR_LINK_DLY         Means to insert    the timer the first time
+*                               OS_TMR_LINK_CASCADE     Means to move      the timer to a finer level
 *
 * Returns    : none
+*
+* Note(s)    : 1) The level is chosen from the time left to the match.  Level 'n' holds the timers that
+*                 expire in at least OS_TMR_CFG_WHEEL_SIZE^n ticks and less than OS_TMR_CFG_WHEEL_SIZE^(n+1)
+*                 ticks, except for the last level which also holds all the timers further out.
+*              2) A periodic timer is re-armed from its previous match rather than from the current time,
+*                 so that its expiries stay on the schedule set when it was started.
 *********************************************************************************************************
 */
 
@@ -1007,19 +1299,42 @@ static  void  OSTmr_Link (OS_TMR  *ptmr,
     OS_TMR       *ptmr1;
     OS_TMR_WHEEL *pspoke;
     INT16U        spoke;
+#if OS_TMR_CFG_WHEEL_LVLS > 1u
+    INT32U        remain;
+    INT32U        div;
+    INT8U         lvl;
+#endif
 
 
     ptmr->OSTmrState = OS_TMR_STATE_RUNNING;
     if (type == OS_TMR_LINK_PERIODIC) {                            /* Determine when timer will expire                */
-        ptmr->OSTmrMatch = ptmr->OSTmrPeriod + OSTmrTime;
-    } else {
+        ptmr->OSTmrMatch += ptmr->OSTmrPeriod;                     /* See Note #2                                     */
+    } else if (type == OS_TMR_LINK_DLY) {
         if (ptmr->OSTmrDly == 0u) {
             ptmr->OSTmrMatch = ptmr->OSTmrPeriod + OSTmrTime;
         } else {
             ptmr->OSTmrMatch = ptmr->OSTmrDly    + OSTmrTime;
         }
+    } else {
+        ;                                                          /* Cascaded timers keep their match                */
     }
+#if OS_TMR_CFG_WHEEL_LVLS > 1u
+    remain = ptmr->OSTmrMatch - OSTmrTime;                         /* Select the level (see Note #1)                  */
+    div    = 1u;
+    lvl    = 0u;
+    while (lvl < (OS_TMR_CFG_WHEEL_LVLS - 1u)) {
+        if (remain < (div * OS_TMR_CFG_WHEEL_SIZE)) {
+            break;
+        }
+        div *= OS_TMR_CFG_WHEEL_SIZE;
+        lvl++;
+    }
+    spoke  = (INT16U)((ptmr->OSTmrMatch / div) % OS_TMR_CFG_WHEEL_SIZE);
+    spoke += (INT16U)lvl * OS_TMR_CFG_WHEEL_SIZE;
+#else
     spoke  = (INT16U)(ptmr->OSTmrMatch % OS_TMR_CFG_WHEEL_SIZE);
+#endif
+    ptmr->OSTmrSpoke = spoke;
     pspoke = &OSTmrWheelTbl[spoke];
 
     if (pspoke->OSTmrFirst == (OS_TMR *)0) {                       /* Link into timer wheel                           */
@@ -1056,11 +1371,9 @@ static  void  OSTmr_Unlink (OS_TMR *ptmr)
     OS_TMR        *ptmr1;
     OS_TMR        *ptmr2;
     OS_TMR_WHEEL  *pspoke;
-    INT16U         spoke;
 
 
-    spoke  = (INT16U)(ptmr->OSTmrMatch % OS_TMR_CFG_WHEEL_SIZE);
-    pspoke = &OSTmrWheelTbl[spoke];
+    pspoke = &OSTmrWheelTbl[ptmr->OSTmrSpoke];                /* Spoke the timer was linked in          */
 
     if (pspoke->OSTmrFirst == ptmr) {                       /* See if timer to remove is at the beginning of list     */
         ptmr1              = (OS_TMR *)ptmr->OSTmrNext;
@@ -1086,54 +1399,471 @@ static  void  OSTmr_Unlink (OS_TMR *ptmr)
 
 /*
 *********************************************************************************************************
-*                                        TIMER MANAGEMENT TASK
+*                                  CASCADE TIMERS TO A FINER WHEEL LEVEL
 *
-* Description: This task is created by OSTmrInit().
+* Description: This function is called by OSTmr_Update() on every timer tick.  For each level above the
+*              first, when the time reaches the start of one of its spokes, the timers linked in that
+*              spoke are re-linked according to the time they have left.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) The levels are processed from the coarsest down so that a timer cascaded out of a
+*                 level can be cascaded again by the level below on the same tick.
+*              2) A cascaded timer that expires on this tick lands on the current spoke of the first
+*                 level, which OSTmr_Update() processes next.
+*              3) When OS_TMR_CFG_TICK_EN is set to 1, interrupts are enabled between two timers (see
+*                 OSTmr_Update() Note #2).
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_WHEEL_LVLS > 1u)
+static  void  OSTmr_Cascade (void)
+{
+    OS_TMR        *ptmr;
+    OS_TMR        *ptmr_next;
+    OS_TMR_WHEEL  *pspoke;
+    INT16U         spoke;
+    INT32U         div;
+    INT8U          lvl;
+#if (OS_TMR_CFG_TICK_EN > 0u) && (OS_CRITICAL_METHOD == 3u)     /* Allocate storage for CPU status register (Note #5)*/
+    OS_CPU_SR      cpu_sr = 0u;
+#endif
+
+
+    div = 1u;
+    for (lvl = 1u; lvl < OS_TMR_CFG_WHEEL_LVLS; lvl++) {        /* Ticks covered by a spoke of the last level   */
+        div *= OS_TMR_CFG_WHEEL_SIZE;
+    }
+    for (lvl = OS_TMR_CFG_WHEEL_LVLS - 1u; lvl > 0u; lvl--) {   /* See Note #1                                  */
+        if ((OSTmrTime % div) == 0u) {                          /* At the start of a spoke of this level?       */
+            spoke  = (INT16U)((OSTmrTime / div) % OS_TMR_CFG_WHEEL_SIZE);
+            spoke += (INT16U)lvl * OS_TMR_CFG_WHEEL_SIZE;
+            pspoke = &OSTmrWheelTbl[spoke];
+            OS_TMR_TICK_ENTER();
+            ptmr   = pspoke->OSTmrFirst;
+            while (ptmr != (OS_TMR *)0) {
+                ptmr_next = (OS_TMR *)ptmr->OSTmrNext;
+                OSTmr_Unlink(ptmr);
+                OSTmr_Link(ptmr, OS_TMR_LINK_CASCADE);          /* See Note #2                                  */
+                OS_TMR_TICK_EXIT();                             /* See Note #3                                  */
+                OS_TMR_TICK_ENTER();
+                ptmr = ptmr_next;
+            }
+            OS_TMR_TICK_EXIT();
+        }
+        div /= OS_TMR_CFG_WHEEL_SIZE;
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   QUEUE THE CALLBACK OF AN EXPIRED TIMER
+*
+* Description: This function is called by OSTmr_Update() for each timer that expires.  The timer is appended
+*              to the list of callbacks ready to run.
+*
+* Arguments  : ptmr          Is a pointer to the timer that expired.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is called with the timer wheel locked (see Note #5).
+*              2) An expiry is coalesced with the previous one if its callback has not completed yet.
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_CB_DEFER_EN > 0u)
+static  void  OSTmr_CbQueue (OS_TMR *ptmr)
+{
+    OS_TMR  *ptail;
+
+
+    if (ptmr->OSTmrCallback == (OS_TMR_CALLBACK)0) {             /* Nothing to do if no callback                      */
+        return;
+    }
+    if (ptmr->OSTmrCbState != OS_TMR_CB_IDLE) {                  /* See Note #2                                       */
+        ptmr->OSTmrCbOverrun++;
+        return;
+    }
+    ptmr->OSTmrCbState = OS_TMR_CB_PEND;
+    ptmr->OSTmrCbNext  = (void *)0;
+    ptail              = OSTmrCbListTail;
+    ptmr->OSTmrCbPrev  = (void *)ptail;
+    if (ptail == (OS_TMR *)0) {                                  /* Append to the list of callbacks to run            */
+        OSTmrCbList       = ptmr;
+    } else {
+        ptail->OSTmrCbNext = (void *)ptmr;
+    }
+    OSTmrCbListTail    = ptmr;
+#if OS_TMR_CFG_CB_TASKS > 0u
+    (void)OSSemPost(OSTmrCbSem);                                 /* Wake up a callback task                           */
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   DISCARD THE PENDING CALLBACK OF A TIMER
+*
+* Description: This function is called when a timer is stopped or deleted to remove it from the list of
+*              callbacks ready to run.
+*
+* Arguments  : ptmr          Is a pointer to the timer.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is called with the timer wheel locked (see Note #5).
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_CB_DEFER_EN > 0u)
+static  void  OSTmr_CbCancel (OS_TMR *ptmr)
+{
+    OS_TMR  *ptmr1;
+    OS_TMR  *ptmr2;
+
+
+    if (ptmr->OSTmrCbState != OS_TMR_CB_PEND) {                  /* Only a pending callback is in the list            */
+        return;
+    }
+    ptmr1 = (OS_TMR *)ptmr->OSTmrCbPrev;
+    ptmr2 = (OS_TMR *)ptmr->OSTmrCbNext;
+    if (ptmr1 == (OS_TMR *)0) {
+        OSTmrCbList        = ptmr2;
+    } else {
+        ptmr1->OSTmrCbNext = (void *)ptmr2;
+    }
+    if (ptmr2 == (OS_TMR *)0) {
+        OSTmrCbListTail    = ptmr1;
+    } else {
+        ptmr2->OSTmrCbPrev = (void *)ptmr1;
+    }
+    ptmr->OSTmrCbNext  = (void *)0;
+    ptmr->OSTmrCbPrev  = (void *)0;
+    ptmr->OSTmrCbState = OS_TMR_CB_IDLE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       RUN THE NEXT READY CALLBACK
+*
+* Description: This function removes the first timer from the list of callbacks ready to run and calls
+*              its callback with the timer wheel unlocked.  The statistics of the timer are then updated.
 *
 * Arguments  : none
 *
+* Returns    : OS_TRUE       If a callback was called
+*              OS_FALSE      If the list was empty
+*
+* Note(s)    : 1) The timer could be deleted by the callback or by another task while the callback runs.
+*                 OSTmr_Free() then sets the callback state back to OS_TMR_CB_IDLE and the statistics are
+*                 left alone.
+*              2) The ticks signaled but not yet processed by the timer task, if any, are included in the
+*                 current timer time.  A periodic timer whose next expiry is already due when its callback returns
+*                 has overrun.
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_CB_DEFER_EN > 0u)
+static  BOOLEAN  OSTmr_CbRun (void)
+{
+    OS_TMR           *ptmr;
+    OS_TMR           *ptmr_next;
+    OS_TMR_CALLBACK   pfnct;
+    void             *parg;
+#if OS_TMR_CB_TS_EN > 0u
+    INT32U            ts;
+#endif
+#if (OS_TMR_CFG_TICK_EN > 0u) && (OS_CRITICAL_METHOD == 3u)     /* Allocate storage for CPU status register (Note #5)*/
+    OS_CPU_SR         cpu_sr = 0u;
+#endif
+
+
+    OS_TMR_LOCK();
+    ptmr = OSTmrCbList;
+    if (ptmr == (OS_TMR *)0) {
+        OS_TMR_UNLOCK();
+        return (OS_FALSE);
+    }
+    ptmr_next   = (OS_TMR *)ptmr->OSTmrCbNext;                   /* Remove the timer from the head of the list        */
+    OSTmrCbList = ptmr_next;
+    if (ptmr_next == (OS_TMR *)0) {
+        OSTmrCbListTail        = (OS_TMR *)0;
+    } else {
+        ptmr_next->OSTmrCbPrev = (void *)0;
+    }
+    ptmr->OSTmrCbNext  = (void *)0;
+    ptmr->OSTmrCbState = OS_TMR_CB_RUN;
+    pfnct              = ptmr->OSTmrCallback;
+    parg               = ptmr->OSTmrCallbackArg;
+    OS_TMR_UNLOCK();
+
+#if OS_TMR_CB_TS_EN > 0u
+    ts = OS_CPU_TS_GET();
+#endif
+    (*pfnct)((void *)ptmr, parg);
+#if OS_TMR_CB_TS_EN > 0u
+    ts = OS_CPU_TS_GET() - ts;
+#endif
+
+    OS_TMR_LOCK();
+    if (ptmr->OSTmrCbState == OS_TMR_CB_RUN) {                   /* See Note #1                                       */
+        ptmr->OSTmrCbState = OS_TMR_CB_IDLE;
+        ptmr->OSTmrCbCtr++;
+#if OS_TMR_CB_TS_EN > 0u
+        ptmr->OSTmrCbTime  = ts;
+        if (ts > ptmr->OSTmrCbTimeMax) {
+            ptmr->OSTmrCbTimeMax = ts;
+        }
+#endif
+        if ((ptmr->OSTmrState == OS_TMR_STATE_RUNNING) &&
+            (ptmr->OSTmrOpt   == OS_TMR_OPT_PERIODIC)) {         /* See Note #2                                       */
+#if OS_TMR_CFG_TICK_EN > 0u
+            if ((OSTmrTime - ptmr->OSTmrMatch) < 0x80000000u) {
+#else
+            if (((OSTmrTime + OSTmrSemSignal->OSEventCnt) - ptmr->OSTmrMatch) < 0x80000000u) {
+#endif
+                ptmr->OSTmrCbOverrun++;                          /* Next expiry was due before the callback returned  */
+            }
+        }
+    }
+    OS_TMR_UNLOCK();
+    return (OS_TRUE);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       PROCESS ONE TIMER TICK
+*
+* Description: This function advances the timer time by one tick and processes the timers that expire on
+*              that tick.
+*
+* Arguments  : late          Is the number of ticks still to be processed after this one (see OSTmr_Task()).
+*
 * Returns    : none
+*
+* Note(s)    : 1) This function is called with the scheduler locked by OSTmr_Task() or, when
+*                 OS_TMR_CFG_TICK_EN is set to 1, by OSTmr_Tick() from the tick ISR.
+*              2) In the latter case, interrupts are only disabled while one timer is processed.  Between
+*                 two timers, no other task can run (ISR or OSTimeTickN() with the scheduler locked) and
+*                 an ISR cannot use the timer services, so the spoke is left as it is.  A nested tick is
+*                 deferred by OSTmr_Tick() to the end of this pass.
 *********************************************************************************************************
 */
 
 #if OS_TMR_EN > 0u
-static  void  OSTmr_Task (void *p_arg)
+static  void  OSTmr_Update (INT16U  late)
 {
-    INT8U            err;
     OS_TMR          *ptmr;
     OS_TMR          *ptmr_next;
+#if OS_TMR_CFG_CB_DEFER_EN == 0u
     OS_TMR_CALLBACK  pfnct;
+#endif
     OS_TMR_WHEEL    *pspoke;
     INT16U           spoke;
+#if (OS_TMR_CFG_TICK_EN > 0u) && (OS_CRITICAL_METHOD == 3u)     /* Allocate storage for CPU status register (Note #5)*/
+    OS_CPU_SR        cpu_sr = 0u;
+#endif
+
+
+#if OS_TMR_CFG_LATE_EN == 0u
+    late = late;                                                 /* Prevent compiler warning for not using 'late'     */
+#endif
+    OS_TMR_TICK_ENTER();
+    OSTmrTime++;                                                 /* Increment the current time                        */
+    OS_TMR_TICK_EXIT();
+#if OS_TMR_CFG_WHEEL_LVLS > 1u
+    OSTmr_Cascade();                                             /* Move timers that are getting close to expiry      */
+#endif
+    spoke  = (INT16U)(OSTmrTime % OS_TMR_CFG_WHEEL_SIZE);
+    pspoke = &OSTmrWheelTbl[spoke];                              /* Position on current timer wheel entry             */
+    OS_TMR_TICK_ENTER();
+    ptmr   = pspoke->OSTmrFirst;
+    while (ptmr != (OS_TMR *)0) {
+        ptmr_next = (OS_TMR *)ptmr->OSTmrNext;                   /* Point to next timer to update because current ... */
+                                                                 /* ... timer could get unlinked from the wheel.      */
+        if (OSTmrTime == ptmr->OSTmrMatch) {                     /* Process each timer that expires                   */
+            OS_TRACE_TMR_EXPIRED(ptmr);
+#if OS_TMR_CFG_LATE_EN > 0u
+            ptmr->OSTmrLate = late;                              /* Ticks still to process are ticks late             */
+            if (late > ptmr->OSTmrLateMax) {
+                ptmr->OSTmrLateMax = late;
+            }
+#endif
+            OSTmr_Unlink(ptmr);                                  /* Remove from current wheel spoke                   */
+            if (ptmr->OSTmrOpt == OS_TMR_OPT_PERIODIC) {
+                OSTmr_Link(ptmr, OS_TMR_LINK_PERIODIC);          /* Recalculate new position of timer in wheel        */
+            } else {
+                ptmr->OSTmrState = OS_TMR_STATE_COMPLETED;       /* Indicate that the timer has completed             */
+            }
+#if OS_TMR_CFG_CB_DEFER_EN > 0u
+            OSTmr_CbQueue(ptmr);                                 /* Callback is called once the lock is released      */
+#else
+            pfnct = ptmr->OSTmrCallback;                         /* Execute callback function if available            */
+            if (pfnct != (OS_TMR_CALLBACK)0) {
+                (*pfnct)((void *)ptmr, ptmr->OSTmrCallbackArg);
+            }
+#endif
+        }
+        OS_TMR_TICK_EXIT();                                      /* Let interrupts in between timers (see Note #2)    */
+        OS_TMR_TICK_ENTER();
+        ptmr = ptmr_next;
+    }
+    OS_TMR_TICK_EXIT();
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   PROCESS THE TIMERS FROM THE TICK
+*
+* Description: This function is called by OSTimeTick() on every tick when OS_TMR_CFG_TICK_EN is set to 1.
+*              The timers that expire on this tick are processed with interrupts disabled for one timer at
+*              a time and, when there are no callback tasks, up to OS_TMR_CFG_TICK_CB_MAX ready callbacks
+*              are then called.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) The callbacks that are not called on this tick stay in OSTmrCbList for the next ones.
+*              3) The tick ISR may interrupt a pass of OSTimeTickN() from the idle task.  The nested tick
+*                 is then only counted in OSTmrTickPend and processed by the pass in progress, which
+*                 thus remains the only one to walk the timer wheel.
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_TICK_EN > 0u)
+void  OSTmr_Tick (void)
+{
+    INT8U      pend;
+#if OS_TMR_CFG_CB_TASKS == 0u
+    INT8U      ix;
+#endif
+#if OS_CRITICAL_METHOD == 3u                                     /* Allocate storage for CPU status register          */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+    OS_ENTER_CRITICAL();
+    OSTmrTickPend++;
+    pend = OSTmrTickPend;
+    OS_EXIT_CRITICAL();
+    if (pend > 1u) {                                             /* A pass is already in progress (see Note #3)       */
+        return;
+    }
+    while (pend > 0u) {
+        OSTmr_Update(0u);
+        OS_ENTER_CRITICAL();
+        OSTmrTickPend--;
+        pend = OSTmrTickPend;
+        OS_EXIT_CRITICAL();
+    }
+#if OS_TMR_CFG_CB_TASKS == 0u
+    for (ix = 0u; ix < OS_TMR_CFG_TICK_CB_MAX; ix++) {           /* Bound the time spent in callbacks (see Note #2)   */
+        if (OSTmr_CbRun() == OS_FALSE) {
+            break;
+        }
+    }
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        TIMER MANAGEMENT TASK
+*
+* Description: This task is created by OSTmrInit().
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) If the task could not keep up with OSTmrSignal(), the signals left in OSTmrSemSignal are
+*                 taken at once and all the pending ticks are processed in a single pass with the
+*                 scheduler locked, rather than one pass per signal.
+*              2) When OS_TMR_CFG_LATE_EN is set to 1, the number of pending ticks that remain to be
+*                 processed when a timer expires is recorded in the timer as its lateness (OSTmrLate and
+*                 OSTmrLateMax).  OSTmrBacklogMax holds the largest number of ticks caught up in one pass.
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_TICK_EN == 0u)
+static  void  OSTmr_Task (void *p_arg)
+{
+    INT8U      err;
+    INT16U     ticks;
+#if OS_CRITICAL_METHOD == 3u                                     /* Allocate storage for CPU status register          */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
 
 
     p_arg = p_arg;                                               /* Prevent compiler warning for not using 'p_arg'    */
     for (;;) {
         OSSemPend(OSTmrSemSignal, 0u, &err);                     /* Wait for signal indicating time to update timers  */
+        OS_ENTER_CRITICAL();                                     /* Catch up with all the pending signals (Note #1)   */
+        ticks                      = OSTmrSemSignal->OSEventCnt;
+        OSTmrSemSignal->OSEventCnt = 0u;
+        OS_EXIT_CRITICAL();
+#if OS_TMR_CFG_LATE_EN > 0u
+        if (ticks > OSTmrBacklogMax) {
+            OSTmrBacklogMax = ticks;
+        }
+#endif
         OSSchedLock();
-        OSTmrTime++;                                             /* Increment the current time                        */
-        spoke  = (INT16U)(OSTmrTime % OS_TMR_CFG_WHEEL_SIZE);    /* Position on current timer wheel entry             */
-        pspoke = &OSTmrWheelTbl[spoke];
-        ptmr   = pspoke->OSTmrFirst;
-        while (ptmr != (OS_TMR *)0) {
-            ptmr_next = (OS_TMR *)ptmr->OSTmrNext;               /* Point to next timer to update because current ... */
-                                                                 /* ... timer could get unlinked from the wheel.      */
-            if (OSTmrTime == ptmr->OSTmrMatch) {                 /* Process each timer that expires                   */
-                OS_TRACE_TMR_EXPIRED(ptmr);
-                OSTmr_Unlink(ptmr);                              /* Remove from current wheel spoke                   */
-                if (ptmr->OSTmrOpt == OS_TMR_OPT_PERIODIC) {
-                    OSTmr_Link(ptmr, OS_TMR_LINK_PERIODIC);      /* Recalculate new position of timer in wheel        */
-                } else {
-                    ptmr->OSTmrState = OS_TMR_STATE_COMPLETED;   /* Indicate that the timer has completed             */
-                }
-                pfnct = ptmr->OSTmrCallback;                     /* Execute callback function if available            */
-                if (pfnct != (OS_TMR_CALLBACK)0) {
-                    (*pfnct)((void *)ptmr, ptmr->OSTmrCallbackArg);
-                }
+        for (;;) {
+            OSTmr_Update(ticks);                                 /* Ticks still to process are ticks late (Note #2)   */
+            if (ticks == 0u) {                                   /* All pending ticks processed?                      */
+                break;
             }
-            ptmr = ptmr_next;
+            ticks--;
         }
         OSSchedUnlock();
+#if (OS_TMR_CFG_CB_DEFER_EN > 0u) && (OS_TMR_CFG_CB_TASKS == 0u)
+        while (OSTmr_CbRun() == OS_TRUE) {                       /* Call the callbacks of the expired timers          */
+            ;
+        }
+#endif
+    }
+}
+#endif
+
+/*
+*********************************************************************************************************
+*                                        TIMER CALLBACK TASK
+*
+* Description: This task is created by OSTmr_Init() when OS_TMR_CFG_CB_TASKS is greater than 0.  It calls
+*              one ready callback each time OSTmr_CbQueue() signals it.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) A signal can find the list empty if the callback was discarded in the meantime.
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_CB_TASKS > 0u)
+static  void  OSTmr_CbTask (void *p_arg)
+{
+    INT8U  err;
+
+
+    p_arg = p_arg;                                               /* Prevent compiler warning for not using 'p_arg'    */
+    for (;;) {
+        OSSemPend(OSTmrCbSem, 0u, &err);                         /* Wait for a callback to be ready                   */
+        (void)OSTmr_CbRun();                                     /* See Note #1                                       */
     }
 }
 #endif
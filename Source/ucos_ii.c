@@ -29,10 +29,14 @@
 #define  OS_MASTER_FILE                       /* Prevent the following files from including includes.h */
 #include <os_core.c>
 #include <os_flag.c>
+#include <os_int_q.c>
 #include <os_mbox.c>
 #include <os_mem.c>
 #include <os_mutex.c>
+#include <os_pipe.c>
 #include <os_q.c>
+#include <os_ring.c>
+#include <os_rwlock.c>
 #include <os_sem.c>
 #include <os_task.c>
 #include <os_time.c>
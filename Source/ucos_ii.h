@@ -71,6 +71,7 @@ extern "C" {
 
 #define  OS_PRIO_SELF                0xFFu              /* Indicate SELF priority                      */
 #define  OS_PRIO_MUTEX_CEIL_DIS      0xFFu              /* Disable mutex priority ceiling promotion    */
+#define  OS_PRIO_MUTEX_INHERIT       0xFEu              /* Mutex with priority inheritance, no ceiling */
 
 #if OS_TASK_STAT_EN > 0u
 #define  OS_N_SYS_TASKS                 2u              /* Number of system tasks                      */
@@ -92,8 +93,32 @@ extern "C" {
 #define  OS_TASK_IDLE_ID            65535u              /* ID numbers for Idle, Stat and Timer tasks   */
 #define  OS_TASK_STAT_ID            65534u
 #define  OS_TASK_TMR_ID             65533u
+#define  OS_TASK_INT_Q_ID           65532u
+#define  OS_TASK_TMR_CB_ID          65531u
 
-#define  OS_EVENT_EN           (((OS_Q_EN > 0u) && (OS_MAX_QS > 0u)) || (OS_MBOX_EN > 0u) || (OS_SEM_EN > 0u) || (OS_MUTEX_EN > 0u))
+#define  OS_EVENT_EN           (((OS_Q_EN > 0u) && (OS_MAX_QS > 0u)) || (OS_MBOX_EN > 0u) || (OS_SEM_EN > 0u) || (OS_MUTEX_EN > 0u) || \
+                                ((OS_RING_EN > 0u) && (OS_MAX_RINGS > 0u)) || ((OS_PIPE_EN > 0u) && (OS_MAX_PIPES > 0u)) || \
+                                (OS_RWLOCK_EN > 0u))
+
+#if (OS_TASK_PROFILE_EN > 0u) && defined(OS_CPU_TS_GET)
+#define  OS_TASK_PROFILE_TS_EN          1u              /* Kernel accumulates per-task run time        */
+#else
+#define  OS_TASK_PROFILE_TS_EN          0u
+#endif
+
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_CB_DEFER_EN > 0u) && defined(OS_CPU_TS_GET)
+#define  OS_TMR_CB_TS_EN                1u              /* Execution time of timer callbacks measured  */
+#else
+#define  OS_TMR_CB_TS_EN                0u
+#endif
+
+#ifndef  OS_TICKLESS_TICKS_MAX
+#define  OS_TICKLESS_TICKS_MAX  0xFFFFFFFFuL            /* Ticks suppressed when nothing is pending    */
+#endif
+
+#ifndef  OS_CPU_ADDR                                    /* Integer as wide as a pointer, os_cpu.h may  */
+#define  OS_CPU_ADDR            unsigned long           /* ... #define it where 'long' is narrower     */
+#endif
 
 #define  OS_TCB_RESERVED        ((OS_TCB *)1)
 
@@ -109,9 +134,12 @@ extern "C" {
 #define  OS_STAT_SUSPEND             0x08u  /* Task is suspended                                       */
 #define  OS_STAT_MUTEX               0x10u  /* Pending on mutual exclusion semaphore                   */
 #define  OS_STAT_FLAG                0x20u  /* Pending on event flag group                             */
+#define  OS_STAT_STREAM              0x40u  /* Pending on ring buffer or pipe                          */
 #define  OS_STAT_MULTI               0x80u  /* Pending on multiple events                              */
 
-#define  OS_STAT_PEND_ANY         (OS_STAT_SEM | OS_STAT_MBOX | OS_STAT_Q | OS_STAT_MUTEX | OS_STAT_FLAG)
+#define  OS_STAT_RWLOCK      OS_STAT_MUTEX  /* Pending on reader-writer lock (no free bit left)        */
+
+#define  OS_STAT_PEND_ANY         (OS_STAT_SEM | OS_STAT_MBOX | OS_STAT_Q | OS_STAT_MUTEX | OS_STAT_FLAG | OS_STAT_STREAM)
 
 /*
 *********************************************************************************************************
@@ -133,6 +161,10 @@ extern "C" {
 #define  OS_EVENT_TYPE_SEM              3u
 #define  OS_EVENT_TYPE_MUTEX            4u
 #define  OS_EVENT_TYPE_FLAG             5u
+#define  OS_EVENT_TYPE_Q_EX             6u  /* Queue of fixed size elements passed by value            */
+#define  OS_EVENT_TYPE_RING             7u  /* ISR to task ring buffer                                 */
+#define  OS_EVENT_TYPE_PIPE             8u  /* Task to task byte pipe                                  */
+#define  OS_EVENT_TYPE_RWLOCK           9u  /* Reader-writer lock                                      */
 
 #define  OS_TMR_TYPE                  100u  /* Used to identify Timers ...                             */
                                             /* ... (Must be different value than OS_EVENT_TYPE_xxx)    */
@@ -205,6 +237,33 @@ extern "C" {
 #define  OS_POST_OPT_FRONT           0x02u  /* Post to highest priority task waiting                   */
 #define  OS_POST_OPT_NO_SCHED        0x04u  /* Do not call the scheduler if this option is selected    */
 
+/*
+*********************************************************************************************************
+*                                MUTEX OPTIONS (see OSMutexCreateEx())
+*********************************************************************************************************
+*/
+#define  OS_MUTEX_OPT_NONE           0x00u  /* NO option selected                                      */
+#define  OS_MUTEX_OPT_NESTABLE       0x01u  /* The owner may acquire the mutex again                   */
+
+/*
+*********************************************************************************************************
+*                                      DEFERRED ISR POST TYPES
+*
+* These #defines identify the service called by an ISR when its post is deferred (see OSIntQ_Post()).
+*********************************************************************************************************
+*/
+#define  OS_INT_Q_SEM_POST              1u
+#define  OS_INT_Q_MBOX_POST             2u
+#define  OS_INT_Q_MBOX_POST_OPT         3u
+#define  OS_INT_Q_Q_POST                4u
+#define  OS_INT_Q_Q_POST_FRONT          5u
+#define  OS_INT_Q_Q_POST_OPT            6u
+#define  OS_INT_Q_FLAG_POST             7u
+#define  OS_INT_Q_RING_SIGNAL           8u
+#define  OS_INT_Q_TASK_SEM_POST         9u
+#define  OS_INT_Q_TASK_Q_POST          10u
+#define  OS_INT_Q_Q_POST_MULTI         11u
+
 /*
 *********************************************************************************************************
 *                                TASK OPTIONS (see OSTaskCreateExt())
@@ -239,6 +298,16 @@ extern "C" {
 #define  OS_TMR_STATE_COMPLETED         2u
 #define  OS_TMR_STATE_RUNNING           3u
 
+/*
+*********************************************************************************************************
+*                                       TIMER CALLBACK STATES
+*                                  (see OS_TMR_CFG_CB_DEFER_EN in OS_CFG.H)
+*********************************************************************************************************
+*/
+#define  OS_TMR_CB_IDLE                 0u  /* No callback pending                                     */
+#define  OS_TMR_CB_PEND                 1u  /* Callback is in the list of callbacks ready to run       */
+#define  OS_TMR_CB_RUN                  2u  /* Callback is running                                     */
+
 /*
 *********************************************************************************************************
 *                                             ERROR CODES
@@ -347,6 +416,22 @@ extern "C" {
 #define OS_ERR_TLS_DESTRUCT_ASSIGNED  163u
 #define OS_ERR_OS_NOT_RUNNING         164u
 
+#define OS_ERR_ROUND_ROBIN_1          170u
+#define OS_ERR_ROUND_ROBIN_DISABLED   171u
+#define OS_ERR_YIELD_ISR              172u
+
+#define OS_ERR_INT_Q_FULL             180u
+
+#define OS_ERR_RING_FULL              190u
+#define OS_ERR_RING_THRESHOLD         191u
+
+#define OS_ERR_PIPE_LEVEL             200u
+
+#define OS_ERR_MUTEX_NEST_OVF         210u
+
+#define OS_ERR_RWLOCK_NOT_OWNER       220u
+#define OS_ERR_RWLOCK_OVF             221u
+
 
 /*
 *********************************************************************************************************
@@ -385,6 +470,15 @@ typedef struct os_event {
 #if OS_EVENT_NAME_EN > 0u
     INT8U   *OSEventName;
 #endif
+
+#if (OS_MUTEX_EN > 0u) && (OS_MUTEX_INHERIT_EN > 0u)
+    struct os_event *OSEventMutexNext;      /* Next inheritance mutex owned by the same task           */
+#endif
+
+#if (OS_MUTEX_EN > 0u) && (OS_MUTEX_NEST_EN > 0u)
+    INT8U    OSEventMutexOpt;               /* Mutex options (see OS_MUTEX_OPT_xxx)                    */
+    INT16U   OSEventNestCtr;                /* Nbr of times the owner acquired the mutex again         */
+#endif
 } OS_EVENT;
 #endif
 
@@ -392,12 +486,15 @@ typedef struct os_event {
 /*
 *********************************************************************************************************
 *                                      EVENT FLAGS CONTROL BLOCK
+*
+* Note(s) : (1) A 64-bit OS_FLAGS takes two accesses on a 32-bit CPU.  The flags of a group and of a task
+*               (OSTCBFlagsRdy) are thus only read or written by uC/OS-II inside a critical section.
 *********************************************************************************************************
 */
 
 #if (OS_FLAG_EN > 0u) && (OS_MAX_FLAGS > 0u)
 
-#if OS_FLAGS_NBITS == 8u                    /* Determine the size of OS_FLAGS (8, 16 or 32 bits)       */
+#if OS_FLAGS_NBITS == 8u                    /* Determine the size of OS_FLAGS (8, 16, 32 or 64 bits)   */
 typedef  INT8U    OS_FLAGS;
 #endif
 
@@ -409,14 +506,21 @@ typedef  INT16U   OS_FLAGS;
 typedef  INT32U   OS_FLAGS;
 #endif
 
+#if OS_FLAGS_NBITS == 64u                   /* INT64U MUST be declared by the port (see os_cpu.h)      */
+typedef  INT64U   OS_FLAGS;
+#endif
+
 
 typedef struct os_flag_grp {                /* Event Flag Group                                        */
     INT8U         OSFlagType;               /* Should be set to OS_EVENT_TYPE_FLAG                     */
     void         *OSFlagWaitList;           /* Pointer to first NODE of task waiting on event flag     */
-    OS_FLAGS      OSFlagFlags;              /* 8, 16 or 32 bit flags                                   */
+    OS_FLAGS      OSFlagFlags;              /* 8, 16, 32 or 64 bit flags                               */
 #if OS_FLAG_NAME_EN > 0u
     INT8U        *OSFlagName;
 #endif
+#if OS_FLAG_BIT_INDEX_EN > 0u
+    void         *OSFlagBitList[OS_FLAGS_NBITS];    /* First NODE of tasks waiting on each bit         */
+#endif
 } OS_FLAG_GRP;
 
 
@@ -432,6 +536,10 @@ typedef struct os_flag_node {               /* Event Flag Wait List Node
                                             /*      OS_FLAG_WAIT_ALL                                   */
                                             /*      OS_FLAG_WAIT_OR                                    */
                                             /*      OS_FLAG_WAIT_ANY                                   */
+#if OS_FLAG_BIT_INDEX_EN > 0u
+    void         *OSFlagNodeBitNext[OS_FLAGS_NBITS];    /* Next     NODE waiting on each bit           */
+    void         *OSFlagNodeBitPrev[OS_FLAGS_NBITS];    /* Previous NODE waiting on each bit           */
+#endif
 } OS_FLAG_NODE;
 #endif
 
@@ -511,6 +619,9 @@ typedef struct os_q {                       /* QUEUE CONTROL BLOCK
     void         **OSQOut;                  /* Ptr to where next message will be extracted from the Q  */
     INT16U         OSQSize;                 /* Size of queue (maximum number of entries)               */
     INT16U         OSQEntries;              /* Current number of entries in the queue                  */
+#if OS_Q_EX_EN > 0u
+    INT16U         OSQElemSize;             /* Size of an element (bytes), 0 for a queue of pointers   */
+#endif
 } OS_Q;
 
 
@@ -518,11 +629,52 @@ typedef struct os_q_data {
     void          *OSMsg;                   /* Pointer to next message to be extracted from queue      */
     INT16U         OSNMsgs;                 /* Number of messages in message queue                     */
     INT16U         OSQSize;                 /* Size of message queue                                   */
+#if OS_Q_EX_EN > 0u
+    INT16U         OSElemSize;              /* Size of an element (bytes), 0 for a queue of pointers   */
+#endif
     OS_PRIO        OSEventTbl[OS_EVENT_TBL_SIZE];  /* List of tasks waiting for event to occur         */
     OS_PRIO        OSEventGrp;              /* Group corresponding to tasks waiting for event to occur */
 } OS_Q_DATA;
 #endif
 
+/*
+*********************************************************************************************************
+*                                             PIPE DATA
+*********************************************************************************************************
+*/
+
+#if (OS_PIPE_EN > 0u) && (OS_MAX_PIPES > 0u)
+typedef struct os_pipe {                    /* PIPE CONTROL BLOCK                                      */
+    struct os_pipe   *OSPipePtr;            /* Link to next pipe control block in list of free blocks  */
+    INT8U            *OSPipeStart;          /* Ptr to start of pipe storage area                       */
+    INT16U            OSPipeSize;           /* Size of the storage area (in bytes)                     */
+    INT16U volatile   OSPipeIn;             /* Index of next byte to write (moved by writer only)      */
+    INT16U volatile   OSPipeOut;            /* Index of next byte to read  (moved by reader only)      */
+    INT16U            OSPipeRdLvl;          /* Nbr of bytes the waiting reader needs, 0 if none        */
+    INT16U            OSPipeWrLvl;          /* Nbr of free bytes the waiting writer needs, 0 if none   */
+} OS_PIPE;
+#endif
+
+/*
+*********************************************************************************************************
+*                                        RING BUFFER DATA
+*********************************************************************************************************
+*/
+
+#if (OS_RING_EN > 0u) && (OS_MAX_RINGS > 0u)
+typedef struct os_ring {                    /* RING BUFFER CONTROL BLOCK                               */
+    struct os_ring   *OSRingPtr;            /* Link to next ring control block in list of free blocks  */
+    INT8U  volatile  *OSRingStart;          /* Ptr to start of ring storage area                       */
+    INT16U            OSRingSize;           /* Size of the storage area (in bytes)                     */
+    INT16U volatile   OSRingIn;             /* Index of next byte to write (written by producer only)  */
+    INT16U volatile   OSRingOut;            /* Index of next byte to read  (written by consumer only)  */
+    INT16U volatile   OSRingThreshold;      /* Nbr of bytes the waiting task needs, 0 if none waiting  */
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    BOOLEAN           OSRingWakePend;       /* Deferred wake up was lost, retry on next write          */
+#endif
+} OS_RING;
+#endif
+
 /*
 *********************************************************************************************************
 *                                           SEMAPHORE DATA
@@ -597,7 +749,23 @@ typedef struct os_tcb {
     OS_FLAGS         OSTCBFlagsRdy;         /* Event flags that made task ready to run                 */
 #endif
 
+#if OS_TASK_SEM_EN > 0u
+    INT16U           OSTCBSemCtr;           /* Task semaphore count (see OSTaskSemPost())              */
+#endif
+
+#if OS_TASK_Q_EN > 0u
+    void            *OSTCBQTbl[OS_TASK_Q_SIZE]; /* Task message queue (see OSTaskQPost())              */
+    INT16U           OSTCBQIn;              /* Index where next message will be inserted               */
+    INT16U           OSTCBQOut;             /* Index where next message will be extracted              */
+    INT16U           OSTCBQEntries;         /* Current number of messages in the task queue            */
+#endif
+
     INT32U           OSTCBDly;              /* Nbr ticks to delay task or, timeout waiting for event   */
+#if OS_TICK_LIST_EN > 0u
+    struct os_tcb   *OSTCBTickNext;         /* Pointer to next     TCB in the list of delayed tasks    */
+    struct os_tcb   *OSTCBTickPrev;         /* Pointer to previous TCB in the list of delayed tasks    */
+    INT32U           OSTCBTickDelta;        /* Nbr ticks after the previous TCB in the list expires    */
+#endif
     INT8U            OSTCBStat;             /* Task      status                                        */
     INT8U            OSTCBStatPend;         /* Task PEND status                                        */
     INT8U            OSTCBPrio;             /* Task priority (0 == highest)                            */
@@ -607,6 +775,22 @@ typedef struct os_tcb {
     OS_PRIO          OSTCBBitX;             /* Bit mask to access bit position in ready table          */
     OS_PRIO          OSTCBBitY;             /* Bit mask to access bit position in ready group          */
 
+#if OS_SCHED_RR_EN > 0u
+    struct os_tcb   *OSTCBPrioNext;         /* Pointer to next     TCB at the same priority            */
+    struct os_tcb   *OSTCBPrioPrev;         /* Pointer to previous TCB at the same prio (head: tail)   */
+    INT32U           OSTCBTimeQuanta;       /* Nbr ticks the task runs before yielding (0: default)    */
+    INT32U           OSTCBTimeQuantaCtr;    /* Nbr ticks left in the current time quanta               */
+#endif
+
+#if (OS_MUTEX_EN > 0u) && (OS_MUTEX_INHERIT_EN > 0u)
+    INT8U            OSTCBBasePrio;         /* Task priority without any inherited priority            */
+    OS_EVENT        *OSTCBMutexHeld;        /* List of the priority inheritance mutexes owned by task  */
+#endif
+
+#if OS_RWLOCK_EN > 0u
+    BOOLEAN          OSTCBRWLockWr;         /* OS_TRUE if waiting to write, not read, a RW lock        */
+#endif
+
 #if OS_TASK_DEL_EN > 0u
     INT8U            OSTCBDelReq;           /* Indicates whether a task needs to delete itself         */
 #endif
@@ -615,6 +799,8 @@ typedef struct os_tcb {
     INT32U           OSTCBCtxSwCtr;         /* Number of time the task was switched in                 */
     INT32U           OSTCBCyclesTot;        /* Total number of clock cycles the task has been running  */
     INT32U           OSTCBCyclesStart;      /* Snapshot of cycle counter at start of task resumption   */
+    INT32U           OSTCBCyclesTotPrev;    /* Value of OSTCBCyclesTot at the last statistics update   */
+    INT16U           OSTCBCPUUsage;         /* CPU usage over the last stat. period (0.01% units)      */
     OS_STK          *OSTCBStkBase;          /* Pointer to the beginning of the task stack              */
     INT32U           OSTCBStkUsed;          /* Number of bytes used from the stack                     */
 #endif
@@ -649,6 +835,22 @@ typedef  struct  os_tmr {
     INT32U           OSTmrMatch;            /* Timer expires when OSTmrTime == OSTmrMatch              */
     INT32U           OSTmrDly;              /* Delay time before periodic update starts                */
     INT32U           OSTmrPeriod;           /* Period to repeat timer                                  */
+    INT16U           OSTmrSpoke;            /* Index of the wheel spoke the timer is linked in         */
+#if OS_TMR_CFG_CB_DEFER_EN > 0u
+    void            *OSTmrCbNext;           /* Links in the list of callbacks ready to run             */
+    void            *OSTmrCbPrev;
+    INT8U            OSTmrCbState;          /* State of the callback (see OS_TMR_CB_xxx)               */
+    INT32U           OSTmrCbCtr;            /* Number of times the callback was called                 */
+    INT32U           OSTmrCbOverrun;        /* Nbr of times the callback overran the timer period      */
+#if OS_TMR_CB_TS_EN > 0u
+    INT32U           OSTmrCbTime;           /* Execution time of the last callback (OS_CPU_TS_GET())   */
+    INT32U           OSTmrCbTimeMax;        /* Longest execution time of the callback                  */
+#endif
+#endif
+#if OS_TMR_CFG_LATE_EN > 0u
+    INT16U           OSTmrLate;             /* Nbr of ticks the last expiry was processed late         */
+    INT16U           OSTmrLateMax;          /* Largest lateness of an expiry (# of timer ticks)        */
+#endif
 #if OS_TMR_CFG_NAME_EN > 0u
     INT8U           *OSTmrName;             /* Name to give the timer                                  */
 #endif
@@ -668,6 +870,48 @@ typedef  struct  os_tmr_wheel {
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                    DEFERRED ISR POST DATA TYPES
+*********************************************************************************************************
+*/
+
+#if OS_ISR_POST_DEFERRED_EN > 0u
+#if (OS_FLAG_EN > 0u) && (OS_MAX_FLAGS > 0u)
+typedef  OS_FLAGS  OS_INT_Q_FLAGS;          /* Wide enough for the flags of OSFlagPost()               */
+#else
+typedef  INT32U    OS_INT_Q_FLAGS;
+#endif
+
+typedef  struct  os_int_q {
+    INT8U            OSIntQType;            /* Service called by the ISR (see OS_INT_Q_xxx)            */
+    INT8U            OSIntQOpt;             /* Option passed to the service                            */
+    void            *OSIntQObjPtr;          /* Pointer to the event or event flag group posted to      */
+    void            *OSIntQMsgPtr;          /* Message posted to a mailbox or a queue                  */
+    OS_INT_Q_FLAGS   OSIntQFlags;           /* Flags posted to an event flag group                     */
+} OS_INT_Q;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                              INTERRUPT DISABLE TIME MEASUREMENT DATA
+*
+* Note(s) : (1) All times are expressed in OS_CPU_TS_GET() counts, i.e. in the units of the timestamp
+*               supplied by the port (CPU cycles on most ports).
+*********************************************************************************************************
+*/
+
+#if OS_INT_DIS_MEAS_EN > 0u
+typedef struct os_int_dis_data {
+    INT32U  OSIntDisTimeCur;                /* Length of the last critical section       (See Note #1) */
+    INT32U  OSIntDisTimeMax;                /* Longest critical section                  (See Note #1) */
+    INT32U  OSSchedLockTimeCur;             /* Length of the last scheduler lock         (See Note #1) */
+    INT32U  OSSchedLockTimeMax;             /* Longest scheduler lock                    (See Note #1) */
+} OS_INT_DIS_DATA;
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                       THREAD LOCAL STORAGE (TLS)
@@ -705,10 +949,38 @@ OS_EXT  INT8U             OSCPUUsage;               /* Percentage of CPU used
 OS_EXT  INT32U            OSIdleCtrMax;             /* Max. value that idle ctr can take in 1 sec.     */
 OS_EXT  INT32U            OSIdleCtrRun;             /* Val. reached by idle ctr at run time in 1 sec.  */
 OS_EXT  BOOLEAN           OSStatRdy;                /* Flag indicating that the statistic task is rdy  */
+#if OS_TASK_STAT_TS_EN > 0u
+OS_EXT  INT16U            OSCPUUsageHiRes;          /* CPU usage over the last window (0.01% units)    */
+#endif
 OS_EXT  OS_STK            OSTaskStatStk[OS_TASK_STAT_STK_SIZE];      /* Statistics task stack          */
 #endif
 
 OS_EXT  INT8U             OSIntNesting;             /* Interrupt nesting level                         */
+#if OS_TICKLESS_EN > 0u
+OS_EXT  volatile  INT32U  OSIntExitCtr;             /* Nbr of ISR exits, see OS_TaskIdle()             */
+#endif
+
+#if OS_TASK_PROFILE_TS_EN > 0u
+OS_EXT  BOOLEAN           OSIntCyclesRun;           /* ISR time is being accumulated                   */
+OS_EXT  INT32U            OSIntCyclesStart;         /* Timestamp of the outermost OSIntEnter()         */
+OS_EXT  INT32U            OSIntCyclesTot;           /* Total number of cycles spent in ISRs            */
+OS_EXT  INT32U            OSIntCyclesTotPrev;       /* OSIntCyclesTot at the last statistics update    */
+OS_EXT  INT16U            OSIntCPUUsage;            /* ISR CPU usage over last period (0.01% units)    */
+#if OS_TASK_STAT_EN > 0u
+OS_EXT  INT32U            OSStatTS;                 /* Timestamp of the last statistics update         */
+#endif
+#endif
+
+#if OS_INT_DIS_MEAS_EN > 0u
+OS_EXT  INT16U            OSIntDisMeasNestingCtr;   /* Nesting level of the measured critical sections */
+OS_EXT  INT32U            OSIntDisMeasTS;           /* Timestamp of the outermost OS_ENTER_CRITICAL()  */
+OS_EXT  INT32U            OSIntDisMeasOvrhd;        /* Overhead of the measurement itself              */
+OS_EXT  INT32U            OSIntDisTimeCur;          /* Length of the last critical section             */
+OS_EXT  INT32U            OSIntDisTimeMax;          /* Longest critical section                        */
+OS_EXT  INT32U            OSSchedLockTS;            /* Timestamp of the outermost scheduler lock       */
+OS_EXT  INT32U            OSSchedLockTimeCur;       /* Length of the last scheduler lock               */
+OS_EXT  INT32U            OSSchedLockTimeMax;       /* Longest scheduler lock                          */
+#endif
 
 OS_EXT  INT8U             OSLockNesting;            /* Multitasking lock nesting level                 */
 
@@ -738,6 +1010,15 @@ OS_EXT  OS_TCB           *OSTCBList;                       /* Pointer to doubly
 OS_EXT  OS_TCB           *OSTCBPrioTbl[OS_LOWEST_PRIO + 1u];    /* Table of pointers to created TCBs   */
 OS_EXT  OS_TCB            OSTCBTbl[OS_MAX_TASKS + OS_N_SYS_TASKS];   /* Table of TCBs                  */
 
+#if OS_TICK_LIST_EN > 0u
+OS_EXT  OS_TCB           *OSTickList;                      /* Pointer to sorted list of delayed TCBs   */
+#endif
+
+#if OS_SCHED_RR_EN > 0u
+OS_EXT  BOOLEAN           OSSchedRREn;                     /* Round-robin scheduling is enabled        */
+OS_EXT  INT32U            OSSchedRRDfltTimeQuanta;         /* Default time quanta (in ticks)           */
+#endif
+
 #if OS_TICK_STEP_EN > 0u
 OS_EXT  INT8U             OSTickStepState;          /* Indicates the state of the tick step feature    */
 #endif
@@ -752,6 +1033,16 @@ OS_EXT  OS_Q             *OSQFreeList;              /* Pointer to list of free Q
 OS_EXT  OS_Q              OSQTbl[OS_MAX_QS];        /* Table of QUEUE control blocks                   */
 #endif
 
+#if (OS_PIPE_EN > 0u) && (OS_MAX_PIPES > 0u)
+OS_EXT  OS_PIPE          *OSPipeFreeList;           /* Pointer to list of free PIPE control blocks     */
+OS_EXT  OS_PIPE           OSPipeTbl[OS_MAX_PIPES];  /* Table of PIPE control blocks                    */
+#endif
+
+#if (OS_RING_EN > 0u) && (OS_MAX_RINGS > 0u)
+OS_EXT  OS_RING          *OSRingFreeList;           /* Pointer to list of free RING control blocks     */
+OS_EXT  OS_RING           OSRingTbl[OS_MAX_RINGS];  /* Table of RING control blocks                    */
+#endif
+
 #if OS_TASK_REG_TBL_SIZE > 0u
 OS_EXT  INT8U             OSTaskRegNextAvailID;     /* Next available Task register ID                 */
 #endif
@@ -764,18 +1055,53 @@ OS_EXT  volatile  INT32U  OSTime;                   /* Current value of system t
 OS_EXT  INT16U            OSTmrFree;                /* Number of free entries in the timer pool        */
 OS_EXT  INT16U            OSTmrUsed;                /* Number of timers used                           */
 OS_EXT  INT32U            OSTmrTime;                /* Current timer time                              */
+#if OS_TMR_CFG_LATE_EN > 0u
+OS_EXT  INT16U            OSTmrBacklogMax;          /* Max. nbr of pending ticks caught up at once     */
+#endif
+#if (OS_TICKLESS_EN > 0u) && (OS_TMR_CFG_TICK_EN == 0u)
+OS_EXT  INT32U            OSTmrTickCtr;             /* Nbr of ticks since the last OSTmrSignal()       */
+#endif
+#if OS_TMR_CFG_TICK_EN > 0u
+OS_EXT  INT8U             OSTmrTickPend;            /* Nbr of ticks left to OSTmr_Tick() in progress   */
+#endif
 
 OS_EXT  OS_EVENT         *OSTmrSem;                 /* Sem. used to gain exclusive access to timers    */
+#if OS_TMR_CFG_TICK_EN == 0u
 OS_EXT  OS_EVENT         *OSTmrSemSignal;           /* Sem. used to signal the update of timers        */
+#endif
 
 OS_EXT  OS_TMR            OSTmrTbl[OS_TMR_CFG_MAX]; /* Table containing pool of timers                 */
 OS_EXT  OS_TMR           *OSTmrFreeList;            /* Pointer to free list of timers                  */
+#if OS_TMR_CFG_TICK_EN == 0u
 OS_EXT  OS_STK            OSTmrTaskStk[OS_TASK_TMR_STK_SIZE];
+#endif
+
+OS_EXT  OS_TMR_WHEEL      OSTmrWheelTbl[OS_TMR_CFG_WHEEL_LVLS * OS_TMR_CFG_WHEEL_SIZE];
+
+#if OS_TMR_CFG_CB_DEFER_EN > 0u
+OS_EXT  OS_TMR           *OSTmrCbList;              /* List of timers whose callback is ready to run   */
+OS_EXT  OS_TMR           *OSTmrCbListTail;          /* Last timer in the list                          */
+#if OS_TMR_CFG_CB_TASKS > 0u
+OS_EXT  OS_EVENT         *OSTmrCbSem;               /* Sem. counting the callbacks to run              */
+OS_EXT  OS_STK            OSTmrCbTaskStk[OS_TMR_CFG_CB_TASKS][OS_TASK_TMR_CB_STK_SIZE];
+#endif
+#endif
+#endif
 
-OS_EXT  OS_TMR_WHEEL      OSTmrWheelTbl[OS_TMR_CFG_WHEEL_SIZE];
+#if OS_ISR_POST_DEFERRED_EN > 0u
+OS_EXT  OS_INT_Q          OSIntQTbl[OS_INT_Q_SIZE]; /* Ring of posts deferred by ISRs                  */
+OS_EXT  INT16U            OSIntQInIx;               /* Index of the next entry to fill                 */
+OS_EXT  INT16U            OSIntQOutIx;              /* Index of the next entry to replay               */
+OS_EXT  INT16U            OSIntQNbrEntries;         /* Number of posts waiting to be replayed          */
+OS_EXT  INT16U            OSIntQNbrEntriesMax;      /* Peak number of posts waiting to be replayed     */
+OS_EXT  INT32U            OSIntQOvfCtr;             /* Number of posts lost because the ring was full  */
+OS_EXT  OS_STK            OSIntQTaskStk[OS_TASK_INT_Q_STK_SIZE];
+OS_EXT  OS_TCB           *OSIntQTCB;                /* TCB of the ISR post handler task                */
 #endif
 
+#ifndef OS_CPU_CNT_TRAIL_ZEROS
 extern  INT8U   const     OSUnMapTbl[256];          /* Priority->Index    lookup table                 */
+#endif
 
 
 /*
@@ -998,6 +1324,12 @@ BOOLEAN       OSMutexAccept           (OS_EVENT        *pevent,
 OS_EVENT     *OSMutexCreate           (INT8U            prio,
                                        INT8U           *perr);
 
+#if OS_MUTEX_NEST_EN > 0u
+OS_EVENT     *OSMutexCreateEx         (INT8U            prio,
+                                       INT8U            opt,
+                                       INT8U           *perr);
+#endif
+
 #if OS_MUTEX_DEL_EN > 0u
 OS_EVENT     *OSMutexDel              (OS_EVENT        *pevent,
                                        INT8U            opt,
@@ -1034,6 +1366,27 @@ void         *OSQAccept               (OS_EVENT        *pevent,
 OS_EVENT     *OSQCreate               (void           **start,
                                        INT16U           size);
 
+#if OS_Q_EX_EN > 0u
+#if OS_Q_ACCEPT_EN > 0u
+INT8U         OSQAcceptEx             (OS_EVENT        *pevent,
+                                       void            *pelem);
+#endif
+
+OS_EVENT     *OSQCreateEx             (void            *start,
+                                       INT16U           elem_size,
+                                       INT16U           size);
+
+void          OSQPendEx               (OS_EVENT        *pevent,
+                                       void            *pelem,
+                                       INT32U           timeout,
+                                       INT8U           *perr);
+
+#if OS_Q_POST_EN > 0u
+INT8U         OSQPostEx               (OS_EVENT        *pevent,
+                                       void            *pelem);
+#endif
+#endif
+
 #if OS_Q_DEL_EN > 0u
 OS_EVENT     *OSQDel                  (OS_EVENT        *pevent,
                                        INT8U            opt,
@@ -1054,6 +1407,20 @@ INT8U         OSQPendAbort            (OS_EVENT        *pevent,
                                        INT8U           *perr);
 #endif
 
+#if OS_Q_MULTI_EN > 0u
+INT16U        OSQPendMulti            (OS_EVENT        *pevent,
+                                       void           **pmsgs,
+                                       INT16U           max_n,
+                                       INT32U           timeout,
+                                       INT8U           *perr);
+
+INT16U        OSQPostMulti            (OS_EVENT        *pevent,
+                                       void           **pmsgs,
+                                       INT16U           n,
+                                       INT8U            opt,
+                                       INT8U           *perr);
+#endif
+
 #if OS_Q_POST_EN > 0u
 INT8U         OSQPost                 (OS_EVENT        *pevent,
                                        void            *pmsg);
@@ -1078,6 +1445,101 @@ INT8U         OSQQuery                (OS_EVENT        *pevent,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                           PIPE MANAGEMENT
+*********************************************************************************************************
+*/
+
+#if (OS_PIPE_EN > 0u) && (OS_MAX_PIPES > 0u)
+
+OS_EVENT     *OSPipeCreate            (void            *pbuf,
+                                       INT16U           size);
+
+#if OS_PIPE_DEL_EN > 0u
+OS_EVENT     *OSPipeDel               (OS_EVENT        *pevent,
+                                       INT8U            opt,
+                                       INT8U           *perr);
+#endif
+
+INT16U        OSPipeRead              (OS_EVENT        *pevent,
+                                       void            *pbuf,
+                                       INT16U           len,
+                                       INT16U           min_len,
+                                       INT32U           timeout,
+                                       INT8U           *perr);
+
+INT16U        OSPipeWrite             (OS_EVENT        *pevent,
+                                       void            *pbuf,
+                                       INT16U           len,
+                                       INT32U           timeout,
+                                       INT8U           *perr);
+
+#endif
+
+/*
+*********************************************************************************************************
+*                                       RING BUFFER MANAGEMENT
+*********************************************************************************************************
+*/
+
+#if (OS_RING_EN > 0u) && (OS_MAX_RINGS > 0u)
+
+OS_EVENT     *OSRingCreate            (INT8U           *pbuf,
+                                       INT16U           size);
+
+#if OS_RING_DEL_EN > 0u
+OS_EVENT     *OSRingDel               (OS_EVENT        *pevent,
+                                       INT8U            opt,
+                                       INT8U           *perr);
+#endif
+
+INT8U         OSRingPut               (OS_EVENT        *pevent,
+                                       INT8U            data);
+
+INT16U        OSRingRead              (OS_EVENT        *pevent,
+                                       INT8U           *pbuf,
+                                       INT16U           len,
+                                       INT16U           threshold,
+                                       INT32U           timeout,
+                                       INT8U           *perr);
+
+INT16U        OSRingWrite             (OS_EVENT        *pevent,
+                                       INT8U           *pdata,
+                                       INT16U           len);
+
+#endif
+
+/*
+*********************************************************************************************************
+*                                    READER-WRITER LOCK MANAGEMENT
+*********************************************************************************************************
+*/
+
+#if OS_RWLOCK_EN > 0u
+
+OS_EVENT     *OSRWLockCreate          (void);
+
+#if OS_RWLOCK_DEL_EN > 0u
+OS_EVENT     *OSRWLockDel             (OS_EVENT        *pevent,
+                                       INT8U            opt,
+                                       INT8U           *perr);
+#endif
+
+void          OSRWLockReadPend        (OS_EVENT        *pevent,
+                                       INT32U           timeout,
+                                       INT8U           *perr);
+
+INT8U         OSRWLockReadPost        (OS_EVENT        *pevent);
+
+void          OSRWLockWritePend       (OS_EVENT        *pevent,
+                                       INT32U           timeout,
+                                       INT8U           *perr);
+
+INT8U         OSRWLockWritePost       (OS_EVENT        *pevent);
+
+#endif
+
 /*
 *********************************************************************************************************
 *                                        SEMAPHORE MANAGEMENT
@@ -1177,11 +1639,32 @@ INT8U         OSTaskStkChk            (INT8U            prio,
                                        OS_STK_DATA     *p_stk_data);
 #endif
 
+#if OS_TASK_Q_EN > 0u
+void         *OSTaskQPend             (INT32U           timeout,
+                                       INT8U           *perr);
+
+INT8U         OSTaskQPost             (INT8U            prio,
+                                       void            *pmsg);
+#endif
+
 #if OS_TASK_QUERY_EN > 0u
 INT8U         OSTaskQuery             (INT8U            prio,
                                        OS_TCB          *p_task_data);
 #endif
 
+#if OS_TASK_SEM_EN > 0u
+INT16U        OSTaskSemPend           (INT32U           timeout,
+                                       INT8U           *perr);
+
+INT8U         OSTaskSemPost           (INT8U            prio);
+#endif
+
+#if OS_SCHED_RR_EN > 0u
+void          OSTaskTimeQuantaSet     (INT8U            prio,
+                                       INT32U           time_quanta,
+                                       INT8U           *perr);
+#endif
+
 
 
 #if OS_TASK_REG_TBL_SIZE > 0u
@@ -1224,6 +1707,10 @@ void          OSTimeSet               (INT32U           ticks);
 
 void          OSTimeTick              (void);
 
+#if OS_TICKLESS_EN > 0u
+void          OSTimeTickN             (INT32U           ticks);
+#endif
+
 /*
 *********************************************************************************************************
 *                                          TIMER MANAGEMENT
@@ -1275,6 +1762,12 @@ void          OSInit                  (void);
 void          OSIntEnter              (void);
 void          OSIntExit               (void);
 
+#if OS_INT_DIS_MEAS_EN > 0u
+INT8U         OSIntDisMeasQuery       (OS_INT_DIS_DATA *p_int_dis_data);
+
+void          OSIntDisMeasReset       (void);
+#endif
+
 #ifdef OS_SAFETY_CRITICAL_IEC61508
 void          OSSafetyCriticalStart   (void);
 #endif
@@ -1284,6 +1777,14 @@ void          OSSchedLock             (void);
 void          OSSchedUnlock           (void);
 #endif
 
+#if OS_SCHED_RR_EN > 0u
+void          OSSchedRoundRobinCfg    (BOOLEAN          en,
+                                       INT32U           dflt_time_quanta,
+                                       INT8U           *perr);
+
+void          OSSchedRoundRobinYield  (INT8U           *perr);
+#endif
+
 void          OSStart                 (void);
 
 void          OSStatInit              (void);
@@ -1302,6 +1803,13 @@ INT16U        OSVersion               (void);
 void          OS_Dummy                (void);
 #endif
 
+#if OS_INT_DIS_MEAS_EN > 0u
+void          OS_IntDisMeasStart      (void);
+void          OS_IntDisMeasStop       (void);
+void          OS_SchedLockMeasStart   (void);
+void          OS_SchedLockMeasStop    (void);
+#endif
+
 #if (OS_EVENT_EN)
 INT8U         OS_EventTaskRdy         (OS_EVENT        *pevent,
                                        void            *pmsg,
@@ -1310,6 +1818,8 @@ INT8U         OS_EventTaskRdy         (OS_EVENT        *pevent,
 
 void          OS_EventTaskWait        (OS_EVENT        *pevent);
 
+INT8U         OS_EventWaitPrioGet     (OS_EVENT        *pevent);
+
 void          OS_EventTaskRemove      (OS_TCB          *ptcb,
                                        OS_EVENT        *pevent);
 
@@ -1339,12 +1849,42 @@ void          OS_MemCopy              (INT8U           *pdest,
 void          OS_MemInit              (void);
 #endif
 
+#if (OS_MUTEX_EN > 0u) && (OS_MUTEX_INHERIT_EN > 0u)
+void          OSMutex_InheritChain    (OS_TCB          *ptcb);
+#endif
+
 #if OS_Q_EN > 0u
 void          OS_QInit                (void);
 #endif
 
+#if (OS_PIPE_EN > 0u) && (OS_MAX_PIPES > 0u)
+void          OS_PipeInit             (void);
+#endif
+
+#if (OS_RING_EN > 0u) && (OS_MAX_RINGS > 0u)
+void          OS_RingInit             (void);
+
+void          OS_RingSignal           (OS_EVENT        *pevent);
+#endif
+
 void          OS_Sched                (void);
 
+#if OS_SCHED_RR_EN > 0u
+void          OS_SchedRRInsert        (OS_TCB          *ptcb);
+void          OS_SchedRRRemove        (OS_TCB          *ptcb);
+OS_TCB       *OS_SchedRRNext          (INT8U            prio);
+BOOLEAN       OS_SchedRRIsRdy         (OS_TCB          *ptcb);
+void          OS_SchedRRRdyRestore    (OS_TCB          *ptcb);
+
+#if (OS_EVENT_EN)
+OS_TCB       *OS_SchedRREventTCB      (INT8U            prio,
+                                       OS_EVENT        *pevent);
+
+void          OS_SchedRREventRestore  (OS_TCB          *ptcb,
+                                       OS_EVENT        *pevent);
+#endif
+#endif
+
 #if (OS_EVENT_NAME_EN > 0u) || (OS_FLAG_NAME_EN > 0u) || (OS_MEM_NAME_EN > 0u) || (OS_TASK_NAME_EN > 0u)
 INT8U         OS_StrLen               (INT8U           *psrc);
 #endif
@@ -1367,6 +1907,10 @@ void          OS_TaskStkClr           (OS_STK          *pbos,
 void          OS_TaskStatStkChk       (void);
 #endif
 
+#if (OS_TASK_STAT_EN > 0u) && (OS_TASK_PROFILE_TS_EN > 0u)
+void          OS_TaskStatCPUUsage     (void);
+#endif
+
 INT8U         OS_TCBInit              (INT8U            prio,
                                        OS_STK          *ptos,
                                        OS_STK          *pbos,
@@ -1375,8 +1919,36 @@ INT8U         OS_TCBInit              (INT8U            prio,
                                        void            *pext,
                                        INT16U           opt);
 
+#if (OS_TASK_CHANGE_PRIO_EN > 0u) || ((OS_MUTEX_EN > 0u) && (OS_MUTEX_INHERIT_EN > 0u))
+void          OS_TCBPrioSet           (OS_TCB          *ptcb,
+                                       INT8U            prio);
+#endif
+
+#if OS_ISR_POST_DEFERRED_EN > 0u
+void          OSIntQ_Init             (void);
+
+INT8U         OSIntQ_Post             (INT8U            type,
+                                       void            *pobj,
+                                       void            *pmsg,
+                                       OS_INT_Q_FLAGS   flags,
+                                       INT8U            opt);
+#endif
+
+#if OS_TICK_LIST_EN > 0u
+void          OS_TickListInsert       (OS_TCB          *ptcb);
+void          OS_TickListRemove       (OS_TCB          *ptcb);
+#endif
+
 #if OS_TMR_EN > 0u
 void          OSTmr_Init              (void);
+
+#if OS_TMR_CFG_TICK_EN > 0u
+void          OSTmr_Tick              (void);
+#endif
+
+#if OS_TICKLESS_EN > 0u
+INT32U        OSTmr_NextGet           (INT32U           int_ctr);
+#endif
 #endif
 
 
@@ -1399,6 +1971,10 @@ void          OSTaskDelHook           (OS_TCB          *ptcb);
 
 void          OSTaskIdleHook          (void);
 
+#if OS_TICKLESS_EN > 0u
+INT32U        OSTaskIdleTicklessHook  (INT32U           ticks);
+#endif
+
 void          OSTaskReturnHook        (OS_TCB          *ptcb);
 
 void          OSTaskStatHook          (void);
@@ -1490,13 +2066,21 @@ void          OSCtxSw                 (void);
     #endif
 
     #ifndef OS_FLAGS_NBITS
-    #error  "OS_CFG.H, Missing OS_FLAGS_NBITS: Determine #bits used for event flags, MUST be either 8, 16 or 32"
+    #error  "OS_CFG.H, Missing OS_FLAGS_NBITS: Determine #bits used for event flags, MUST be either 8, 16, 32 or 64"
+    #else
+        #if     (OS_FLAGS_NBITS != 8u) && (OS_FLAGS_NBITS != 16u) && (OS_FLAGS_NBITS != 32u) && (OS_FLAGS_NBITS != 64u)
+        #error  "OS_CFG.H, OS_FLAGS_NBITS MUST be either 8, 16, 32 or 64"
+        #endif
     #endif
 
     #ifndef OS_FLAG_WAIT_CLR_EN
     #error  "OS_CFG.H, Missing OS_FLAG_WAIT_CLR_EN: Include code for Wait on Clear EVENT FLAGS"
     #endif
 
+    #ifndef OS_FLAG_BIT_INDEX_EN
+    #error  "OS_CFG.H, Missing OS_FLAG_BIT_INDEX_EN: Index the tasks waiting on each bit of event flags"
+    #endif
+
     #ifndef OS_FLAG_ACCEPT_EN
     #error  "OS_CFG.H, Missing OS_FLAG_ACCEPT_EN: Include code for OSFlagAccept()"
     #endif
@@ -1591,6 +2175,26 @@ void          OSCtxSw                 (void);
     #error  "OS_CFG.H, Missing OS_MUTEX_DEL_EN: Include code for OSMutexDel()"
     #endif
 
+    #ifndef OS_MUTEX_FAST_EN
+    #error  "OS_CFG.H, Missing OS_MUTEX_FAST_EN: Uncontended OSMutexPend()/OSMutexPost() without disabling interrupts"
+    #elif   OS_MUTEX_FAST_EN > 0u
+        #ifndef OS_CPU_CAS_PTR
+        #error  "OS_CPU.H, OS_MUTEX_FAST_EN requires the port to provide the OS_CPU_CAS_PTR() compare-and-swap"
+        #endif
+    #endif
+
+    #ifndef OS_MUTEX_INHERIT_EN
+    #error  "OS_CFG.H, Missing OS_MUTEX_INHERIT_EN: Allow mutexes with priority inheritance"
+    #elif   OS_MUTEX_INHERIT_EN > 0u
+        #if OS_SCHED_RR_EN == 0u
+        #error  "OS_CFG.H, OS_MUTEX_INHERIT_EN requires OS_SCHED_RR_EN (an owner shares the priority it inherits)"
+        #endif
+    #endif
+
+    #ifndef OS_MUTEX_NEST_EN
+    #error  "OS_CFG.H, Missing OS_MUTEX_NEST_EN: Include code for nestable mutexes (OSMutexCreateEx())"
+    #endif
+
     #ifndef OS_MUTEX_QUERY_EN
     #error  "OS_CFG.H, Missing OS_MUTEX_QUERY_EN: Include code for OSMutexQuery()"
     #endif
@@ -1644,6 +2248,72 @@ void          OSCtxSw                 (void);
     #ifndef OS_Q_QUERY_EN
     #error  "OS_CFG.H, Missing OS_Q_QUERY_EN: Include code for OSQQuery()"
     #endif
+
+    #ifndef OS_Q_EX_EN
+    #error  "OS_CFG.H, Missing OS_Q_EX_EN: Include code for by-value queues (OSQCreateEx() ...)"
+    #endif
+
+    #ifndef OS_Q_MULTI_EN
+    #error  "OS_CFG.H, Missing OS_Q_MULTI_EN: Include code for OSQPostMulti() and OSQPendMulti()"
+    #endif
+#endif
+
+/*
+*********************************************************************************************************
+*                                                PIPES
+*********************************************************************************************************
+*/
+
+#ifndef OS_PIPE_EN
+#error  "OS_CFG.H, Missing OS_PIPE_EN: Enable (1) or Disable (0) code generation for PIPES"
+#else
+    #ifndef OS_MAX_PIPES
+    #error  "OS_CFG.H, Missing OS_MAX_PIPES: Max. number of pipe control blocks"
+    #else
+        #if     OS_MAX_PIPES > 65500u
+        #error  "OS_CFG.H, OS_MAX_PIPES must be <= 65500"
+        #endif
+    #endif
+
+    #ifndef OS_PIPE_DEL_EN
+    #error  "OS_CFG.H, Missing OS_PIPE_DEL_EN: Include code for OSPipeDel()"
+    #endif
+#endif
+
+/*
+*********************************************************************************************************
+*                                            RING BUFFERS
+*********************************************************************************************************
+*/
+
+#ifndef OS_RING_EN
+#error  "OS_CFG.H, Missing OS_RING_EN: Enable (1) or Disable (0) code generation for RING BUFFERS"
+#else
+    #ifndef OS_MAX_RINGS
+    #error  "OS_CFG.H, Missing OS_MAX_RINGS: Max. number of ring buffer control blocks"
+    #else
+        #if     OS_MAX_RINGS > 65500u
+        #error  "OS_CFG.H, OS_MAX_RINGS must be <= 65500"
+        #endif
+    #endif
+
+    #ifndef OS_RING_DEL_EN
+    #error  "OS_CFG.H, Missing OS_RING_DEL_EN: Include code for OSRingDel()"
+    #endif
+#endif
+
+/*
+*********************************************************************************************************
+*                                         READER-WRITER LOCKS
+*********************************************************************************************************
+*/
+
+#ifndef OS_RWLOCK_EN
+#error  "OS_CFG.H, Missing OS_RWLOCK_EN: Enable (1) or Disable (0) code generation for RW LOCKS"
+#else
+    #ifndef OS_RWLOCK_DEL_EN
+    #error  "OS_CFG.H, Missing OS_RWLOCK_DEL_EN: Include code for OSRWLockDel()"
+    #endif
 #endif
 
 /*
@@ -1663,6 +2333,14 @@ void          OSCtxSw                 (void);
     #error  "OS_CFG.H, Missing OS_SEM_DEL_EN: Include code for OSSemDel()"
     #endif
 
+    #ifndef OS_SEM_FAST_EN
+    #error  "OS_CFG.H, Missing OS_SEM_FAST_EN: Uncontended OSSemPend()/OSSemPost() without disabling interrupts"
+    #elif   OS_SEM_FAST_EN > 0u
+        #ifndef OS_CPU_CAS16
+        #error  "OS_CPU.H, OS_SEM_FAST_EN requires the port to provide the OS_CPU_CAS16() compare-and-swap"
+        #endif
+    #endif
+
     #ifndef OS_SEM_PEND_ABORT_EN
     #error  "OS_CFG.H, Missing OS_SEM_PEND_ABORT_EN: Include code for OSSemPendAbort()"
     #endif
@@ -1715,6 +2393,19 @@ void          OSCtxSw                 (void);
 #error  "OS_CFG.H, Missing OS_TASK_STAT_STK_CHK_EN: Check task stacks from statistics task"
 #endif
 
+#ifndef OS_TASK_STAT_TS_EN
+#error  "OS_CFG.H, Missing OS_TASK_STAT_TS_EN: Compute CPU usage from task run times, not the idle ctr"
+#elif  (OS_TASK_STAT_TS_EN > 0u) && (OS_TASK_STAT_EN > 0u)
+    #if OS_TASK_PROFILE_TS_EN == 0u
+    #error  "OS_CFG.H, OS_TASK_STAT_TS_EN requires OS_TASK_PROFILE_EN and the port's OS_CPU_TS_GET()"
+    #endif
+    #ifndef OS_TASK_STAT_WINDOW
+    #error  "OS_CFG.H, Missing OS_TASK_STAT_WINDOW: Period of the run time based CPU usage"
+    #elif   OS_TASK_STAT_WINDOW == 0u
+    #error  "OS_CFG.H, OS_TASK_STAT_WINDOW must be > 0"
+    #endif
+#endif
+
 #ifndef OS_TASK_CHANGE_PRIO_EN
 #error  "OS_CFG.H, Missing OS_TASK_CHANGE_PRIO_EN: Include code for OSTaskChangePrio()"
 #endif
@@ -1747,6 +2438,27 @@ void          OSCtxSw                 (void);
 #error  "OS_CFG.H, Missing OS_TASK_QUERY_EN: Include code for OSTaskQuery()"
 #endif
 
+#ifndef OS_TASK_Q_EN
+#error  "OS_CFG.H, Missing OS_TASK_Q_EN: Include code for OSTaskQPost() and OSTaskQPend()"
+#else
+    #if     OS_TASK_Q_EN > 0u
+        #ifndef OS_TASK_Q_SIZE
+        #error  "OS_CFG.H, Missing OS_TASK_Q_SIZE: Size of each task's message queue"
+        #else
+            #if     OS_TASK_Q_SIZE == 0u
+            #error  "OS_CFG.H,         OS_TASK_Q_SIZE must be > 0"
+            #endif
+            #if     OS_TASK_Q_SIZE > 65535u
+            #error  "OS_CFG.H,         OS_TASK_Q_SIZE must be <= 65535"
+            #endif
+        #endif
+    #endif
+#endif
+
+#ifndef OS_TASK_SEM_EN
+#error  "OS_CFG.H, Missing OS_TASK_SEM_EN: Include code for OSTaskSemPost() and OSTaskSemPend()"
+#endif
+
 #ifndef OS_TASK_REG_TBL_SIZE
 #error  "OS_CFG.H, Missing OS_TASK_REG_TBL_SIZE: Include code for task specific registers"
 #else
@@ -1777,6 +2489,14 @@ void          OSCtxSw                 (void);
 #error  "OS_CFG.H, Missing OS_TIME_GET_SET_EN: Include code for OSTimeGet() and OSTimeSet()"
 #endif
 
+#ifndef OS_TICK_LIST_EN
+#error  "OS_CFG.H, Missing OS_TICK_LIST_EN: Keep delayed tasks in a sorted (delta) list"
+#endif
+
+#ifndef OS_TICKLESS_EN
+#error  "OS_CFG.H, Missing OS_TICKLESS_EN: Suppress the tick interrupt while the CPU is idle"
+#endif
+
 /*
 *********************************************************************************************************
 *                                          TIMER MANAGEMENT
@@ -1815,6 +2535,50 @@ void          OSCtxSw                 (void);
         #endif
     #endif
 
+    #ifndef OS_TMR_CFG_WHEEL_LVLS
+    #error  "OS_CFG.H, Missing OS_TMR_CFG_WHEEL_LVLS: Sets the number of levels of the timer wheel (1 .. 4)"
+    #else
+        #if OS_TMR_CFG_WHEEL_LVLS < 1u
+        #error  "OS_CFG.H, OS_TMR_CFG_WHEEL_LVLS should be between 1 and 4"
+        #endif
+
+        #if OS_TMR_CFG_WHEEL_LVLS > 4u
+        #error  "OS_CFG.H, OS_TMR_CFG_WHEEL_LVLS should be between 1 and 4"
+        #endif
+    #endif
+
+    #ifndef OS_TMR_CFG_LATE_EN
+    #error  "OS_CFG.H, Missing OS_TMR_CFG_LATE_EN: Keep per-timer expiry lateness statistics"
+    #endif
+
+    #ifndef OS_TMR_CFG_CB_DEFER_EN
+    #error  "OS_CFG.H, Missing OS_TMR_CFG_CB_DEFER_EN: Run timer callbacks after releasing the scheduler lock"
+    #endif
+
+    #ifndef OS_TMR_CFG_CB_TASKS
+    #error  "OS_CFG.H, Missing OS_TMR_CFG_CB_TASKS: Number of tasks running the timer callbacks"
+    #else
+        #if (OS_TMR_CFG_CB_TASKS > 0u) && (OS_TMR_CFG_CB_DEFER_EN == 0u)
+        #error  "OS_CFG.H, OS_TMR_CFG_CB_TASKS requires OS_TMR_CFG_CB_DEFER_EN"
+        #endif
+
+        #if (OS_TMR_CFG_CB_TASKS > 0u) && !defined(OS_TASK_TMR_CB_STK_SIZE)
+        #error  "OS_CFG.H, Missing OS_TASK_TMR_CB_STK_SIZE: Determines the size of the timer callback tasks' stacks"
+        #endif
+    #endif
+
+    #ifndef OS_TMR_CFG_TICK_EN
+    #error  "OS_CFG.H, Missing OS_TMR_CFG_TICK_EN: Process the timers in OSTimeTick() instead of the timer task"
+    #else
+        #if (OS_TMR_CFG_TICK_EN > 0u) && (OS_TMR_CFG_CB_DEFER_EN == 0u)
+        #error  "OS_CFG.H, OS_TMR_CFG_TICK_EN requires OS_TMR_CFG_CB_DEFER_EN"
+        #endif
+
+        #if (OS_TMR_CFG_TICK_EN > 0u) && !defined(OS_TMR_CFG_TICK_CB_MAX)
+        #error  "OS_CFG.H, Missing OS_TMR_CFG_TICK_CB_MAX: Max. number of timer callbacks called per tick (1 .. 255)"
+        #endif
+    #endif
+
     #ifndef OS_TMR_CFG_NAME_EN
     #error  "OS_CFG.H, Missing OS_TMR_CFG_NAME_EN: Enable Timer names"
     #endif
@@ -1874,11 +2638,46 @@ void          OSCtxSw                 (void);
 #endif
 
 
+#ifndef OS_SCHED_RR_EN
+#error  "OS_CFG.H, Missing OS_SCHED_RR_EN: Allow several tasks per priority, time sliced (round-robin)"
+#endif
+
+
 #ifndef OS_EVENT_MULTI_EN
 #error  "OS_CFG.H, Missing OS_EVENT_MULTI_EN: Include code for OSEventPendMulti()"
 #endif
 
 
+#ifndef OS_INT_DIS_MEAS_EN
+#error  "OS_CFG.H, Missing OS_INT_DIS_MEAS_EN: Measure interrupt disable and scheduler lock times"
+#elif   OS_INT_DIS_MEAS_EN > 0u
+    #ifndef OS_CPU_TS_GET
+    #error  "OS_CPU.H, OS_INT_DIS_MEAS_EN requires the port to provide the OS_CPU_TS_GET() timestamp"
+    #endif
+#endif
+
+
+#ifndef OS_ISR_POST_DEFERRED_EN
+#error  "OS_CFG.H, Missing OS_ISR_POST_DEFERRED_EN: Defer posts made from ISRs to the ISR post handler task"
+#elif   OS_ISR_POST_DEFERRED_EN > 0u
+    #ifndef OS_INT_Q_SIZE
+    #error  "OS_CFG.H, Missing OS_INT_Q_SIZE: Max. number of deferred ISR posts pending at once (2 .. 65535)"
+    #else
+        #if OS_INT_Q_SIZE < 2u
+        #error  "OS_CFG.H, OS_INT_Q_SIZE should be between 2 and 65535"
+        #endif
+
+        #if OS_INT_Q_SIZE > 65535u
+        #error  "OS_CFG.H, OS_INT_Q_SIZE should be between 2 and 65535"
+        #endif
+    #endif
+
+    #ifndef OS_TASK_INT_Q_STK_SIZE
+    #error  "OS_CFG.H, Missing OS_TASK_INT_Q_STK_SIZE: Determines the size of the ISR post handler task's stack"
+    #endif
+#endif
+
+
 #ifndef OS_TASK_PROFILE_EN
 #error  "OS_CFG.H, Missing OS_TASK_PROFILE_EN: Include data structure for run-time task profiling"
 #endif
@@ -0,0 +1,486 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-II
+*                                        The Real-Time Kernel
+*
+*                    Copyright 1992-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*
+*                                     BINARY TRACE RECORDER DECODER
+*
+* Filename : os_trace_dec.c
+* Version  : V2.93.01
+*********************************************************************************************************
+* Note(s) : (1) This is a HOST program.  It converts a dump of the recording buffer of the trace recorder
+*               (see os_trace_events.h) into a readable timeline, one line per record:
+*
+*                   cc -I.. -o os_trace_dec os_trace_dec.c
+*                   os_trace_dec dump.bin
+*
+*           (2) The dump can be the content of OSTraceRecBuf or an image of the whole RAM: the recording
+*               buffer is located by its magic number, which also gives the byte order of the target.
+*
+*           (3) Times are relative to the oldest record found in the buffer.  They are shown in
+*               microseconds if the frequency of the timestamp was configured (OS_TRACE_REC_CFG_TS_FREQ),
+*               in timestamp counts otherwise.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  "os_trace_rec_evt.h"
+
+
+/*
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  enum  os_trace_dec_kind {                      /* How the arguments of an event are displayed    */
+    K_NONE = 0,
+    K_NEST,
+    K_ISR_REG,
+    K_ISR_ID,
+    K_TICK,
+    K_DLY,
+    K_TCB,
+    K_TCB_PRIO,
+    K_NAME,
+    K_OBJ,
+    K_OBJ_OPT,
+    K_OBJ_TO,
+    K_OBJ_FLAGS,
+    K_OBJ_BLK,
+    K_RET
+} OS_TRACE_DEC_KIND;
+
+
+typedef  struct  os_trace_dec_evt {
+    unsigned            Code;
+    const char         *Name;
+    OS_TRACE_DEC_KIND   Kind;
+} OS_TRACE_DEC_EVT;
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL TABLES
+*********************************************************************************************************
+*/
+
+#define  OS_TRACE_DEC_EVT(name, kind)   { OS_TRACE_REC_EVT_##name, #name, kind }
+
+static  const  OS_TRACE_DEC_EVT  OS_TraceDecEvtTbl[] = {
+    OS_TRACE_DEC_EVT(NONE,                        K_NONE),
+    OS_TRACE_DEC_EVT(START,                       K_NONE),
+    OS_TRACE_DEC_EVT(ISR_ENTER,                   K_NEST),
+    OS_TRACE_DEC_EVT(ISR_EXIT,                    K_NEST),
+    OS_TRACE_DEC_EVT(ISR_EXIT_TO_SCHEDULER,       K_NEST),
+    OS_TRACE_DEC_EVT(ISR_REGISTER,                K_ISR_REG),
+    OS_TRACE_DEC_EVT(ISR_BEGIN,                   K_ISR_ID),
+    OS_TRACE_DEC_EVT(ISR_END,                     K_NONE),
+    OS_TRACE_DEC_EVT(TICK_INCREMENT,              K_TICK),
+    OS_TRACE_DEC_EVT(TASK_CREATE,                 K_TCB),
+    OS_TRACE_DEC_EVT(TASK_CREATE_FAILED,          K_OBJ),
+    OS_TRACE_DEC_EVT(TASK_DEL,                    K_TCB),
+    OS_TRACE_DEC_EVT(TASK_READY,                  K_TCB),
+    OS_TRACE_DEC_EVT(TASK_SWITCHED_IN,            K_TCB),
+    OS_TRACE_DEC_EVT(TASK_DLY,                    K_DLY),
+    OS_TRACE_DEC_EVT(TASK_SUSPEND,                K_TCB),
+    OS_TRACE_DEC_EVT(TASK_SUSPENDED,              K_TCB),
+    OS_TRACE_DEC_EVT(TASK_RESUME,                 K_TCB),
+    OS_TRACE_DEC_EVT(TASK_PRIO_CHANGE,            K_TCB_PRIO),
+    OS_TRACE_DEC_EVT(TASK_NAME_SET,               K_TCB),
+    OS_TRACE_DEC_EVT(EVENT_NAME_SET,              K_NAME),
+    OS_TRACE_DEC_EVT(MBOX_CREATE,                 K_OBJ),
+    OS_TRACE_DEC_EVT(MUTEX_CREATE,                K_OBJ),
+    OS_TRACE_DEC_EVT(MUTEX_DEL,                   K_OBJ),
+    OS_TRACE_DEC_EVT(MUTEX_POST,                  K_OBJ),
+    OS_TRACE_DEC_EVT(MUTEX_POST_FAILED,           K_OBJ),
+    OS_TRACE_DEC_EVT(MUTEX_PEND,                  K_OBJ),
+    OS_TRACE_DEC_EVT(MUTEX_PEND_FAILED,           K_OBJ),
+    OS_TRACE_DEC_EVT(MUTEX_PEND_BLOCK,            K_OBJ),
+    OS_TRACE_DEC_EVT(MUTEX_TASK_PRIO_INHERIT,     K_TCB_PRIO),
+    OS_TRACE_DEC_EVT(MUTEX_TASK_PRIO_DISINHERIT,  K_TCB_PRIO),
+    OS_TRACE_DEC_EVT(SEM_CREATE,                  K_OBJ),
+    OS_TRACE_DEC_EVT(SEM_DEL,                     K_OBJ),
+    OS_TRACE_DEC_EVT(SEM_POST,                    K_OBJ),
+    OS_TRACE_DEC_EVT(SEM_POST_FAILED,             K_OBJ),
+    OS_TRACE_DEC_EVT(SEM_PEND,                    K_OBJ),
+    OS_TRACE_DEC_EVT(SEM_PEND_FAILED,             K_OBJ),
+    OS_TRACE_DEC_EVT(SEM_PEND_BLOCK,              K_OBJ),
+    OS_TRACE_DEC_EVT(Q_CREATE,                    K_OBJ),
+    OS_TRACE_DEC_EVT(Q_DEL,                       K_OBJ),
+    OS_TRACE_DEC_EVT(Q_POST,                      K_OBJ),
+    OS_TRACE_DEC_EVT(Q_POST_FAILED,               K_OBJ),
+    OS_TRACE_DEC_EVT(Q_PEND,                      K_OBJ),
+    OS_TRACE_DEC_EVT(Q_PEND_FAILED,               K_OBJ),
+    OS_TRACE_DEC_EVT(Q_PEND_BLOCK,                K_OBJ),
+    OS_TRACE_DEC_EVT(FLAG_CREATE,                 K_OBJ),
+    OS_TRACE_DEC_EVT(FLAG_DEL,                    K_OBJ),
+    OS_TRACE_DEC_EVT(FLAG_POST,                   K_OBJ),
+    OS_TRACE_DEC_EVT(FLAG_POST_FAILED,            K_OBJ),
+    OS_TRACE_DEC_EVT(FLAG_PEND,                   K_OBJ),
+    OS_TRACE_DEC_EVT(FLAG_PEND_FAILED,            K_OBJ),
+    OS_TRACE_DEC_EVT(FLAG_PEND_BLOCK,             K_OBJ),
+    OS_TRACE_DEC_EVT(MEM_CREATE,                  K_OBJ),
+    OS_TRACE_DEC_EVT(MEM_PUT,                     K_OBJ),
+    OS_TRACE_DEC_EVT(MEM_PUT_FAILED,              K_OBJ),
+    OS_TRACE_DEC_EVT(MEM_GET,                     K_OBJ),
+    OS_TRACE_DEC_EVT(MEM_GET_FAILED,              K_OBJ),
+    OS_TRACE_DEC_EVT(TMR_CREATE,                  K_OBJ),
+    OS_TRACE_DEC_EVT(MBOX_DEL_ENTER,              K_OBJ_OPT),
+    OS_TRACE_DEC_EVT(MBOX_POST_ENTER,             K_OBJ),
+    OS_TRACE_DEC_EVT(MBOX_POST_OPT_ENTER,         K_OBJ_OPT),
+    OS_TRACE_DEC_EVT(MBOX_PEND_ENTER,             K_OBJ_TO),
+    OS_TRACE_DEC_EVT(MUTEX_DEL_ENTER,             K_OBJ_OPT),
+    OS_TRACE_DEC_EVT(MUTEX_POST_ENTER,            K_OBJ),
+    OS_TRACE_DEC_EVT(MUTEX_PEND_ENTER,            K_OBJ_TO),
+    OS_TRACE_DEC_EVT(SEM_DEL_ENTER,               K_OBJ_OPT),
+    OS_TRACE_DEC_EVT(SEM_POST_ENTER,              K_OBJ),
+    OS_TRACE_DEC_EVT(SEM_PEND_ENTER,              K_OBJ_TO),
+    OS_TRACE_DEC_EVT(Q_DEL_ENTER,                 K_OBJ_OPT),
+    OS_TRACE_DEC_EVT(Q_POST_ENTER,                K_OBJ),
+    OS_TRACE_DEC_EVT(Q_POST_FRONT_ENTER,          K_OBJ),
+    OS_TRACE_DEC_EVT(Q_POST_OPT_ENTER,            K_OBJ_OPT),
+    OS_TRACE_DEC_EVT(Q_PEND_ENTER,                K_OBJ_TO),
+    OS_TRACE_DEC_EVT(FLAG_DEL_ENTER,              K_OBJ_OPT),
+    OS_TRACE_DEC_EVT(TMR_DEL_ENTER,               K_OBJ),
+    OS_TRACE_DEC_EVT(TMR_START_ENTER,             K_OBJ),
+    OS_TRACE_DEC_EVT(TMR_STOP_ENTER,              K_OBJ),
+    OS_TRACE_DEC_EVT(TMR_EXPIRED,                 K_OBJ),
+    OS_TRACE_DEC_EVT(FLAG_POST_ENTER,             K_OBJ_FLAGS),
+    OS_TRACE_DEC_EVT(FLAG_PEND_ENTER,             K_OBJ_FLAGS),
+    OS_TRACE_DEC_EVT(MEM_PUT_ENTER,               K_OBJ_BLK),
+    OS_TRACE_DEC_EVT(MEM_GET_ENTER,               K_OBJ),
+    OS_TRACE_DEC_EVT(MBOX_DEL_EXIT,               K_RET),
+    OS_TRACE_DEC_EVT(MBOX_POST_EXIT,              K_RET),
+    OS_TRACE_DEC_EVT(MBOX_POST_OPT_EXIT,          K_RET),
+    OS_TRACE_DEC_EVT(MBOX_PEND_EXIT,              K_RET),
+    OS_TRACE_DEC_EVT(MUTEX_DEL_EXIT,              K_RET),
+    OS_TRACE_DEC_EVT(MUTEX_POST_EXIT,             K_RET),
+    OS_TRACE_DEC_EVT(MUTEX_PEND_EXIT,             K_RET),
+    OS_TRACE_DEC_EVT(SEM_DEL_EXIT,                K_RET),
+    OS_TRACE_DEC_EVT(SEM_POST_EXIT,               K_RET),
+    OS_TRACE_DEC_EVT(SEM_PEND_EXIT,               K_RET),
+    OS_TRACE_DEC_EVT(Q_DEL_EXIT,                  K_RET),
+    OS_TRACE_DEC_EVT(Q_POST_EXIT,                 K_RET),
+    OS_TRACE_DEC_EVT(Q_POST_FRONT_EXIT,           K_RET),
+    OS_TRACE_DEC_EVT(Q_POST_OPT_EXIT,             K_RET),
+    OS_TRACE_DEC_EVT(Q_PEND_EXIT,                 K_RET),
+    OS_TRACE_DEC_EVT(FLAG_DEL_EXIT,               K_RET),
+    OS_TRACE_DEC_EVT(FLAG_POST_EXIT,              K_RET),
+    OS_TRACE_DEC_EVT(FLAG_PEND_EXIT,              K_RET),
+    OS_TRACE_DEC_EVT(MEM_PUT_EXIT,                K_RET),
+    OS_TRACE_DEC_EVT(MEM_GET_EXIT,                K_RET),
+    OS_TRACE_DEC_EVT(TMR_DEL_EXIT,                K_RET),
+    OS_TRACE_DEC_EVT(TMR_START_EXIT,              K_RET),
+    OS_TRACE_DEC_EVT(TMR_STOP_EXIT,               K_RET),
+};
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  unsigned long            OS_TraceDecRd32  (const unsigned char *p, int swap);
+
+static  unsigned                 OS_TraceDecRd16  (const unsigned char *p, int swap);
+
+static  const  OS_TRACE_DEC_EVT *OS_TraceDecEvtGet(unsigned code);
+
+static  long                     OS_TraceDecFind  (const unsigned char *p_dump, long size, int *p_swap);
+
+static  void                     OS_TraceDecRec   (const unsigned char *p_rec, int swap, double time, int us);
+
+
+/*
+*********************************************************************************************************
+*                                                main()
+*********************************************************************************************************
+*/
+
+int  main (int argc, char *argv[])
+{
+    FILE           *p_file;
+    unsigned char  *p_dump;
+    long            size;
+    long            ix;
+    int             swap;
+    unsigned long   nbr_recs;
+    unsigned long   wr_ctr;
+    unsigned long   drop_ctr;
+    unsigned long   ts_freq;
+    unsigned long   nbr;
+    unsigned long   first;
+    unsigned long   i;
+    const unsigned char *p_rec;
+    double          time;
+
+
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <dump file>\n", argv[0]);
+        return (2);
+    }
+    p_file = fopen(argv[1], "rb");
+    if (p_file == NULL) {
+        perror(argv[1]);
+        return (1);
+    }
+    fseek(p_file, 0L, SEEK_END);
+    size = ftell(p_file);
+    fseek(p_file, 0L, SEEK_SET);
+    p_dump = (unsigned char *)malloc((size_t)size + 1u);
+    if ((p_dump == NULL) ||
+        (fread(p_dump, 1u, (size_t)size, p_file) != (size_t)size)) {
+        fprintf(stderr, "%s: read error\n", argv[1]);
+        fclose(p_file);
+        return (1);
+    }
+    fclose(p_file);
+
+    ix = OS_TraceDecFind(p_dump, size, &swap);              /* See Note #2                              */
+    if (ix < 0) {
+        fprintf(stderr, "%s: no trace recorder buffer found\n", argv[1]);
+        free(p_dump);
+        return (1);
+    }
+
+    nbr_recs = OS_TraceDecRd32(&p_dump[ix +  8], swap);
+    wr_ctr   = OS_TraceDecRd32(&p_dump[ix + 12], swap);
+    drop_ctr = OS_TraceDecRd32(&p_dump[ix + 16], swap);
+    ts_freq  = OS_TraceDecRd32(&p_dump[ix + 24], swap);
+
+    nbr      = (wr_ctr < nbr_recs) ? wr_ctr : nbr_recs;    /* Records still in the ring                */
+    first    = wr_ctr - nbr;
+
+    printf("# buffer at offset 0x%lx (%s endian), %lu records of %lu kept, %lu overwritten, %lu dropped\n",
+           (unsigned long)ix, (swap != 0) ? "swapped" : "host",
+           nbr, nbr_recs, wr_ctr - nbr, drop_ctr);
+    printf("# %14s  %-5s  %-28s  %s\n", (ts_freq != 0u) ? "time (us)" : "time (counts)", "ctx", "event", "arguments");
+
+    time = 0.0;
+    for (i = 0u; i < nbr; i++) {
+        p_rec = &p_dump[ix + OS_TRACE_REC_HDR_SIZE + (((first + i) & (nbr_recs - 1u)) * OS_TRACE_REC_SIZE)];
+        if (i > 0u) {                                       /* See Note #3                              */
+            time += (double)OS_TraceDecRd32(&p_rec[0], swap);
+        }
+        OS_TraceDecRec(p_rec, swap, (ts_freq != 0u) ? (time * 1000000.0 / (double)ts_freq) : time, ts_freq != 0u);
+    }
+
+    free(p_dump);
+    return (0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      READ A FIELD OF THE DUMP
+*
+* Description: These functions read a 32-bit or a 16-bit field stored in the byte order of the host, or
+*              in the opposite byte order when 'swap' is not 0.
+*********************************************************************************************************
+*/
+
+static  unsigned long  OS_TraceDecRd32 (const unsigned char *p, int swap)
+{
+    unsigned long  val;
+    unsigned long  one = 1u;
+    int            little;
+
+
+    little = (*(unsigned char *)&one == 1u);
+    if (little != (swap != 0)) {
+        val = (unsigned long)p[0] | ((unsigned long)p[1] << 8) | ((unsigned long)p[2] << 16) | ((unsigned long)p[3] << 24);
+    } else {
+        val = (unsigned long)p[3] | ((unsigned long)p[2] << 8) | ((unsigned long)p[1] << 16) | ((unsigned long)p[0] << 24);
+    }
+    return (val);
+}
+
+
+static  unsigned  OS_TraceDecRd16 (const unsigned char *p, int swap)
+{
+    unsigned long  one = 1u;
+    int            little;
+
+
+    little = (*(unsigned char *)&one == 1u);
+    if (little != (swap != 0)) {
+        return ((unsigned)p[0] | ((unsigned)p[1] << 8));
+    }
+    return ((unsigned)p[1] | ((unsigned)p[0] << 8));
+}
+
+
+/*
+*********************************************************************************************************
+*                                       LOCATE THE RECORDING BUFFER
+*
+* Description: This function looks for the magic number of the recording buffer, in both byte orders, and
+*              checks that the header is consistent.
+*
+* Returns    : the offset of the buffer in the dump, -1 if not found.
+*********************************************************************************************************
+*/
+
+static  long  OS_TraceDecFind (const unsigned char *p_dump, long size, int *p_swap)
+{
+    long           ix;
+    int            swap;
+    unsigned long  nbr_recs;
+
+
+    for (ix = 0; (ix + (long)OS_TRACE_REC_HDR_SIZE) <= size; ix += 4) {
+        for (swap = 0; swap < 2; swap++) {
+            if (OS_TraceDecRd32(&p_dump[ix], swap) != OS_TRACE_REC_MAGIC) {
+                continue;
+            }
+            nbr_recs = OS_TraceDecRd32(&p_dump[ix + 8], swap);
+            if ((OS_TraceDecRd16(&p_dump[ix + 4], swap) != OS_TRACE_REC_SIZE) ||
+                (nbr_recs == 0u) || ((nbr_recs & (nbr_recs - 1u)) != 0u)) {
+                continue;
+            }
+            if ((unsigned long)(size - ix) < (OS_TRACE_REC_HDR_SIZE + (nbr_recs * OS_TRACE_REC_SIZE))) {
+                continue;                                   /* Truncated dump                           */
+            }
+            *p_swap = swap;
+            return (ix);
+        }
+    }
+    return (-1);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          PRINT ONE RECORD
+*********************************************************************************************************
+*/
+
+static  const  OS_TRACE_DEC_EVT  *OS_TraceDecEvtGet (unsigned code)
+{
+    unsigned  i;
+
+
+    for (i = 0u; i < (sizeof(OS_TraceDecEvtTbl) / sizeof(OS_TraceDecEvtTbl[0])); i++) {
+        if (OS_TraceDecEvtTbl[i].Code == code) {
+            return (&OS_TraceDecEvtTbl[i]);
+        }
+    }
+    return (NULL);
+}
+
+
+static  void  OS_TraceDecRec (const unsigned char *p_rec, int swap, double time, int us)
+{
+    const OS_TRACE_DEC_EVT  *p_evt;
+    unsigned                 code;
+    unsigned                 ctx;
+    unsigned                 arg16;
+    unsigned long            arg0;
+    unsigned long            arg1;
+    char                     ctx_str[8];
+
+
+    code  = p_rec[4];
+    ctx   = p_rec[5];
+    arg16 = OS_TraceDecRd16(&p_rec[6],  swap);
+    arg0  = OS_TraceDecRd32(&p_rec[8],  swap);
+    arg1  = OS_TraceDecRd32(&p_rec[12], swap);
+
+    if (ctx == OS_TRACE_REC_CTX_ISR) {
+        sprintf(ctx_str, "ISR");
+    } else {
+        sprintf(ctx_str, "T%u", ctx);
+    }
+    if (us != 0) {
+        printf("%16.3f  %-5s  ", time, ctx_str);
+    } else {
+        printf("%16.0f  %-5s  ", time, ctx_str);
+    }
+
+    p_evt = OS_TraceDecEvtGet(code);
+    if (p_evt == NULL) {
+        printf("%-28s  code=%u arg16=%u arg0=0x%08lx arg1=0x%08lx\n", "?", code, arg16, arg0, arg1);
+        return;
+    }
+    printf((p_evt->Kind != K_NONE) ? "%-28s" : "%s", p_evt->Name);
+    switch (p_evt->Kind) {
+        case K_NEST:
+             printf("  nesting=%u", arg16);
+             break;
+
+        case K_ISR_REG:
+             printf("  id=%lu prio=%u name=0x%08lx", arg0, arg16, arg1);
+             break;
+
+        case K_ISR_ID:
+             printf("  id=%lu", arg0);
+             break;
+
+        case K_TICK:
+             printf("  tick=%lu", arg0);
+             break;
+
+        case K_DLY:
+             printf("  ticks=%lu", arg0);
+             break;
+
+        case K_TCB:
+             printf("  prio=%u tcb=0x%08lx", arg16, arg0);
+             break;
+
+        case K_TCB_PRIO:
+             printf("  prio=%u tcb=0x%08lx new_prio=%lu", arg16, arg0, arg1);
+             break;
+
+        case K_NAME:
+             printf("  obj=0x%08lx name=0x%08lx", arg0, arg1);
+             break;
+
+        case K_OBJ:
+             printf("  obj=0x%08lx", arg0);
+             break;
+
+        case K_OBJ_OPT:
+             printf("  obj=0x%08lx opt=%u", arg0, arg16);
+             break;
+
+        case K_OBJ_TO:
+             printf("  obj=0x%08lx timeout=%lu", arg0, arg1);
+             break;
+
+        case K_OBJ_FLAGS:
+             printf("  obj=0x%08lx flags=0x%08lx opt=%u", arg0, arg1, arg16);
+             break;
+
+        case K_OBJ_BLK:
+             printf("  obj=0x%08lx blk=0x%08lx", arg0, arg1);
+             break;
+
+        case K_RET:
+             printf("  err=%u", arg16);
+             break;
+
+        case K_NONE:
+        default:
+             break;
+    }
+    printf("\n");
+}
@@ -0,0 +1,327 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-II
+*                                        The Real-Time Kernel
+*
+*                    Copyright 1992-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*
+*                                        BINARY TRACE RECORDER
+*
+* Filename : os_trace_events.h
+* Version  : V2.93.01
+*********************************************************************************************************
+* Note(s) : (1) This recorder encodes the OS_TRACE_xxx() events of uC/OS-II (see os_trace.h) into fixed
+*               size binary records kept in a RAM ring buffer, OSTraceRecBuf.  To use it:
+*
+*               (a) Set OS_TRACE_EN to 1 in os_cfg.h.  OS_TRACE_API_ENTER_EN and OS_TRACE_API_EXIT_EN
+*                   select whether the entry and the exit of the kernel services are recorded too.
+*               (b) Add this folder to the include path and os_trace_rec.c to the project.
+*               (c) Call OS_TRACE_INIT() after OSInit() and OS_TRACE_START() to start recording.
+*               (d) Dump OSTraceRecBuf (or the whole RAM) and convert it to a timeline on the host with
+*                   Decoder/os_trace_dec.c.
+*
+*           (2) The recorder can be configured from app_cfg.h:
+*
+*               OS_TRACE_REC_CFG_NBR_RECS      Number of records in the ring buffer, MUST be a power of 2.
+*               OS_TRACE_REC_CFG_POLICY        OS_TRACE_REC_POLICY_OVERWRITE to keep the newest records or
+*                                              OS_TRACE_REC_POLICY_STOP to keep the oldest ones.
+*               OS_TRACE_REC_CFG_TS_FREQ       Frequency of the timestamp (Hz), stored in the buffer for
+*                                              the decoder.  0 if unknown.
+*               OS_TRACE_REC_CFG_ADDR_TYPE     Unsigned integer type as wide as a pointer.
+*               OS_TRACE_REC_TS_GET()          Timestamp, OS_CPU_TS_GET() by default.
+*
+*           (3) Object and task control block addresses are recorded on 32 bits.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_TRACE_EVENTS_H
+#define  OS_TRACE_EVENTS_H
+
+#include  "os_trace_rec_evt.h"
+
+
+/*
+*********************************************************************************************************
+*                                         DEFAULT CONFIGURATION
+*********************************************************************************************************
+*/
+
+#ifndef  OS_TRACE_REC_CFG_NBR_RECS
+#define  OS_TRACE_REC_CFG_NBR_RECS              256u
+#endif
+
+#ifndef  OS_TRACE_REC_CFG_POLICY
+#define  OS_TRACE_REC_CFG_POLICY                OS_TRACE_REC_POLICY_OVERWRITE
+#endif
+
+#ifndef  OS_TRACE_REC_CFG_TS_FREQ
+#define  OS_TRACE_REC_CFG_TS_FREQ               0u
+#endif
+
+#ifndef  OS_TRACE_REC_CFG_ADDR_TYPE
+#define  OS_TRACE_REC_CFG_ADDR_TYPE             unsigned  long
+#endif
+
+#ifndef  OS_TRACE_REC_TS_GET
+#ifdef   OS_CPU_TS_GET
+#define  OS_TRACE_REC_TS_GET()                  OS_CPU_TS_GET()
+#endif
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                              DATA TYPES
+*
+* Note(s) : (1) The layout of OS_TRACE_REC and OS_TRACE_REC_BUF is decoded by Decoder/os_trace_dec.c and
+*               MUST match OS_TRACE_REC_SIZE and OS_TRACE_REC_HDR_SIZE (see os_trace_rec_evt.h).
+*********************************************************************************************************
+*/
+
+typedef  struct  os_trace_rec {
+    INT32U        TSDelta;                      /* Timestamp counts elapsed since the previous record  */
+    INT8U         Evt;                          /* Event code (OS_TRACE_REC_EVT_xxx)                   */
+    INT8U         Ctx;                          /* Prio. of the running task or OS_TRACE_REC_CTX_ISR   */
+    INT16U        Arg16;                        /* Priority, option or error code                      */
+    INT32U        Arg0;                         /* Address of the task or kernel object, tick counter  */
+    INT32U        Arg1;                         /* Second argument (timeout, flags, new priority, ...) */
+} OS_TRACE_REC;
+
+
+typedef  struct  os_trace_rec_buf {
+    INT32U        Magic;                        /* OS_TRACE_REC_MAGIC once initialized                 */
+    INT16U        RecSize;                      /* OS_TRACE_REC_SIZE                                   */
+    INT16U        Policy;                       /* OS_TRACE_REC_POLICY_xxx                             */
+    INT32U        NbrRecs;                      /* Number of records in the ring, a power of 2         */
+    INT32U        WrCtr;                        /* Nbr of records written since the last clear         */
+    INT32U        DropCtr;                      /* Nbr of records lost because the buffer was full     */
+    INT32U        TSPrev;                       /* Timestamp of the last record                        */
+    INT32U        TSFreq;                       /* Frequency of the timestamp (Hz), 0 if unknown       */
+    INT32U        Running;                      /* Records are being made                              */
+    OS_TRACE_REC  Recs[OS_TRACE_REC_CFG_NBR_RECS];
+} OS_TRACE_REC_BUF;
+
+
+/*
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+extern  OS_TRACE_REC_BUF  OSTraceRecBuf;
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void  OSTraceRecInit  (void);
+
+void  OSTraceRecStart (void);
+
+void  OSTraceRecStop  (void);
+
+void  OSTraceRecClear (void);
+
+void  OS_TraceRecEvt  (INT8U   evt,
+                       INT16U  arg16,
+                       INT32U  arg0,
+                       INT32U  arg1);
+
+
+/*
+*********************************************************************************************************
+*                                          RECORDING MACROS
+*********************************************************************************************************
+*/
+
+#define  OS_TRACE_REC_ADDR(p)                   ((INT32U)(OS_TRACE_REC_CFG_ADDR_TYPE)(p))
+
+#define  OS_TRACE_REC_ARG(evt, arg16, arg0, arg1)  OS_TraceRecEvt((INT8U)(OS_TRACE_REC_EVT_##evt), (INT16U)(arg16), (INT32U)(arg0), (INT32U)(arg1))
+
+#define  OS_TRACE_REC_TCB(evt, p_tcb)           OS_TRACE_REC_ARG(evt, (p_tcb)->OSTCBPrio, OS_TRACE_REC_ADDR(p_tcb), 0u)
+
+#define  OS_TRACE_REC_OBJ(evt, p_obj)           OS_TRACE_REC_ARG(evt, 0u, OS_TRACE_REC_ADDR(p_obj), 0u)
+
+#define  OS_TRACE_REC_RET(evt, ret)             OS_TRACE_REC_ARG(evt, (ret), 0u, 0u)
+
+
+/*
+*********************************************************************************************************
+*                                           uC/OS-II EVENTS
+*********************************************************************************************************
+*/
+
+#define  OS_TRACE_INIT()                                        OSTraceRecInit()
+#define  OS_TRACE_START()                                       OSTraceRecStart()
+#define  OS_TRACE_STOP()                                        OSTraceRecStop()
+#define  OS_TRACE_CLEAR()                                       OSTraceRecClear()
+
+#define  OS_TRACE_ISR_ENTER()                                   OS_TRACE_REC_ARG(ISR_ENTER, OSIntNesting, 0u, 0u)
+#define  OS_TRACE_ISR_EXIT()                                    OS_TRACE_REC_ARG(ISR_EXIT, OSIntNesting, 0u, 0u)
+#define  OS_TRACE_ISR_EXIT_TO_SCHEDULER()                       OS_TRACE_REC_ARG(ISR_EXIT_TO_SCHEDULER, OSIntNesting, 0u, 0u)
+#define  OS_TRACE_ISR_REGISTER(isr_id, isr_name, isr_prio)      OS_TRACE_REC_ARG(ISR_REGISTER, isr_prio, isr_id, OS_TRACE_REC_ADDR(isr_name))
+#define  OS_TRACE_ISR_BEGIN(isr_id)                             OS_TRACE_REC_ARG(ISR_BEGIN, 0u, isr_id, 0u)
+#define  OS_TRACE_ISR_END()                                     OS_TRACE_REC_ARG(ISR_END, 0u, 0u, 0u)
+
+#define  OS_TRACE_TICK_INCREMENT(OSTickCtr)                     OS_TRACE_REC_ARG(TICK_INCREMENT, 0u, OSTickCtr, 0u)
+
+#define  OS_TRACE_TASK_CREATE(p_tcb)                            OS_TRACE_REC_TCB(TASK_CREATE, p_tcb)
+#define  OS_TRACE_TASK_CREATE_FAILED(p_tcb)                     OS_TRACE_REC_OBJ(TASK_CREATE_FAILED, p_tcb)
+#define  OS_TRACE_TASK_DEL(p_tcb)                               OS_TRACE_REC_TCB(TASK_DEL, p_tcb)
+#define  OS_TRACE_TASK_READY(p_tcb)                             OS_TRACE_REC_TCB(TASK_READY, p_tcb)
+#define  OS_TRACE_TASK_SWITCHED_IN(p_tcb)                       OS_TRACE_REC_TCB(TASK_SWITCHED_IN, p_tcb)
+#define  OS_TRACE_TASK_DLY(dly_ticks)                           OS_TRACE_REC_ARG(TASK_DLY, 0u, dly_ticks, 0u)
+#define  OS_TRACE_TASK_SUSPEND(p_tcb)                           OS_TRACE_REC_TCB(TASK_SUSPEND, p_tcb)
+#define  OS_TRACE_TASK_SUSPENDED(p_tcb)                         OS_TRACE_REC_TCB(TASK_SUSPENDED, p_tcb)
+#define  OS_TRACE_TASK_RESUME(p_tcb)                            OS_TRACE_REC_TCB(TASK_RESUME, p_tcb)
+#define  OS_TRACE_TASK_PRIO_CHANGE(p_tcb, prio)                 OS_TRACE_REC_ARG(TASK_PRIO_CHANGE, (p_tcb)->OSTCBPrio, OS_TRACE_REC_ADDR(p_tcb), prio)
+#define  OS_TRACE_TASK_NAME_SET(p_tcb)                          OS_TRACE_REC_TCB(TASK_NAME_SET, p_tcb)
+#define  OS_TRACE_EVENT_NAME_SET(p_event, p_name)               OS_TRACE_REC_ARG(EVENT_NAME_SET, 0u, OS_TRACE_REC_ADDR(p_event), OS_TRACE_REC_ADDR(p_name))
+
+#define  OS_TRACE_MBOX_CREATE(p_mbox, p_name)                   OS_TRACE_REC_OBJ(MBOX_CREATE, p_mbox)
+
+#define  OS_TRACE_MUTEX_CREATE(p_mutex, p_name)                 OS_TRACE_REC_OBJ(MUTEX_CREATE, p_mutex)
+#define  OS_TRACE_MUTEX_DEL(p_mutex)                            OS_TRACE_REC_OBJ(MUTEX_DEL, p_mutex)
+#define  OS_TRACE_MUTEX_POST(p_mutex)                           OS_TRACE_REC_OBJ(MUTEX_POST, p_mutex)
+#define  OS_TRACE_MUTEX_POST_FAILED(p_mutex)                    OS_TRACE_REC_OBJ(MUTEX_POST_FAILED, p_mutex)
+#define  OS_TRACE_MUTEX_PEND(p_mutex)                           OS_TRACE_REC_OBJ(MUTEX_PEND, p_mutex)
+#define  OS_TRACE_MUTEX_PEND_FAILED(p_mutex)                    OS_TRACE_REC_OBJ(MUTEX_PEND_FAILED, p_mutex)
+#define  OS_TRACE_MUTEX_PEND_BLOCK(p_mutex)                     OS_TRACE_REC_OBJ(MUTEX_PEND_BLOCK, p_mutex)
+#define  OS_TRACE_MUTEX_TASK_PRIO_INHERIT(p_tcb, prio)          OS_TRACE_REC_ARG(MUTEX_TASK_PRIO_INHERIT, (p_tcb)->OSTCBPrio, OS_TRACE_REC_ADDR(p_tcb), prio)
+#define  OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb, prio)       OS_TRACE_REC_ARG(MUTEX_TASK_PRIO_DISINHERIT, (p_tcb)->OSTCBPrio, OS_TRACE_REC_ADDR(p_tcb), prio)
+
+#define  OS_TRACE_SEM_CREATE(p_sem, p_name)                     OS_TRACE_REC_OBJ(SEM_CREATE, p_sem)
+#define  OS_TRACE_SEM_DEL(p_sem)                                OS_TRACE_REC_OBJ(SEM_DEL, p_sem)
+#define  OS_TRACE_SEM_POST(p_sem)                               OS_TRACE_REC_OBJ(SEM_POST, p_sem)
+#define  OS_TRACE_SEM_POST_FAILED(p_sem)                        OS_TRACE_REC_OBJ(SEM_POST_FAILED, p_sem)
+#define  OS_TRACE_SEM_PEND(p_sem)                               OS_TRACE_REC_OBJ(SEM_PEND, p_sem)
+#define  OS_TRACE_SEM_PEND_FAILED(p_sem)                        OS_TRACE_REC_OBJ(SEM_PEND_FAILED, p_sem)
+#define  OS_TRACE_SEM_PEND_BLOCK(p_sem)                         OS_TRACE_REC_OBJ(SEM_PEND_BLOCK, p_sem)
+
+#define  OS_TRACE_Q_CREATE(p_q, p_name)                         OS_TRACE_REC_OBJ(Q_CREATE, p_q)
+#define  OS_TRACE_Q_DEL(p_q)                                    OS_TRACE_REC_OBJ(Q_DEL, p_q)
+#define  OS_TRACE_Q_POST(p_q)                                   OS_TRACE_REC_OBJ(Q_POST, p_q)
+#define  OS_TRACE_Q_POST_FAILED(p_q)                            OS_TRACE_REC_OBJ(Q_POST_FAILED, p_q)
+#define  OS_TRACE_Q_PEND(p_q)                                   OS_TRACE_REC_OBJ(Q_PEND, p_q)
+#define  OS_TRACE_Q_PEND_FAILED(p_q)                            OS_TRACE_REC_OBJ(Q_PEND_FAILED, p_q)
+#define  OS_TRACE_Q_PEND_BLOCK(p_q)                             OS_TRACE_REC_OBJ(Q_PEND_BLOCK, p_q)
+
+#define  OS_TRACE_FLAG_CREATE(p_grp, p_name)                    OS_TRACE_REC_OBJ(FLAG_CREATE, p_grp)
+#define  OS_TRACE_FLAG_DEL(p_grp)                               OS_TRACE_REC_OBJ(FLAG_DEL, p_grp)
+#define  OS_TRACE_FLAG_POST(p_grp)                              OS_TRACE_REC_OBJ(FLAG_POST, p_grp)
+#define  OS_TRACE_FLAG_POST_FAILED(p_grp)                       OS_TRACE_REC_OBJ(FLAG_POST_FAILED, p_grp)
+#define  OS_TRACE_FLAG_PEND(p_grp)                              OS_TRACE_REC_OBJ(FLAG_PEND, p_grp)
+#define  OS_TRACE_FLAG_PEND_FAILED(p_grp)                       OS_TRACE_REC_OBJ(FLAG_PEND_FAILED, p_grp)
+#define  OS_TRACE_FLAG_PEND_BLOCK(p_grp)                        OS_TRACE_REC_OBJ(FLAG_PEND_BLOCK, p_grp)
+
+#define  OS_TRACE_MEM_CREATE(p_mem)                             OS_TRACE_REC_OBJ(MEM_CREATE, p_mem)
+#define  OS_TRACE_MEM_PUT(p_mem)                                OS_TRACE_REC_OBJ(MEM_PUT, p_mem)
+#define  OS_TRACE_MEM_PUT_FAILED(p_mem)                         OS_TRACE_REC_OBJ(MEM_PUT_FAILED, p_mem)
+#define  OS_TRACE_MEM_GET(p_mem)                                OS_TRACE_REC_OBJ(MEM_GET, p_mem)
+#define  OS_TRACE_MEM_GET_FAILED(p_mem)                         OS_TRACE_REC_OBJ(MEM_GET_FAILED, p_mem)
+
+#define  OS_TRACE_TMR_CREATE(p_tmr, p_name)                     OS_TRACE_REC_OBJ(TMR_CREATE, p_tmr)
+#define  OS_TRACE_TMR_EXPIRED(p_tmr)                            OS_TRACE_REC_OBJ(TMR_EXPIRED, p_tmr)
+
+
+/*
+*********************************************************************************************************
+*                                       uC/OS-II API ENTER EVENTS
+*********************************************************************************************************
+*/
+
+#if (defined(OS_TRACE_API_ENTER_EN) && (OS_TRACE_API_ENTER_EN > 0u))
+#define  OS_TRACE_MBOX_DEL_ENTER(p_mbox, opt)                   OS_TRACE_REC_ARG(MBOX_DEL_ENTER, opt, OS_TRACE_REC_ADDR(p_mbox), 0u)
+#define  OS_TRACE_MBOX_POST_ENTER(p_mbox)                       OS_TRACE_REC_OBJ(MBOX_POST_ENTER, p_mbox)
+#define  OS_TRACE_MBOX_POST_OPT_ENTER(p_mbox, opt)              OS_TRACE_REC_ARG(MBOX_POST_OPT_ENTER, opt, OS_TRACE_REC_ADDR(p_mbox), 0u)
+#define  OS_TRACE_MBOX_PEND_ENTER(p_mbox, timeout)              OS_TRACE_REC_ARG(MBOX_PEND_ENTER, 0u, OS_TRACE_REC_ADDR(p_mbox), timeout)
+
+#define  OS_TRACE_MUTEX_DEL_ENTER(p_mutex, opt)                 OS_TRACE_REC_ARG(MUTEX_DEL_ENTER, opt, OS_TRACE_REC_ADDR(p_mutex), 0u)
+#define  OS_TRACE_MUTEX_POST_ENTER(p_mutex)                     OS_TRACE_REC_OBJ(MUTEX_POST_ENTER, p_mutex)
+#define  OS_TRACE_MUTEX_PEND_ENTER(p_mutex, timeout)            OS_TRACE_REC_ARG(MUTEX_PEND_ENTER, 0u, OS_TRACE_REC_ADDR(p_mutex), timeout)
+
+#define  OS_TRACE_SEM_DEL_ENTER(p_sem, opt)                     OS_TRACE_REC_ARG(SEM_DEL_ENTER, opt, OS_TRACE_REC_ADDR(p_sem), 0u)
+#define  OS_TRACE_SEM_POST_ENTER(p_sem)                         OS_TRACE_REC_OBJ(SEM_POST_ENTER, p_sem)
+#define  OS_TRACE_SEM_PEND_ENTER(p_sem, timeout)                OS_TRACE_REC_ARG(SEM_PEND_ENTER, 0u, OS_TRACE_REC_ADDR(p_sem), timeout)
+
+#define  OS_TRACE_Q_DEL_ENTER(p_q, opt)                         OS_TRACE_REC_ARG(Q_DEL_ENTER, opt, OS_TRACE_REC_ADDR(p_q), 0u)
+#define  OS_TRACE_Q_POST_ENTER(p_q)                             OS_TRACE_REC_OBJ(Q_POST_ENTER, p_q)
+#define  OS_TRACE_Q_POST_FRONT_ENTER(p_q)                       OS_TRACE_REC_OBJ(Q_POST_FRONT_ENTER, p_q)
+#define  OS_TRACE_Q_POST_OPT_ENTER(p_q, opt)                    OS_TRACE_REC_ARG(Q_POST_OPT_ENTER, opt, OS_TRACE_REC_ADDR(p_q), 0u)
+#define  OS_TRACE_Q_PEND_ENTER(p_q, timeout)                    OS_TRACE_REC_ARG(Q_PEND_ENTER, 0u, OS_TRACE_REC_ADDR(p_q), timeout)
+
+#define  OS_TRACE_FLAG_DEL_ENTER(p_grp, opt)                    OS_TRACE_REC_ARG(FLAG_DEL_ENTER, opt, OS_TRACE_REC_ADDR(p_grp), 0u)
+#define  OS_TRACE_FLAG_POST_ENTER(p_grp, flags, opt)            OS_TRACE_REC_ARG(FLAG_POST_ENTER, opt, OS_TRACE_REC_ADDR(p_grp), flags)
+#define  OS_TRACE_FLAG_PEND_ENTER(p_grp, flags, timeout, opt)   OS_TRACE_REC_ARG(FLAG_PEND_ENTER, opt, OS_TRACE_REC_ADDR(p_grp), flags)
+
+#define  OS_TRACE_MEM_PUT_ENTER(p_mem, p_blk)                   OS_TRACE_REC_ARG(MEM_PUT_ENTER, 0u, OS_TRACE_REC_ADDR(p_mem), OS_TRACE_REC_ADDR(p_blk))
+#define  OS_TRACE_MEM_GET_ENTER(p_mem)                          OS_TRACE_REC_OBJ(MEM_GET_ENTER, p_mem)
+
+#define  OS_TRACE_TMR_DEL_ENTER(p_tmr)                          OS_TRACE_REC_OBJ(TMR_DEL_ENTER, p_tmr)
+#define  OS_TRACE_TMR_START_ENTER(p_tmr)                        OS_TRACE_REC_OBJ(TMR_START_ENTER, p_tmr)
+#define  OS_TRACE_TMR_STOP_ENTER(p_tmr)                         OS_TRACE_REC_OBJ(TMR_STOP_ENTER, p_tmr)
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       uC/OS-II API EXIT EVENTS
+*********************************************************************************************************
+*/
+
+#if (defined(OS_TRACE_API_EXIT_EN) && (OS_TRACE_API_EXIT_EN > 0u))
+#define  OS_TRACE_MBOX_DEL_EXIT(RetVal)                         OS_TRACE_REC_RET(MBOX_DEL_EXIT, RetVal)
+#define  OS_TRACE_MBOX_POST_EXIT(RetVal)                        OS_TRACE_REC_RET(MBOX_POST_EXIT, RetVal)
+#define  OS_TRACE_MBOX_POST_OPT_EXIT(RetVal)                    OS_TRACE_REC_RET(MBOX_POST_OPT_EXIT, RetVal)
+#define  OS_TRACE_MBOX_PEND_EXIT(RetVal)                        OS_TRACE_REC_RET(MBOX_PEND_EXIT, RetVal)
+
+#define  OS_TRACE_MUTEX_DEL_EXIT(RetVal)                        OS_TRACE_REC_RET(MUTEX_DEL_EXIT, RetVal)
+#define  OS_TRACE_MUTEX_POST_EXIT(RetVal)                       OS_TRACE_REC_RET(MUTEX_POST_EXIT, RetVal)
+#define  OS_TRACE_MUTEX_PEND_EXIT(RetVal)                       OS_TRACE_REC_RET(MUTEX_PEND_EXIT, RetVal)
+
+#define  OS_TRACE_SEM_DEL_EXIT(RetVal)                          OS_TRACE_REC_RET(SEM_DEL_EXIT, RetVal)
+#define  OS_TRACE_SEM_POST_EXIT(RetVal)                         OS_TRACE_REC_RET(SEM_POST_EXIT, RetVal)
+#define  OS_TRACE_SEM_PEND_EXIT(RetVal)                         OS_TRACE_REC_RET(SEM_PEND_EXIT, RetVal)
+
+#define  OS_TRACE_Q_DEL_EXIT(RetVal)                            OS_TRACE_REC_RET(Q_DEL_EXIT, RetVal)
+#define  OS_TRACE_Q_POST_EXIT(RetVal)                           OS_TRACE_REC_RET(Q_POST_EXIT, RetVal)
+#define  OS_TRACE_Q_POST_FRONT_EXIT(RetVal)                     OS_TRACE_REC_RET(Q_POST_FRONT_EXIT, RetVal)
+#define  OS_TRACE_Q_POST_OPT_EXIT(RetVal)                       OS_TRACE_REC_RET(Q_POST_OPT_EXIT, RetVal)
+#define  OS_TRACE_Q_PEND_EXIT(RetVal)                           OS_TRACE_REC_RET(Q_PEND_EXIT, RetVal)
+
+#define  OS_TRACE_FLAG_DEL_EXIT(RetVal)                         OS_TRACE_REC_RET(FLAG_DEL_EXIT, RetVal)
+#define  OS_TRACE_FLAG_POST_EXIT(RetVal)                        OS_TRACE_REC_RET(FLAG_POST_EXIT, RetVal)
+#define  OS_TRACE_FLAG_PEND_EXIT(RetVal)                        OS_TRACE_REC_RET(FLAG_PEND_EXIT, RetVal)
+
+#define  OS_TRACE_MEM_PUT_EXIT(RetVal)                          OS_TRACE_REC_RET(MEM_PUT_EXIT, RetVal)
+#define  OS_TRACE_MEM_GET_EXIT(RetVal)                          OS_TRACE_REC_RET(MEM_GET_EXIT, RetVal)
+
+#define  OS_TRACE_TMR_DEL_EXIT(RetVal)                          OS_TRACE_REC_RET(TMR_DEL_EXIT, RetVal)
+#define  OS_TRACE_TMR_START_EXIT(RetVal)                        OS_TRACE_REC_RET(TMR_START_EXIT, RetVal)
+#define  OS_TRACE_TMR_STOP_EXIT(RetVal)                         OS_TRACE_REC_RET(TMR_STOP_EXIT, RetVal)
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif
@@ -0,0 +1,238 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-II
+*                                        The Real-Time Kernel
+*
+*                    Copyright 1992-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*
+*                                        BINARY TRACE RECORDER
+*
+* Filename : os_trace_rec.c
+* Version  : V2.93.01
+*********************************************************************************************************
+* Note(s) : (1) See os_trace_events.h for how to use the recorder.
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+
+#include <ucos_ii.h>
+
+
+/*
+*********************************************************************************************************
+*                                         CONFIGURATION CHECKS
+*********************************************************************************************************
+*/
+
+#ifndef  OS_TRACE_REC_TS_GET
+#error  "OS_TRACE_REC_TS_GET() not defined: the port does not provide OS_CPU_TS_GET(), define it in app_cfg.h"
+#endif
+
+#if     (OS_TRACE_REC_CFG_NBR_RECS == 0u) || ((OS_TRACE_REC_CFG_NBR_RECS & (OS_TRACE_REC_CFG_NBR_RECS - 1u)) != 0u)
+#error  "OS_TRACE_REC_CFG_NBR_RECS must be a power of 2"
+#endif
+
+#if      OS_CRITICAL_METHOD == 1u
+#error  "The trace recorder is called from within critical sections and requires OS_CRITICAL_METHOD 2 or 3"
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+OS_TRACE_REC_BUF  OSTraceRecBuf;
+
+
+/*
+*********************************************************************************************************
+*                                        INITIALIZE THE RECORDER
+*
+* Description: This function initializes the recording buffer.  It is called by OS_TRACE_INIT().
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) Recording is stopped, call OSTraceRecStart() to start it.
+*
+*              2) The magic number is written last so that a dump taken before the buffer is fully
+*                 initialized is not decoded.
+*********************************************************************************************************
+*/
+
+void  OSTraceRecInit (void)
+{
+#if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+    OS_ENTER_CRITICAL();
+    OSTraceRecBuf.Magic   = 0u;
+    OSTraceRecBuf.Running = 0u;
+    OSTraceRecBuf.RecSize = (INT16U)sizeof(OS_TRACE_REC);
+    OSTraceRecBuf.Policy  = (INT16U)OS_TRACE_REC_CFG_POLICY;
+    OSTraceRecBuf.NbrRecs = OS_TRACE_REC_CFG_NBR_RECS;
+    OSTraceRecBuf.WrCtr   = 0u;
+    OSTraceRecBuf.DropCtr = 0u;
+    OSTraceRecBuf.TSPrev  = 0u;
+    OSTraceRecBuf.TSFreq  = OS_TRACE_REC_CFG_TS_FREQ;
+    OSTraceRecBuf.Magic   = OS_TRACE_REC_MAGIC;            /* See Note #2                              */
+    OS_EXIT_CRITICAL();
+}
+
+
+/*
+*********************************************************************************************************
+*                                       START/STOP THE RECORDER
+*
+* Description: OSTraceRecStart() starts recording.  A OS_TRACE_REC_EVT_START record is made first, its
+*              timestamp delta is 0.
+*
+*              OSTraceRecStop() stops recording.  The records made so far are kept.
+*
+* Arguments  : none
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+void  OSTraceRecStart (void)
+{
+#if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+    OS_ENTER_CRITICAL();
+    OSTraceRecBuf.TSPrev  = OS_TRACE_REC_TS_GET();
+    OSTraceRecBuf.Running = 1u;
+    OS_TraceRecEvt(OS_TRACE_REC_EVT_START, 0u, 0u, 0u);
+    OS_EXIT_CRITICAL();
+}
+
+
+void  OSTraceRecStop (void)
+{
+    OSTraceRecBuf.Running = 0u;
+}
+
+
+/*
+*********************************************************************************************************
+*                                          CLEAR THE RECORDER
+*
+* Description: This function discards all the records.  Recording continues if it was started.
+*
+* Arguments  : none
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+void  OSTraceRecClear (void)
+{
+#if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+    OS_ENTER_CRITICAL();
+    OSTraceRecBuf.WrCtr   = 0u;
+    OSTraceRecBuf.DropCtr = 0u;
+    OS_EXIT_CRITICAL();
+}
+
+
+/*
+*********************************************************************************************************
+*                                            MAKE A RECORD
+*
+* Description: This function is called through the OS_TRACE_xxx() macros to record an event.
+*
+* Arguments  : evt       is the event code (OS_TRACE_REC_EVT_xxx).
+*
+*              arg16     is a small argument: a priority, an option or an error code.
+*
+*              arg0      is the main argument: usually the address of the task or of the kernel object.
+*
+*              arg1      is a second argument: a timeout, flags, a new priority...
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is on the hot path of every kernel service and is kept short: no lock is
+*                 taken, the record slot is reserved and filled with interrupts disabled for a few
+*                 instructions.  It may be called from tasks and ISRs, with or without interrupts
+*                 already disabled.
+*
+*              2) The buffer is a ring indexed by the free running WrCtr.  With the overwrite policy, the
+*                 oldest record is overwritten.  With the stop policy, new records are dropped and counted
+*                 in DropCtr once the buffer is full.
+*
+*              3) This function is INTERNAL to the recorder and your application should not call it.
+*********************************************************************************************************
+*/
+
+void  OS_TraceRecEvt (INT8U   evt,
+                      INT16U  arg16,
+                      INT32U  arg0,
+                      INT32U  arg1)
+{
+    OS_TRACE_REC  *p_rec;
+    INT32U         wr_ctr;
+    INT32U         ts;
+#if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
+    OS_CPU_SR      cpu_sr = 0u;
+#endif
+
+
+
+    if (OSTraceRecBuf.Running == 0u) {                     /* Nothing to do when recording is stopped  */
+        return;
+    }
+
+    OS_ENTER_CRITICAL();
+    wr_ctr = OSTraceRecBuf.WrCtr;
+#if OS_TRACE_REC_CFG_POLICY == OS_TRACE_REC_POLICY_STOP
+    if (wr_ctr >= OS_TRACE_REC_CFG_NBR_RECS) {             /* See Note #2                              */
+        OSTraceRecBuf.DropCtr++;
+        OS_EXIT_CRITICAL();
+        return;
+    }
+#endif
+    ts                   = OS_TRACE_REC_TS_GET();
+    p_rec                = &OSTraceRecBuf.Recs[wr_ctr & (OS_TRACE_REC_CFG_NBR_RECS - 1u)];
+    p_rec->TSDelta       = ts - OSTraceRecBuf.TSPrev;
+    p_rec->Evt           = evt;
+    if (OSIntNesting > 0u) {                               /* Record the context of the event          */
+        p_rec->Ctx       = OS_TRACE_REC_CTX_ISR;
+    } else {
+        p_rec->Ctx       = OSPrioCur;
+    }
+    p_rec->Arg16         = arg16;
+    p_rec->Arg0          = arg0;
+    p_rec->Arg1          = arg1;
+    OSTraceRecBuf.TSPrev = ts;
+    OSTraceRecBuf.WrCtr  = wr_ctr + 1u;
+    OS_EXIT_CRITICAL();
+}
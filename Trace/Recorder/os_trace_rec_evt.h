@@ -0,0 +1,195 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-II
+*                                        The Real-Time Kernel
+*
+*                    Copyright 1992-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*
+*                                   BINARY TRACE RECORDER EVENT CODES
+*
+* Filename : os_trace_rec_evt.h
+* Version  : V2.93.01
+*********************************************************************************************************
+* Note(s) : (1) This file only contains constants.  It is shared by the recorder (os_trace_rec.c) and by
+*               the host decoder (Decoder/os_trace_dec.c) and MUST NOT depend on any other header.
+*
+*           (2) The event codes are stored in the records, new events MUST be appended so that existing
+*               dumps remain readable.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_TRACE_REC_EVT_H
+#define  OS_TRACE_REC_EVT_H
+
+
+/*
+*********************************************************************************************************
+*                                         RECORDING BUFFER LAYOUT
+*
+* Note(s) : (1) The recording buffer starts with a 32 byte header followed by OS_TRACE_REC_CFG_NBR_RECS
+*               records of OS_TRACE_REC_SIZE bytes each (see OS_TRACE_REC_BUF in os_trace_events.h).
+*               All fields are stored in the byte order of the target.
+*
+*           (2) OS_TRACE_REC_MAGIC is written last by OSTraceRecInit().  It lets the decoder find the
+*               buffer in a raw memory dump and detect its byte order.
+*********************************************************************************************************
+*/
+
+#define  OS_TRACE_REC_MAGIC                             0x32544355u     /* Marks an initialized buffer */
+#define  OS_TRACE_REC_HDR_SIZE                                  32u
+#define  OS_TRACE_REC_SIZE                                      16u
+
+#define  OS_TRACE_REC_POLICY_OVERWRITE                           0u     /* Oldest records are lost     */
+#define  OS_TRACE_REC_POLICY_STOP                                1u     /* Newest records are lost     */
+
+#define  OS_TRACE_REC_CTX_ISR                                 0xFFu     /* Record was made by an ISR   */
+
+
+/*
+*********************************************************************************************************
+*                                              EVENT CODES
+*********************************************************************************************************
+*/
+
+                                                         /* ---------------- RECORDER ----------------- */
+#define  OS_TRACE_REC_EVT_NONE                                   0u
+#define  OS_TRACE_REC_EVT_START                                  1u
+
+                                                         /* ------------------- ISR ------------------- */
+#define  OS_TRACE_REC_EVT_ISR_ENTER                              2u
+#define  OS_TRACE_REC_EVT_ISR_EXIT                               3u
+#define  OS_TRACE_REC_EVT_ISR_EXIT_TO_SCHEDULER                  4u
+#define  OS_TRACE_REC_EVT_ISR_REGISTER                           5u
+#define  OS_TRACE_REC_EVT_ISR_BEGIN                              6u
+#define  OS_TRACE_REC_EVT_ISR_END                                7u
+
+                                                         /* ------------------ TICK ------------------- */
+#define  OS_TRACE_REC_EVT_TICK_INCREMENT                         8u
+
+                                                         /* ------------------ TASK ------------------- */
+#define  OS_TRACE_REC_EVT_TASK_CREATE                            9u
+#define  OS_TRACE_REC_EVT_TASK_CREATE_FAILED                    10u
+#define  OS_TRACE_REC_EVT_TASK_DEL                              11u
+#define  OS_TRACE_REC_EVT_TASK_READY                            12u
+#define  OS_TRACE_REC_EVT_TASK_SWITCHED_IN                      13u
+#define  OS_TRACE_REC_EVT_TASK_DLY                              14u
+#define  OS_TRACE_REC_EVT_TASK_SUSPEND                          15u
+#define  OS_TRACE_REC_EVT_TASK_SUSPENDED                        16u
+#define  OS_TRACE_REC_EVT_TASK_RESUME                           17u
+#define  OS_TRACE_REC_EVT_TASK_PRIO_CHANGE                      18u
+#define  OS_TRACE_REC_EVT_TASK_NAME_SET                         19u
+#define  OS_TRACE_REC_EVT_EVENT_NAME_SET                        20u
+
+                                                         /* ----------------- OBJECTS ----------------- */
+#define  OS_TRACE_REC_EVT_MBOX_CREATE                           21u
+#define  OS_TRACE_REC_EVT_MUTEX_CREATE                          22u
+#define  OS_TRACE_REC_EVT_MUTEX_DEL                             23u
+#define  OS_TRACE_REC_EVT_MUTEX_POST                            24u
+#define  OS_TRACE_REC_EVT_MUTEX_POST_FAILED                     25u
+#define  OS_TRACE_REC_EVT_MUTEX_PEND                            26u
+#define  OS_TRACE_REC_EVT_MUTEX_PEND_FAILED                     27u
+#define  OS_TRACE_REC_EVT_MUTEX_PEND_BLOCK                      28u
+#define  OS_TRACE_REC_EVT_MUTEX_TASK_PRIO_INHERIT               29u
+#define  OS_TRACE_REC_EVT_MUTEX_TASK_PRIO_DISINHERIT            30u
+#define  OS_TRACE_REC_EVT_SEM_CREATE                            31u
+#define  OS_TRACE_REC_EVT_SEM_DEL                               32u
+#define  OS_TRACE_REC_EVT_SEM_POST                              33u
+#define  OS_TRACE_REC_EVT_SEM_POST_FAILED                       34u
+#define  OS_TRACE_REC_EVT_SEM_PEND                              35u
+#define  OS_TRACE_REC_EVT_SEM_PEND_FAILED                       36u
+#define  OS_TRACE_REC_EVT_SEM_PEND_BLOCK                        37u
+#define  OS_TRACE_REC_EVT_Q_CREATE                              38u
+#define  OS_TRACE_REC_EVT_Q_DEL                                 39u
+#define  OS_TRACE_REC_EVT_Q_POST                                40u
+#define  OS_TRACE_REC_EVT_Q_POST_FAILED                         41u
+#define  OS_TRACE_REC_EVT_Q_PEND                                42u
+#define  OS_TRACE_REC_EVT_Q_PEND_FAILED                         43u
+#define  OS_TRACE_REC_EVT_Q_PEND_BLOCK                          44u
+#define  OS_TRACE_REC_EVT_FLAG_CREATE                           45u
+#define  OS_TRACE_REC_EVT_FLAG_DEL                              46u
+#define  OS_TRACE_REC_EVT_FLAG_POST                             47u
+#define  OS_TRACE_REC_EVT_FLAG_POST_FAILED                      48u
+#define  OS_TRACE_REC_EVT_FLAG_PEND                             49u
+#define  OS_TRACE_REC_EVT_FLAG_PEND_FAILED                      50u
+#define  OS_TRACE_REC_EVT_FLAG_PEND_BLOCK                       51u
+#define  OS_TRACE_REC_EVT_MEM_CREATE                            52u
+#define  OS_TRACE_REC_EVT_MEM_PUT                               53u
+#define  OS_TRACE_REC_EVT_MEM_PUT_FAILED                        54u
+#define  OS_TRACE_REC_EVT_MEM_GET                               55u
+#define  OS_TRACE_REC_EVT_MEM_GET_FAILED                        56u
+#define  OS_TRACE_REC_EVT_TMR_CREATE                            57u
+#define  OS_TRACE_REC_EVT_TMR_EXPIRED                           58u
+
+                                                         /* ---------------- API ENTER ---------------- */
+#define  OS_TRACE_REC_EVT_MBOX_DEL_ENTER                        59u
+#define  OS_TRACE_REC_EVT_MBOX_POST_ENTER                       60u
+#define  OS_TRACE_REC_EVT_MBOX_POST_OPT_ENTER                   61u
+#define  OS_TRACE_REC_EVT_MBOX_PEND_ENTER                       62u
+#define  OS_TRACE_REC_EVT_MUTEX_DEL_ENTER                       63u
+#define  OS_TRACE_REC_EVT_MUTEX_POST_ENTER                      64u
+#define  OS_TRACE_REC_EVT_MUTEX_PEND_ENTER                      65u
+#define  OS_TRACE_REC_EVT_SEM_DEL_ENTER                         66u
+#define  OS_TRACE_REC_EVT_SEM_POST_ENTER                        67u
+#define  OS_TRACE_REC_EVT_SEM_PEND_ENTER                        68u
+#define  OS_TRACE_REC_EVT_Q_DEL_ENTER                           69u
+#define  OS_TRACE_REC_EVT_Q_POST_ENTER                          70u
+#define  OS_TRACE_REC_EVT_Q_POST_FRONT_ENTER                    71u
+#define  OS_TRACE_REC_EVT_Q_POST_OPT_ENTER                      72u
+#define  OS_TRACE_REC_EVT_Q_PEND_ENTER                          73u
+#define  OS_TRACE_REC_EVT_FLAG_DEL_ENTER                        74u
+#define  OS_TRACE_REC_EVT_TMR_DEL_ENTER                         75u
+#define  OS_TRACE_REC_EVT_TMR_START_ENTER                       76u
+#define  OS_TRACE_REC_EVT_TMR_STOP_ENTER                        77u
+#define  OS_TRACE_REC_EVT_FLAG_POST_ENTER                       78u
+#define  OS_TRACE_REC_EVT_FLAG_PEND_ENTER                       79u
+#define  OS_TRACE_REC_EVT_MEM_PUT_ENTER                         80u
+#define  OS_TRACE_REC_EVT_MEM_GET_ENTER                         81u
+
+                                                         /* ---------------- API EXIT ----------------- */
+#define  OS_TRACE_REC_EVT_MBOX_DEL_EXIT                         82u
+#define  OS_TRACE_REC_EVT_MBOX_POST_EXIT                        83u
+#define  OS_TRACE_REC_EVT_MBOX_POST_OPT_EXIT                    84u
+#define  OS_TRACE_REC_EVT_MBOX_PEND_EXIT                        85u
+#define  OS_TRACE_REC_EVT_MUTEX_DEL_EXIT                        86u
+#define  OS_TRACE_REC_EVT_MUTEX_POST_EXIT                       87u
+#define  OS_TRACE_REC_EVT_MUTEX_PEND_EXIT                       88u
+#define  OS_TRACE_REC_EVT_SEM_DEL_EXIT                          89u
+#define  OS_TRACE_REC_EVT_SEM_POST_EXIT                         90u
+#define  OS_TRACE_REC_EVT_SEM_PEND_EXIT                         91u
+#define  OS_TRACE_REC_EVT_Q_DEL_EXIT                            92u
+#define  OS_TRACE_REC_EVT_Q_POST_EXIT                           93u
+#define  OS_TRACE_REC_EVT_Q_POST_FRONT_EXIT                     94u
+#define  OS_TRACE_REC_EVT_Q_POST_OPT_EXIT                       95u
+#define  OS_TRACE_REC_EVT_Q_PEND_EXIT                           96u
+#define  OS_TRACE_REC_EVT_FLAG_DEL_EXIT                         97u
+#define  OS_TRACE_REC_EVT_FLAG_POST_EXIT                        98u
+#define  OS_TRACE_REC_EVT_FLAG_PEND_EXIT                        99u
+#define  OS_TRACE_REC_EVT_MEM_PUT_EXIT                         100u
+#define  OS_TRACE_REC_EVT_MEM_GET_EXIT                         101u
+#define  OS_TRACE_REC_EVT_TMR_DEL_EXIT                         102u
+#define  OS_TRACE_REC_EVT_TMR_START_EXIT                       103u
+#define  OS_TRACE_REC_EVT_TMR_STOP_EXIT                        104u
+
+#define  OS_TRACE_REC_EVT_NBR                                  105u
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif